@@ -23,6 +23,7 @@
 #include "IOHIDTimeSyncService.h"
 #include "IOHIDTimeSyncKeys.h"
 #include <IOKit/IOKitKeys.h>
+#include "IOHIDPrivateKeys.h"
 #include "../IOHIDDebug.h"
 #include "IOHIDFamilyTrace.h"
 
@@ -391,9 +392,13 @@ IOFastPathHIDAccelService::handleAccelerometerEvent(IOHIDEvent * event)
 
     IOHID_DEBUG(kIOHIDDebugCode_IOFastPath_EnqueueSample, event->getTimeStamp(), entry->sampleTimestamp, entry->sampleID, kIOHIDEventTypeAccelerometer);
 
-    IOReturn ret = IOCircularDataQueueEnqueue(getQueue(), entry, copySample()->getLength());
+    // sample IDs only advance with samples readers can see, so a gap is a real drop
+    IOReturn ret = enqueueSample(entry, copySample()->getLength());
     if (ret != kIOReturnSuccess) {
-        HIDServiceLogError("IOCircularDataQueueEnqueue:0x%x", ret);
+        HIDServiceLogError("enqueueSample:0x%x", ret);
+    }
+    else {
+        ++generation;
     }
 }
 
@@ -406,7 +411,7 @@ IOFastPathHIDAccelService::parseSampleFromHIDEvent(IOHIDEvent * event, QueueEntr
     *sample = (QueueEntry) {
         .eventTimestamp = event->getTimeStamp(),
         .sampleTimestamp = 0,
-        .sampleID = generation++,
+        .sampleID = generation,
         .x = event->getDoubleValue(kIOHIDEventFieldAccelerometerX, 0),
         .y = event->getDoubleValue(kIOHIDEventFieldAccelerometerY, 0),
         .z = event->getDoubleValue(kIOHIDEventFieldAccelerometerZ, 0),
@@ -485,9 +490,13 @@ IOFastPathHIDGyroService::handleGyroEvent(IOHIDEvent * event)
 
     IOHID_DEBUG(kIOHIDDebugCode_IOFastPath_EnqueueSample, event->getTimeStamp(), entry->sampleTimestamp, entry->sampleID, kIOHIDEventTypeGyro);
 
-    IOReturn ret = IOCircularDataQueueEnqueue(getQueue(), entry, copySample()->getLength());
+    // sample IDs only advance with samples readers can see, so a gap is a real drop
+    IOReturn ret = enqueueSample(entry, copySample()->getLength());
     if (ret != kIOReturnSuccess) {
-        HIDServiceLogError("IOCircularDataQueueEnqueue:0x%x", ret);
+        HIDServiceLogError("enqueueSample:0x%x", ret);
+    }
+    else {
+        ++generation;
     }
 }
 
@@ -500,7 +509,7 @@ IOFastPathHIDGyroService::parseSampleFromHIDEvent(IOHIDEvent * event, QueueEntry
     *sample = (QueueEntry) {
         .eventTimestamp = event->getTimeStamp(),
         .sampleTimestamp = 0,
-        .sampleID = generation++,
+        .sampleID = generation,
         .x = event->getDoubleValue(kIOHIDEventFieldGyroX, 0),
         .y = event->getDoubleValue(kIOHIDEventFieldGyroY, 0),
         .z = event->getDoubleValue(kIOHIDEventFieldGyroZ, 0),
@@ -517,6 +526,142 @@ exit:
 }
 
 
+#pragma mark - IOFastPathHIDEventService
+
+OSDefineMetaClassAndStructors(IOFastPathHIDEventService, IOFastPathHIDService);
+
+bool
+IOFastPathHIDEventService::start(IOService * provider)
+{
+    bool ok = super::start(provider);
+    require(ok, exit);
+
+    setName("event");
+    registerService();
+
+exit:
+    return ok;
+}
+
+OSSharedPtr<IOFastPathDescriptor>
+IOFastPathHIDEventService::createDescriptor()
+{
+    OSSharedPtr<IOFastPathDescriptor> descriptor = nullptr;
+    OSSharedPtr<OSArray> fields = OSArray::withCapacity(4);
+    assert(fields);
+
+    fields->setObject(IOFastPathField::create(kIOFastPathFieldKeyTimestamp, kIOFastPathFieldTypeInteger, offsetof(QueueEntryHeader, eventTimestamp), sizeof(QueueEntryHeader::eventTimestamp)));
+    fields->setObject(IOFastPathField::create(kIOFastPathFieldKeySampleTimestamp, kIOFastPathFieldTypeInteger, offsetof(QueueEntryHeader, sampleTimestamp), sizeof(QueueEntryHeader::sampleTimestamp)));
+    fields->setObject(IOFastPathField::create(kIOFastPathFieldKeySampleID, kIOFastPathFieldTypeInteger, offsetof(QueueEntryHeader, sampleID), sizeof(QueueEntryHeader::sampleID)));
+
+    require_action(parseEventFields(fields.get()), exit, HIDServiceLogError("invalid %s", kIOHIDFastPathEventFieldsKey));
+
+    descriptor = IOFastPathDescriptor::create(fields.get());
+
+exit:
+    return descriptor;
+}
+
+bool
+IOFastPathHIDEventService::parseEventFields(OSArray * fields)
+{
+    bool success = false;
+    OSSharedPtr<OSArray> declared = OSDynamicPtrCast<OSArray>(_service->copyProperty(kIOHIDFastPathEventFieldsKey, gIOServicePlane));
+    require_action_quiet(declared && declared->getCount() > 0, exit, HIDServiceLogError("missing %s", kIOHIDFastPathEventFieldsKey));
+
+    _fields = OSData::withCapacity(declared->getCount() * sizeof(EventField));
+    assert(_fields);
+
+    for (unsigned int i = 0; i < declared->getCount(); ++i) {
+        OSDictionary * dict = OSDynamicCast(OSDictionary, declared->getObject(i));
+        OSNumber * field = dict ? OSDynamicCast(OSNumber, dict->getObject(kIOHIDFastPathEventFieldKey)) : nullptr;
+        OSNumber * key = dict ? OSDynamicCast(OSNumber, dict->getObject(kIOHIDFastPathFieldKeyKey)) : nullptr;
+        OSNumber * type = dict ? OSDynamicCast(OSNumber, dict->getObject(kIOHIDFastPathFieldTypeKey)) : nullptr;
+        EventField entry;
+
+        require_action_quiet(field && key, exit, HIDServiceLogError("field %u: missing event field or key", i));
+
+        entry.field = field->unsigned32BitValue();
+        entry.type = type ? (IOFastPathFieldType)type->unsigned32BitValue() : kIOFastPathFieldTypeInteger;
+        require_action_quiet(entry.type == kIOFastPathFieldTypeInteger || entry.type == kIOFastPathFieldTypeDouble, exit,
+                             HIDServiceLogError("field %u: unsupported type %u", i, entry.type));
+
+        // a sample is produced from a single event, so all fields must belong to the same type
+        if (i == 0) {
+            _eventType = IOHIDEventFieldEventType(entry.field);
+        }
+        require_action_quiet(IOHIDEventFieldEventType(entry.field) == _eventType, exit,
+                             HIDServiceLogError("field %u: event type %u, expected %u", i, IOHIDEventFieldEventType(entry.field), _eventType));
+
+        fields->setObject(IOFastPathField::create((IOFastPathFieldKey)key->unsigned32BitValue(), entry.type, sizeof(QueueEntryHeader) + i * sizeof(UInt64), sizeof(UInt64)));
+        _fields->appendBytes(&entry, sizeof(entry));
+    }
+
+    success = true;
+
+exit:
+    return success;
+}
+
+void
+IOFastPathHIDEventService::handleEvent(IOHIDEventService * sender, void * context, IOHIDEvent * event, IOOptionBits options)
+{
+    if (event->getType() == _eventType) {
+        handleMatchingEvent(event);
+    }
+
+    // recursively handle all children, e.g. digitizer contacts or collection members
+    for (unsigned int i = 0; event->getChildren() && i < event->getChildren()->getCount(); ++i) {
+        IOHIDEvent * subevent = OSRequiredCast(IOHIDEvent, event->getChildren()->getObject(i));
+        handleEvent(sender, context, subevent, options);
+    }
+}
+
+void
+IOFastPathHIDEventService::handleMatchingEvent(IOHIDEvent * event)
+{
+    OSSharedPtr<OSData> sample = copySample();
+    QueueEntryHeader * header = (QueueEntryHeader *)sample->getBytesNoCopy();
+    UInt64 * values = (UInt64 *)(header + 1);
+    const EventField * fields = (const EventField *)_fields->getBytesNoCopy();
+    unsigned int count = _fields->getLength() / sizeof(EventField);
+    IOReturn ret = kIOReturnInvalid;
+    UInt64 synced = 0;
+
+    header->eventTimestamp = event->getTimeStamp();
+    header->sampleTimestamp = 0;
+    header->sampleID = generation;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        if (fields[i].type == kIOFastPathFieldTypeDouble) {
+            double value = event->getDoubleValue(fields[i].field, 0);
+            memcpy(&values[i], &value, sizeof(value));
+        }
+        else {
+            values[i] = (UInt64)(SInt64)event->getIntegerValue(fields[i].field, 0);
+        }
+    }
+
+    ret = doTimeSyncForHIDEventGated(event, &synced);
+    if (ret == kIOReturnSuccess) {
+        header->sampleTimestamp = synced;
+    }
+    else if (ret != kIOReturnNotReady && ret != kIOReturnUnsupported) {
+        HIDServiceLogError("toSyncedTime: 0x%x", ret);
+    }
+
+    IOHID_DEBUG(kIOHIDDebugCode_IOFastPath_EnqueueSample, event->getTimeStamp(), header->sampleTimestamp, header->sampleID, _eventType);
+
+    ret = enqueueSample(header, sample->getLength());
+    if (ret != kIOReturnSuccess) {
+        HIDServiceLogError("enqueueSample:0x%x", ret);
+    }
+    else {
+        ++generation;
+    }
+}
+
+
 #pragma mark - IOFastPathLEDHIDService
 
 OSDefineMetaClassAndStructors(IOFastPathHIDLEDService, IOFastPathHIDService);
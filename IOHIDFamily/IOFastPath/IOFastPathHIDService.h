@@ -249,6 +249,67 @@ private:
 };
 
 
+/// IOFastPath service which generates samples from arbitrary HID event fields.
+///
+/// The fields are declared by the HID device under `kIOHIDFastPathEventFieldsKey`, so new sensors or
+/// controls can use the fast path without a dedicated subclass. The service matches event services
+/// which publish that key. One sample is enqueued
+/// for every event of the declared type dispatched by the provider, including child events such as
+/// digitizer contacts. Every sample starts with the following keys, followed by the declared fields
+/// (8 bytes each):
+///   - `kIOFastPathFieldKeyTimestamp`
+///   - `kIOFastPathFieldKeySampleTimestamp`
+///   - `kIOFastPathFieldKeySampleID`
+///
+class IOFastPathHIDEventService : public IOFastPathHIDService
+{
+    OSDeclareDefaultStructors(IOFastPathHIDEventService);
+    using super = IOFastPathHIDService;
+
+public:
+
+    /// Start the service. See IOKit/IOService.h for more info.
+    virtual bool start(IOService * provider) override;
+
+protected:
+
+    virtual bool isProducer() const override { return true; }
+
+    /// Create the service's fast path descriptor from the declared event fields.
+    ///
+    virtual OSPtr<IOFastPathDescriptor> createDescriptor() override;
+
+    /// Handle a HID event dispatched by the event service. Enqueue a sample for the event and each
+    /// descendant event of the declared type.
+    ///
+    virtual void handleEvent(IOHIDEventService * sender, void * context, IOHIDEvent * event, IOOptionBits options) override;
+
+private:
+
+    struct __attribute__((packed)) QueueEntryHeader {
+        UInt64 eventTimestamp;
+        UInt64 sampleTimestamp;
+        UInt64 sampleID;
+    };
+
+    struct EventField {
+        IOHIDEventField field;
+        IOFastPathFieldType type;
+    };
+
+    /// Parse `kIOHIDFastPathEventFieldsKey` into `_fields` and the fast path fields in `fields`.
+    ///
+    bool parseEventFields(OSArray * fields);
+
+    void handleMatchingEvent(IOHIDEvent * event);
+
+    OSPtr<OSData> _fields; ///< array of `EventField`, in sample order
+    IOHIDEventType _eventType;
+
+    UInt64 generation; ///< counter used to generate sample IDs
+};
+
+
 /// IOFastPath service which controls HID device LEDs.
 ///
 /// The service supports the following sample keys:
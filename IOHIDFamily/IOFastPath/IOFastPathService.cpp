@@ -236,3 +236,13 @@ IOFastPathService::getQueue() const
     assert(_queue);
     return _queue;
 }
+
+IOReturn
+IOFastPathService::enqueueSample(const void * sample, size_t size)
+{
+    IOReturn ret = IOCircularDataQueueEnqueue(getQueue(), sample, size);
+    if (ret == kIOReturnSuccess) {
+        ++_enqueuedCount;
+    }
+    return ret;
+}
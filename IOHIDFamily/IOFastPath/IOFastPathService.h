@@ -140,11 +140,29 @@ protected:
     /// Get a reference to the service's data queue.
     IOCircularDataQueue * getQueue() const;
 
+    /// Enqueue a sample in the service's data queue.
+    ///
+    /// The queue is shared by every user client of the service, each reader keeping its own
+    /// cursor, so a sample is copied once regardless of the number of readers. Producers should
+    /// use this method rather than enqueuing directly so reader lag can be computed.
+    ///
+    /// @param  sample
+    ///     Sample data, `copyDescriptor()->getSampleSize()` bytes.
+    ///
+    /// @param  size
+    ///     Size of `sample`.
+    ///
+    IOReturn enqueueSample(const void * sample, size_t size);
+
+    /// Number of samples successfully enqueued since the service started.
+    UInt64 getEnqueuedCount() const { return _enqueuedCount; }
+
 private:
 
     OSPtr<IOFastPathDescriptor> _descriptor;
     IOCircularDataQueue * _queue;
     OSPtr<OSSet> _clients;
+    UInt64 _enqueuedCount;
 };
 
 
@@ -15,6 +15,7 @@
 #include "IOFastPathService.h"
 #include <IOKit/IOKitKeys.h>
 #include <IOKit/IOCommandGate.h>
+#include <IOKit/IOBufferMemoryDescriptor.h>
 #include <AssertMacros.h>
 
 OSDefineMetaClassAndStructors(IOFastPathUserClient, IOUserClient2022);
@@ -44,6 +45,20 @@ IOFastPathUserClient::start(IOService * provider)
     ok = setProperty(kIOUserClientEntitlementsKey, kOSBooleanFalse);
     assert(ok);
 
+    if (_service->isProducer()) {
+        OSSharedPtr<OSSerializer> serializer = nullptr;
+
+        _readerState = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, kIODirectionInOut | kIOMemoryKernelUserShared, sizeof(IOFastPathReaderState), page_size);
+        require_action(_readerState, exit, ok = false);
+        bzero(_readerState->getBytesNoCopy(), _readerState->getLength());
+
+        serializer = OSSerializer::forTarget(this, OSMemberFunctionCast(OSSerializerCallback, this, &IOFastPathUserClient::serializeReaderStatistics));
+        require_action(serializer, exit, ok = false);
+
+        ok = setProperty("ReaderStatistics", serializer.get());
+        assert(ok);
+    }
+
     ok = provider->open(this);
     require(ok, exit);
 
@@ -90,11 +105,52 @@ IOFastPathUserClient::clientMemoryForType(UInt32 type, IOOptionBits * options, I
 IOReturn
 IOFastPathUserClient::clientMemoryForTypeGated(UInt32 type, IOOptionBits * options, IOMemoryDescriptor ** memory)
 {
-    *memory = IOCircularDataQueueCopyMemoryDescriptor(_service->getQueue());
-    if (_service->isProducer()) {
-        *options = kIOMapReadOnly; // enforce read-only mapping
+    IOReturn ret = kIOReturnSuccess;
+
+    switch (type) {
+        case kIOFastPathUserClientMemoryTypeReaderState:
+            require_action_quiet(_readerState, exit, ret = kIOReturnUnsupported);
+            _readerState->retain();
+            *memory = _readerState.get();
+            break;
+        default:
+            *memory = IOCircularDataQueueCopyMemoryDescriptor(_service->getQueue());
+            if (_service->isProducer()) {
+                *options = kIOMapReadOnly; // enforce read-only mapping
+            }
+            break;
     }
-    return kIOReturnSuccess;
+
+exit:
+    return ret;
+}
+
+bool
+IOFastPathUserClient::serializeReaderStatistics(void * ref __unused, OSSerialize * serializer)
+{
+    OSSharedPtr<OSDictionary> dict = OSDictionary::withCapacity(4);
+    const volatile IOFastPathReaderState * state = (const volatile IOFastPathReaderState *)_readerState->getBytesNoCopy();
+    UInt64 enqueued = _service->getEnqueuedCount();
+    UInt64 readCount = state->readCount;
+    UInt64 lastSampleID = state->lastSampleID;
+    UInt64 lag = enqueued;
+
+    require_quiet(dict, exit);
+
+    // sample IDs start at 0, so the last enqueued sample has ID enqueued - 1
+    if (readCount) {
+        lag = (enqueued > lastSampleID + 1) ? enqueued - (lastSampleID + 1) : 0;
+    }
+
+    dict->setObject("EnqueuedCount", OSNumber::withNumber(enqueued, 64));
+    dict->setObject("ReadCount", OSNumber::withNumber(readCount, 64));
+    dict->setObject("Lag", OSNumber::withNumber(lag, 64));
+    dict->setObject("OverrunCount", OSNumber::withNumber(state->overrunCount, 64));
+
+    return dict->serialize(serializer);
+
+exit:
+    return false;
 }
 
 IOReturn
@@ -17,9 +17,36 @@
 #include <IOKit/IOEventSource.h>
 
 class IOFastPathService;
+class IOBufferMemoryDescriptor;
+
+/// Memory types mapped by `IOFastPathUserClient::clientMemoryForType`.
+///
+enum {
+    kIOFastPathUserClientMemoryTypeQueue        = 0, ///< service data queue, shared by all clients
+    kIOFastPathUserClientMemoryTypeReaderState  = 1, ///< per-client `IOFastPathReaderState`
+};
+
+/// Reader state shared between a consumer of a producer service and its user client.
+///
+/// The reader updates these fields as it dequeues samples. The kernel only reads them, to publish
+/// per-reader lag and overrun statistics under `ReaderStatistics`. Lag assumes sample IDs count
+/// the samples enqueued, which producers keep by only advancing the ID on a successful enqueue.
+///
+/// The reader is the client side of the queue, outside this project (the IOFastPath client
+/// library, or any process mapping `kIOFastPathUserClientMemoryTypeQueue` directly). A reader which
+/// never maps this page leaves `readCount` at 0, and its lag is reported as the enqueued count.
+///
+struct IOFastPathReaderState {
+    UInt64 lastSampleID;    ///< value of `kIOFastPathFieldKeySampleID` of the last sample read
+    UInt64 readCount;       ///< number of samples read
+    UInt64 overrunCount;    ///< number of dequeues which reported `kIOReturnOverrun`
+};
 
 /// Simple user client for accessing an `IOFastPathService`.
 ///
+/// Every user client of a service maps the same data queue, so adding readers does not add copies
+/// in the producer. Each reader keeps its own read cursor within the queue.
+///
 class IOFastPathUserClient : public IOUserClient2022
 {
     OSDeclareDefaultStructors(IOFastPathUserClient);
@@ -55,8 +82,11 @@ private:
     ///
     IOReturn dispatchWorkloopSync(IOEventSource::ActionBlock action);
 
+    bool serializeReaderStatistics(void * ref, OSSerialize * serializer);
+
     OSPtr<IOFastPathService> _service;
     OSPtr<IOCommandGate> _gate;
+    OSPtr<IOBufferMemoryDescriptor> _readerState;
 };
 
 #endif /* IO_FASTPATH_USERCLIENT_H */
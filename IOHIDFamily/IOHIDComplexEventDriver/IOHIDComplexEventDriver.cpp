@@ -39,6 +39,7 @@ IOHIDComplexEventDriver::handleStart(IOService * provider)
     bool success = false;
     IOReturn ret;
     OSSharedPtr<OSArray> eventTypes = NULL;
+    OSSharedPtr<OSSerializer> debugSerializer = NULL;
 
     started = super::handleStart(provider);
     require_action_quiet(started, exit, HIDServiceLogError("handleStart: super::handleStart failed"));
@@ -56,6 +57,12 @@ IOHIDComplexEventDriver::handleStart(IOService * provider)
     ok = setProperty("ElementProcessors", _rootProcessor.get());
     require_action_quiet(ok, exit, HIDServiceLogError("handleStart: set ElementProcessors property failed"));
 
+    initReportPlans();
+
+    debugSerializer = OSSerializer::forTarget(this, OSMemberFunctionCast(OSSerializerCallback, this, &IOHIDComplexEventDriver::serializeDebugState));
+    require_action_quiet(debugSerializer, exit, HIDServiceLogError("handleStart: failed to create DebugState serializer"));
+    setProperty("DebugState", debugSerializer.get());
+
     _workloop = OSSharedPtr<IOWorkLoop>(getWorkLoop(), OSRetain);
     assert(_workloop);
 
@@ -80,6 +87,10 @@ IOHIDComplexEventDriver::free()
     if (_workloop && _gate) {
         _workloop->removeEventSource(_gate.get());
     }
+    if (_planEvents) {
+        IODelete(_planEvents, IOHIDEvent *, _planEventsCount);
+        _planEvents = nullptr;
+    }
 }
 
 bool
@@ -183,12 +194,68 @@ void
 IOHIDComplexEventDriver::handleInterruptReport(AbsoluteTime timestamp, IOMemoryDescriptor * report __unused, IOHIDReportType type, UInt32 reportID)
 {
     if (readyForReports() && type == kIOHIDReportTypeInput) {
-        IOHID_DEBUG(kIOHIDDebugCode_CmplxEvtDrv_InterruptReport, timestamp, reportID, 0, 0);
-        OSSharedPtr<IOHIDEvent> event = _rootProcessor->processInput(timestamp, reportID);
-        if (event) {
-            dispatchEvent(event.get());
+        OSData * plan = _reportPlans[reportID & 0xFF].get();
+        unsigned int visited = plan ? plan->getLength() / sizeof(IOHIDElementProcessor::PlanEntry) : 0;
+
+        IOHID_DEBUG(kIOHIDDebugCode_CmplxEvtDrv_InterruptReport, timestamp, reportID, visited, 0);
+
+        ++_reportCount;
+        _processorsVisited += visited;
+
+        if (visited) {
+            OSSharedPtr<IOHIDEvent> event = IOHIDElementProcessor::processPlan(plan, _planEvents, timestamp);
+            if (event) {
+                dispatchEvent(event.get());
+            }
+        }
+    }
+}
+
+void
+IOHIDComplexEventDriver::initReportPlans()
+{
+    unsigned int maxCount = 0;
+
+    for (unsigned int reportID = 0; reportID < sizeof(_reportPlans)/sizeof(_reportPlans[0]); ++reportID) {
+        if (!_rootProcessor->handlesReport(reportID)) {
+            continue;
+        }
+
+        OSSharedPtr<OSData> plan = OSData::withCapacity(_processors->getCount() * sizeof(IOHIDElementProcessor::PlanEntry));
+        assert(plan);
+
+        _rootProcessor->appendToPlan(plan.get(), reportID);
+
+        unsigned int count = plan->getLength() / sizeof(IOHIDElementProcessor::PlanEntry);
+        if (count > maxCount) {
+            maxCount = count;
         }
+
+        HIDServiceLogDebug("initReportPlans: report:%u processors:%u", reportID, count);
+        _reportPlans[reportID] = plan;
     }
+
+    if (maxCount) {
+        _planEvents = IONew(IOHIDEvent *, maxCount);
+        assert(_planEvents);
+        _planEventsCount = maxCount;
+    }
+}
+
+bool
+IOHIDComplexEventDriver::serializeDebugState(void * ref __unused, OSSerialize * serializer)
+{
+    bool ok = false;
+    OSSharedPtr<OSDictionary> dict = OSDictionary::withCapacity(2);
+    require_quiet(dict, exit);
+
+    dict->setObject("ReportCount", OSNumber::withNumber(_reportCount, 64));
+    dict->setObject("ProcessorsVisited", OSNumber::withNumber(_processorsVisited, 64));
+
+    ok = dict->serialize(serializer);
+
+exit:
+    return ok;
 }
 
 void
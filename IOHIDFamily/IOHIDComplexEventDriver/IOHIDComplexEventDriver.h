@@ -86,6 +86,13 @@ private:
     unsigned int createProcessors(IOHIDElement * collection, IOHIDElementProcessor * parent = nullptr);
     unsigned int createRootProcessor(IOHIDElement * collection);
 
+    /// Flatten the processor tree into one plan per report ID, listing only the processors which
+    /// produce an event for that report. Called once the tree is built.
+    ///
+    void initReportPlans();
+
+    bool serializeDebugState(void * ref, OSSerialize * serializer);
+
     // control properties
     bool isValidProcessorPropertyRequest(OSObject * object);
     void handleSetProcessorPropertyGated(OSObject * object);
@@ -100,4 +107,10 @@ private:
 
     OSPtr<IOHIDElementProcessor> _rootProcessor; ///< root collection element processor
     OSPtr<OSArray> _processors; ///< list of all element processors
+    OSPtr<OSData> _reportPlans[256]; ///< flattened processors indexed by report ID
+    IOHIDEvent ** _planEvents; ///< scratch events for running a plan
+    unsigned int _planEventsCount; ///< capacity of `_planEvents`
+
+    uint64_t _reportCount; ///< input reports handled
+    uint64_t _processorsVisited; ///< processors run across all handled reports
 };
@@ -21,6 +21,7 @@
 #include <IOKit/IOLib.h>
 #include <libkern/c++/OSDictionary.h>
 #include <libkern/c++/OSArray.h>
+#include <libkern/c++/OSData.h>
 #include <libkern/c++/OSNumber.h>
 #include <libkern/c++/OSString.h>
 #include <AssertMacros.h>
@@ -86,6 +87,73 @@ IOHIDElementProcessor::processInput(uint64_t timestamp, uint8_t reportID)
     return event;
 }
 
+bool
+IOHIDElementProcessor::handlesReport(uint8_t reportID) const
+{
+    bool handles = (getReportID() == reportID);
+
+    if (!handles && _children) {
+        for (unsigned int i = 0; i < _children->getCount(); ++i) {
+            IOHIDElementProcessor * child = OSRequiredCast(IOHIDElementProcessor, _children->getObject(i));
+            if (child->handlesReport(reportID)) {
+                handles = true;
+                break;
+            }
+        }
+    }
+
+    return handles;
+}
+
+void
+IOHIDElementProcessor::appendToPlan(OSData * plan, uint8_t reportID, unsigned int parent)
+{
+    bool ok = false;
+    unsigned int index = plan->getLength() / sizeof(PlanEntry);
+    PlanEntry entry = { this, parent };
+
+    require_quiet(handlesReport(reportID), exit);
+
+    ok = plan->appendBytes(&entry, sizeof(entry));
+    assert(ok);
+
+    if (_children) {
+        for (unsigned int i = 0; i < _children->getCount(); ++i) {
+            IOHIDElementProcessor * child = OSRequiredCast(IOHIDElementProcessor, _children->getObject(i));
+            child->appendToPlan(plan, reportID, index);
+        }
+    }
+
+exit:
+    return;
+}
+
+OSSharedPtr<IOHIDEvent>
+IOHIDElementProcessor::processPlan(OSData * plan, IOHIDEvent ** events, uint64_t timestamp)
+{
+    const PlanEntry * entries = (const PlanEntry *)plan->getBytesNoCopy();
+    unsigned int count = plan->getLength() / sizeof(PlanEntry);
+
+    if (count == 0) {
+        return NULL;
+    }
+
+    // Children follow their parent in the plan, so walk it backwards to create child events before
+    // their parent's as processInput does, then attach them front to back to keep sibling order.
+    for (unsigned int i = count; i-- > 0;) {
+        OSSharedPtr<IOHIDEvent> event = entries[i].processor->createEvent(timestamp);
+        assert(event);
+        events[i] = event.detach();
+    }
+
+    for (unsigned int i = 1; i < count; ++i) {
+        events[entries[i].parent]->appendChild(events[i]);
+        OSSafeReleaseNULL(events[i]);
+    }
+
+    return OSSharedPtr<IOHIDEvent>(events[0], OSNoRetain);
+}
+
 void
 IOHIDElementProcessor::setProperty(OSString * key, OSObject * val)
 {
@@ -192,6 +260,151 @@ IOHIDElementProcessor::copyElement(OSArray * elements, IOHIDElementType type, ui
 }
 
 
+#pragma mark - IOHIDAxisDecoder
+
+OSDefineMetaClassAndStructors(IOHIDAxisDecoder, OSObject);
+
+OSSharedPtr<IOHIDAxisDecoder>
+IOHIDAxisDecoder::create(OSArray * x, OSArray * y, OSArray * z, uint32_t unit, IOFixed unitScale)
+{
+    OSSharedPtr<IOHIDAxisDecoder> me = OSMakeShared<IOHIDAxisDecoder>();
+    assert(me);
+
+    bool ok = me->init(x, y, z, unit, unitScale);
+    if (!ok) {
+        me.reset();
+    }
+    return me;
+}
+
+bool
+IOHIDAxisDecoder::init(OSArray * x, OSArray * y, OSArray * z, uint32_t unit, IOFixed unitScale)
+{
+    bool success = false;
+    unsigned int count = 0;
+
+    require_quiet(super::init(), exit);
+
+    _sampleCount = x->getCount();
+    require_quiet(_sampleCount > 0 && _sampleCount == y->getCount() && _sampleCount == z->getCount(), exit);
+
+    count = _sampleCount * 3;
+    _elements = OSArray::withCapacity(count);
+    _scales = IONew(AxisScale, count);
+    _raw = IONew(SInt32, count);
+    _values = IONew(IOFixed, count);
+    require_quiet(_elements && _scales && _raw && _values, exit);
+
+    for (unsigned int i = 0; i < _sampleCount; ++i) {
+        OSArray * axes[] = { x, y, z };
+        for (unsigned int axis = 0; axis < 3; ++axis) {
+            IOHIDElement * element = OSRequiredCast(IOHIDElement, axes[axis]->getObject(i));
+            initScale(&_scales[_elements->getCount()], element, unit, unitScale);
+            _elements->setObject(element);
+        }
+    }
+
+    success = true;
+
+exit:
+    return success;
+}
+
+void
+IOHIDAxisDecoder::initScale(AxisScale * scale, IOHIDElement * element, uint32_t unit, IOFixed unitScale)
+{
+    SInt64 logicalMin   = (SInt32)element->getLogicalMin();
+    SInt64 logicalMax   = (SInt32)element->getLogicalMax();
+    SInt64 physicalMin  = (SInt32)element->getPhysicalMin();
+    SInt64 physicalMax  = (SInt32)element->getPhysicalMax();
+    int resExponent     = element->getUnitExponent() & 0x0F;
+    UInt32 numExp       = 1;
+    UInt32 denomExp     = 1;
+    UInt64 magnitude;
+    unsigned int shift;
+
+    // Same constants as IOHIDElementPrivate::getScaledFixedValue(kIOHIDValueScaleTypeExponent).
+    if (resExponent < 8) {
+        for (int i = resExponent; i > 0; i--) {
+            numExp *= 10;
+        }
+    } else {
+        for (int i = 0x10 - resExponent; i > 0; i--) {
+            denomExp *= 10;
+        }
+    }
+
+    scale->logicalMin   = logicalMin;
+    scale->logicalRange = (logicalMax - logicalMin) ? (logicalMax - logicalMin) : 1;
+    scale->rangeFactor  = (((physicalMax - physicalMin) << 16) / denomExp) * numExp;
+    scale->rangeOffset  = ((physicalMin << 16) / denomExp) * numExp;
+    scale->multiplier   = 0;
+    scale->shift        = 0;
+    scale->unitScale    = (unitScale && element->getUnit() == unit) ? unitScale : 0;
+
+    // Rounding the multiplier up, with more fraction bits than twice the logical range has bits,
+    // overshoots inValue * |rangeFactor| / logicalRange by less than 1 / logicalRange for any
+    // inValue in [0, logicalRange]. That never reaches the next integer, so the shifted product
+    // truncates to the quotient the division gives.
+    magnitude = (UInt64)(scale->rangeFactor < 0 ? -scale->rangeFactor : scale->rangeFactor);
+    if (logicalMax <= logicalMin || !magnitude) {
+        return;
+    }
+    shift = 2 * (64 - __builtin_clzll((UInt64)scale->logicalRange));
+    if (shift + (64 - __builtin_clzll(magnitude)) > 62) {
+        return;
+    }
+    scale->multiplier = ((magnitude << shift) + (UInt64)scale->logicalRange - 1) / (UInt64)scale->logicalRange;
+    scale->shift = shift;
+}
+
+const IOFixed *
+IOHIDAxisDecoder::decode()
+{
+    const unsigned int count = _sampleCount * 3;
+
+    // Gather all raw values first so the scaling loop below runs over contiguous buffers.
+    for (unsigned int i = 0; i < count; ++i) {
+        _raw[i] = (SInt32)OSRequiredCast(IOHIDElement, _elements->getObject(i))->getValue();
+    }
+
+    for (unsigned int i = 0; i < count; ++i) {
+        const AxisScale * scale = &_scales[i];
+        SInt64 inValue = _raw[i] - scale->logicalMin;
+        SInt64 quotient;
+        IOFixed value;
+
+        if (scale->multiplier && inValue >= 0 && inValue <= scale->logicalRange) {
+            quotient = (SInt64)(((UInt64)inValue * scale->multiplier) >> scale->shift);
+            value = (IOFixed)((scale->rangeFactor < 0 ? -quotient : quotient) + scale->rangeOffset);
+        } else {
+            value = (IOFixed)(((inValue * scale->rangeFactor) / scale->logicalRange) + scale->rangeOffset);
+        }
+
+        _values[i] = scale->unitScale ? IOFixedMultiply(value, scale->unitScale) : value;
+    }
+
+    return _values;
+}
+
+void
+IOHIDAxisDecoder::free()
+{
+    const unsigned int count = _sampleCount * 3;
+
+    if (_scales) {
+        IODelete(_scales, AxisScale, count);
+    }
+    if (_raw) {
+        IODelete(_raw, SInt32, count);
+    }
+    if (_values) {
+        IODelete(_values, IOFixed, count);
+    }
+    super::free();
+}
+
+
 #pragma mark - IOHIDRootElementProcessor
 
 OSDefineMetaClassAndStructors(IOHIDRootElementProcessor, IOHIDElementProcessor);
@@ -325,6 +538,10 @@ IOHIDAccelElementProcessor::init(IOService * owner, IOHIDElement * collection)
 
     _sampleInterval = copyElement(children, kIOHIDElementTypeFeature, kHIDPage_Sensor, kHIDUsage_Snsr_Property_SamplingRate);
 
+    // convert HID acceleration units to G's
+    _decoder = IOHIDAxisDecoder::create(_x.get(), _y.get(), _z.get(), HID_UNIT_ACCELERATION, CAST_DOUBLE_TO_FIXED(981));
+    require_action_quiet(_decoder, exit, HIDElementProcessorLogError("failed to create axis decoder"));
+
     success = super::init(owner, reportID, kIOHIDEventTypeAccelerometer, kHIDPage_Sensor, kHIDUsage_Snsr_Motion_Accelerometer3D);
     if (success) {
         bool ok = owner->setProperty("SupportsAccelEvents", kOSBooleanTrue);
@@ -363,13 +580,14 @@ OSSharedPtr<IOHIDEvent>
 IOHIDAccelElementProcessor::createEvent(uint64_t timestamp)
 {
     OSSharedPtr<IOHIDEvent> event = nullptr;
-    const unsigned int sampleCount = _x->getCount();
+    const unsigned int sampleCount = _decoder->getSampleCount();
+    const IOFixed * values = _decoder->decode();
 
     event = OSSharedPtr<IOHIDEvent>(IOHIDEvent::collectionEvent(timestamp, getUsagePage(), getUsage(), false), OSNoRetain);
     assert(event);
 
     for (unsigned int i = 0; i < sampleCount; ++i) {
-        OSSharedPtr<IOHIDEvent> subevent = eventForSample(timestamp, i);
+        OSSharedPtr<IOHIDEvent> subevent = eventForSample(timestamp, i, values);
         assert(subevent);
 
         event->appendChild(subevent.get());
@@ -379,11 +597,11 @@ IOHIDAccelElementProcessor::createEvent(uint64_t timestamp)
 }
 
 OSSharedPtr<IOHIDEvent>
-IOHIDAccelElementProcessor::eventForSample(uint64_t timestamp, unsigned int i) const
+IOHIDAccelElementProcessor::eventForSample(uint64_t timestamp, unsigned int i, const IOFixed * values) const
 {
-    IOFixed x = getXAcceleration(i);
-    IOFixed y = getYAcceleration(i);
-    IOFixed z = getZAcceleration(i);
+    IOFixed x = values[3 * i];
+    IOFixed y = values[3 * i + 1];
+    IOFixed z = values[3 * i + 2];
     OSData * ts = OSRequiredCast(IOHIDElement, _ts->getObject(i))->getDataValue();
 
     IOHIDEvent * event = IOHIDEvent::accelerometerEvent(timestamp, x, y, z);
@@ -398,35 +616,6 @@ IOHIDAccelElementProcessor::eventForSample(uint64_t timestamp, unsigned int i) c
     return OSSharedPtr<IOHIDEvent>(event, OSNoRetain);
 }
 
-IOFixed
-IOHIDAccelElementProcessor::getXAcceleration(unsigned int i) const
-{
-    return getAccelerationValue(OSRequiredCast(IOHIDElement, _x->getObject(i)));
-}
-
-IOFixed
-IOHIDAccelElementProcessor::getYAcceleration(unsigned int i) const
-{
-    return getAccelerationValue(OSRequiredCast(IOHIDElement, _y->getObject(i)));
-}
-
-IOFixed
-IOHIDAccelElementProcessor::getZAcceleration(unsigned int i) const
-{
-    return getAccelerationValue(OSRequiredCast(IOHIDElement, _z->getObject(i)));
-}
-
-IOFixed
-IOHIDAccelElementProcessor::getAccelerationValue(IOHIDElement * element)
-{
-    IOFixed value = element->getScaledFixedValue(kIOHIDValueScaleTypeExponent);
-    if (element->getUnit() == HID_UNIT_ACCELERATION) {
-        // convert HID acceleration units to G's
-        value = IOFixedMultiply(value, CAST_DOUBLE_TO_FIXED(981));
-    }
-    return value;
-}
-
 
 #pragma mark - IOHIDGyroElementProcessor
 
@@ -514,6 +703,9 @@ IOHIDGyroElementProcessor::init(IOService * owner, IOHIDElement * collection)
 
     _sampleInterval = copyElement(children, kIOHIDElementTypeFeature, kHIDPage_Sensor, kHIDUsage_Snsr_Property_SamplingRate);
 
+    _decoder = IOHIDAxisDecoder::create(_x.get(), _y.get(), _z.get());
+    require_action_quiet(_decoder, exit, HIDElementProcessorLogError("failed to create axis decoder"));
+
     success = super::init(owner, reportID, kIOHIDEventTypeGyro, kHIDPage_Sensor, kHIDUsage_Snsr_Motion_Gyrometer3D);
     if (success) {
         bool ok = owner->setProperty("SupportsGyroEvents", kOSBooleanTrue);
@@ -552,13 +744,14 @@ OSSharedPtr<IOHIDEvent>
 IOHIDGyroElementProcessor::createEvent(uint64_t timestamp)
 {
     OSSharedPtr<IOHIDEvent> event = nullptr;
-    const unsigned int sampleCount = _x->getCount();
+    const unsigned int sampleCount = _decoder->getSampleCount();
+    const IOFixed * values = _decoder->decode();
 
     event = OSSharedPtr<IOHIDEvent>(IOHIDEvent::collectionEvent(timestamp, getUsagePage(), getUsage(), false), OSNoRetain);
     assert(event);
 
     for (unsigned int i = 0; i < sampleCount; ++i) {
-        OSSharedPtr<IOHIDEvent> subevent = eventForSample(timestamp, i);
+        OSSharedPtr<IOHIDEvent> subevent = eventForSample(timestamp, i, values);
         assert(subevent);
 
         event->appendChild(subevent.get());
@@ -568,11 +761,11 @@ IOHIDGyroElementProcessor::createEvent(uint64_t timestamp)
 }
 
 OSSharedPtr<IOHIDEvent>
-IOHIDGyroElementProcessor::eventForSample(uint64_t timestamp, unsigned int i) const
+IOHIDGyroElementProcessor::eventForSample(uint64_t timestamp, unsigned int i, const IOFixed * values) const
 {
-    IOFixed x = getXAngularVelocity(i);
-    IOFixed y = getYAngularVelocity(i);
-    IOFixed z = getZAngularVelocity(i);
+    IOFixed x = values[3 * i];
+    IOFixed y = values[3 * i + 1];
+    IOFixed z = values[3 * i + 2];
     OSData * ts = OSRequiredCast(IOHIDElement, _ts->getObject(i))->getDataValue();
 
     IOHIDEvent * event = IOHIDEvent::gyroEvent(timestamp, x, y, z);
@@ -587,30 +780,6 @@ IOHIDGyroElementProcessor::eventForSample(uint64_t timestamp, unsigned int i) co
     return OSSharedPtr<IOHIDEvent>(event, OSNoRetain);
 }
 
-IOFixed
-IOHIDGyroElementProcessor::getXAngularVelocity(unsigned int i) const
-{
-    return getAngularVelocityValue(OSRequiredCast(IOHIDElement, _x->getObject(i)));
-}
-
-IOFixed
-IOHIDGyroElementProcessor::getYAngularVelocity(unsigned int i) const
-{
-    return getAngularVelocityValue(OSRequiredCast(IOHIDElement, _y->getObject(i)));
-}
-
-IOFixed
-IOHIDGyroElementProcessor::getZAngularVelocity(unsigned int i) const
-{
-    return getAngularVelocityValue(OSRequiredCast(IOHIDElement, _z->getObject(i)));
-}
-
-IOFixed
-IOHIDGyroElementProcessor::getAngularVelocityValue(IOHIDElement * element)
-{
-    return element->getScaledFixedValue(kIOHIDValueScaleTypeExponent);
-}
-
 
 #pragma mark - IOHIDThumbstickElementProcessor
 
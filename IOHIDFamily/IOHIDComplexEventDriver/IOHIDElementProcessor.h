@@ -95,6 +95,58 @@ public:
     /// Set the processor's cookie.
     void setCookie(uint32_t cookie) { _cookie = cookie; }
 
+    /// Entry in a flattened processor plan.
+    ///
+    /// A plan lists, in pre-order, the processors of a tree which produce an event for a given
+    /// report ID. `parent` is the index of the entry's parent in the same plan, or `kNoParent` for
+    /// the first entry.
+    ///
+    struct PlanEntry {
+        IOHIDElementProcessor * processor;
+        unsigned int parent;
+    };
+
+    static constexpr unsigned int kNoParent = ~0u;
+
+    /// Check whether this processor, or any of its descendants, produces an event for a report.
+    ///
+    /// @param  reportID
+    ///     ID of the report.
+    ///
+    bool handlesReport(uint8_t reportID) const;
+
+    /// Append the processors of this subtree which produce an event for a report to a plan.
+    ///
+    /// Processors not producing an event for `reportID` are skipped along with their subtrees, so
+    /// running the plan gives the same result as `processInput` without visiting them.
+    ///
+    /// @param  plan
+    ///     Array of `PlanEntry` to append to.
+    ///
+    /// @param  reportID
+    ///     ID of the report.
+    ///
+    /// @param  parent
+    ///     Index of this processor's parent in `plan`.
+    ///
+    void appendToPlan(OSData * plan, uint8_t reportID, unsigned int parent = kNoParent);
+
+    /// Run a plan built by `appendToPlan`.
+    ///
+    /// @param  plan
+    ///     Array of `PlanEntry`.
+    ///
+    /// @param  events
+    ///     Scratch space for at least as many events as there are entries in `plan`.
+    ///
+    /// @param  timestamp
+    ///     Timestamp of the input report being processed.
+    ///
+    /// @return
+    ///     HID event produced by the first processor in the plan, or `NULL` if the plan is empty.
+    ///
+    static OSPtr<IOHIDEvent> processPlan(OSData * plan, IOHIDEvent ** events, uint64_t timestamp);
+
 protected:
 
     /// Create a new HID event from the generator's elements.
@@ -133,6 +185,68 @@ private:
 };
 
 
+/// `IOHIDAxisDecoder` extracts and scales the (x, y, z) axis elements of every sample in a report in
+/// one pass.
+///
+/// Scaling matches `IOHIDElement::getScaledFixedValue(kIOHIDValueScaleTypeExponent)` exactly, but
+/// uses a fixed-point reciprocal precomputed per element instead of a division per value. Values
+/// outside the logical range, and ranges too wide for the reciprocal, use the scalar formula.
+///
+class IOHIDAxisDecoder : public OSObject
+{
+    OSDeclareDefaultStructors(IOHIDAxisDecoder);
+    using super = OSObject;
+
+public:
+
+    /// Create a decoder for samples made of one element from each array.
+    ///
+    /// @param  x, y, z
+    ///     Arrays of `IOHIDElement`, one element per sample. All arrays must have the same count.
+    ///
+    /// @param  unit
+    ///     HID unit of elements which should be multiplied by `unitScale` after scaling.
+    ///
+    /// @param  unitScale
+    ///     Multiplier for elements with `unit`, or 0 for none.
+    ///
+    static OSPtr<IOHIDAxisDecoder> create(OSArray * x, OSArray * y, OSArray * z, uint32_t unit = 0, IOFixed unitScale = 0);
+
+    /// Decode the current value of every axis element.
+    ///
+    /// @return
+    ///     `3 * getSampleCount()` values ordered x0, y0, z0, x1, ... Valid until the next call.
+    ///
+    const IOFixed * decode();
+
+    unsigned int getSampleCount() const { return _sampleCount; }
+
+    /// See OSObject.h
+    virtual void free() APPLE_KEXT_OVERRIDE;
+
+private:
+
+    struct AxisScale {
+        SInt64 logicalMin;
+        SInt64 logicalRange;
+        SInt64 rangeFactor;
+        SInt64 rangeOffset;
+        UInt64 multiplier; ///< |rangeFactor| / logicalRange rounded up, 0 if unavailable
+        unsigned int shift; ///< fraction bits of multiplier
+        IOFixed unitScale;
+    };
+
+    bool init(OSArray * x, OSArray * y, OSArray * z, uint32_t unit, IOFixed unitScale);
+    static void initScale(AxisScale * scale, IOHIDElement * element, uint32_t unit, IOFixed unitScale);
+
+    OSPtr<OSArray> _elements; ///< axis elements ordered x0, y0, z0, x1, ...
+    AxisScale * _scales;
+    SInt32 * _raw;
+    IOFixed * _values;
+    unsigned int _sampleCount;
+};
+
+
 class IOHIDRootElementProcessor : public IOHIDElementProcessor
 {
     OSDeclareDefaultStructors(IOHIDRootElementProcessor);
@@ -164,17 +278,13 @@ public:
 private:
 
     bool init(IOService * owner, IOHIDElement * collection);
-    OSPtr<IOHIDEvent> eventForSample(uint64_t timestamp, unsigned int i) const;
-    IOFixed getXAcceleration(unsigned int i) const;
-    IOFixed getYAcceleration(unsigned int i) const;
-    IOFixed getZAcceleration(unsigned int i) const;
-
-    static IOFixed getAccelerationValue(IOHIDElement * element);
+    OSPtr<IOHIDEvent> eventForSample(uint64_t timestamp, unsigned int i, const IOFixed * values) const;
 
     OSPtr<OSArray> _x;
     OSPtr<OSArray> _y;
     OSPtr<OSArray> _z;
     OSPtr<OSArray> _ts;
+    OSPtr<IOHIDAxisDecoder> _decoder;
     OSPtr<IOHIDElement> _reportInterval;
     OSPtr<IOHIDElement> _sampleInterval;
 };
@@ -194,17 +304,13 @@ public:
 private:
 
     bool init(IOService * owner, IOHIDElement * collection);
-    OSPtr<IOHIDEvent> eventForSample(uint64_t timestamp, unsigned int i) const;
-    IOFixed getXAngularVelocity(unsigned int i) const;
-    IOFixed getYAngularVelocity(unsigned int i) const;
-    IOFixed getZAngularVelocity(unsigned int i) const;
-
-    static IOFixed getAngularVelocityValue(IOHIDElement * element);
+    OSPtr<IOHIDEvent> eventForSample(uint64_t timestamp, unsigned int i, const IOFixed * values) const;
 
     OSPtr<OSArray> _x;
     OSPtr<OSArray> _y;
     OSPtr<OSArray> _z;
     OSPtr<OSArray> _ts;
+    OSPtr<IOHIDAxisDecoder> _decoder;
     OSPtr<IOHIDElement> _reportInterval;
     OSPtr<IOHIDElement> _sampleInterval;
 };
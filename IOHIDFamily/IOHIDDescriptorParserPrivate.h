@@ -274,6 +274,15 @@ struct HIDStringItem
 typedef struct HIDStringItem HIDStringItem;
 typedef HIDStringItem HIDDesignatorItem;
 
+struct HIDUsageIndexEntry
+{
+	HIDUsage	usagePage;
+	HIDUsage	usageMinimum;
+	HIDUsage	usageMaximum;
+	UInt32		reportItem;
+};
+typedef struct HIDUsageIndexEntry HIDUsageIndexEntry;
+
 struct HIDPreparsedData
 {
 	UInt32				hidTypeIfValid;
@@ -292,10 +301,164 @@ struct HIDPreparsedData
 	UInt8 *				rawMemPtr;
 	UInt32				flags;
 	IOByteCount			numBytesAllocated;
+	HIDUsageIndexEntry	*usageIndex;		// Usages sorted by usage, then report item
+	UInt32				usageIndexCount;
+	HIDUsageIndexEntry	*usageRangeIndex;	// Usage ranges sorted by report item
+	UInt32				usageRangeIndexCount;
+	UInt32				*usageOffsets;		// Per usage item, first report index it covers
+	IOByteCount			usageIndexBytesAllocated;
 };
 typedef struct HIDPreparsedData HIDPreparsedData;
 typedef HIDPreparsedData * HIDPreparsedDataPtr;
 
+/*------------------------------------------------------------------------------*/
+/*																				*/
+/* HID Descriptor Limits														*/
+/*																				*/
+/* Bounds on what one report descriptor may describe, checked as its items	*/
+/* are counted. A descriptor over any of them fails to open with				*/
+/* kHIDInvalidPreparsedDataErr. HIDOpenReportDescriptor uses the defaults.	*/
+/*																				*/
+/*------------------------------------------------------------------------------*/
+enum
+{
+	kHIDDefaultMaxCollections		= 4096,
+	kHIDDefaultMaxReportItems		= 8192,
+	kHIDDefaultMaxUsages			= 0x40000,
+	kHIDDefaultMaxReportItemBits	= 0x100000,
+	kHIDDefaultMaxNesting			= 32,
+	kHIDMaxNesting					= 64	// maxNesting can not be raised past this
+};
+
+struct HIDDescriptorLimits
+{
+	UInt32		maxCollections;		// Collection items
+	UInt32		maxReportItems;		// Input, Output and Feature items
+	UInt32		maxUsages;			// Usages, counting every usage of a range
+	UInt32		maxReportItemBits;	// Report Count x Report Size of one main item
+	UInt32		maxNesting;			// Collection and Push depth
+};
+typedef struct HIDDescriptorLimits HIDDescriptorLimits;
+
+/*
+ *	What an open descriptor describes, from HIDGetDescriptorStatistics.
+ *	  elementCount bounds the elements IOHIDElementContainer builds for it:
+ *	  collections, per report a null and a report handler element, every
+ *	  usage of every report item, and the handler and duplicates of arrays.
+*/
+struct HIDDescriptorStatistics
+{
+	UInt32		collectionCount;	// Including the virtual collection
+	UInt32		reportItemCount;
+	UInt32		usageItemCount;
+	UInt32		usageCount;			// Usages of the report items, ranges expanded
+	UInt32		reportCount;		// Report IDs, including the default report
+	UInt32		maxCollectionNesting;
+	UInt32		maxReportItemBits;
+	UInt32		elementCount;
+};
+typedef struct HIDDescriptorStatistics HIDDescriptorStatistics;
+
+/*------------------------------------------------------------------------------*/
+/*																				*/
+/* HID Scaled Value Entries														*/
+/*																				*/
+/* One entry per report field of the value capabilities of one report, from		*/
+/* HIDGetScaledValueEntries. HIDGetScaledUsageValues then extracts and scales	*/
+/* every field of a report in one call, using a multiplier worked out here		*/
+/* instead of a divide per value. The multiplier is rounded up and has twice	*/
+/* as many fraction bits as the logical range has bits, which leaves the		*/
+/* truncated quotient exact; ranges too wide for that in 62 bits are divided	*/
+/* instead. Field values and ranges are taken as signed and scaled in 64 bits,	*/
+/* so a negative value in range scales rather than being reported out of		*/
+/* range as HIDScaleUsageValueIn does where a long is 64 bits. Entries are		*/
+/* fields, not usages: where a usage repeats, HIDGetScaledUsageValue may		*/
+/* resolve it to a different field.												*/
+/*																				*/
+/*------------------------------------------------------------------------------*/
+enum
+{
+	kHIDScaledValueSigned			= 0x01,	// Sign extend the field
+	kHIDScaledValueReversed			= 0x02,	// Reversed report item
+	kHIDScaledValueNullState		= 0x04,	// Out of range values are null
+	kHIDScaledValueReportID			= 0x08,	// Report starts with its report ID
+	kHIDScaledValueDivide			= 0x10,	// Range too wide for the multiplier
+	kHIDScaledValueBadRange			= 0x20	// Zero logical or physical range
+};
+
+struct HIDScaledValueEntry
+{
+	HIDUsage	usagePage;
+	HIDUsage	usage;
+	UInt32		collection;
+	UInt32		reportID;
+	UInt32		reportLength;		// Bytes a report needs to hold this field
+	UInt32		startBit;
+	UInt32		bitSize;
+	UInt32		flags;
+	SInt32		logicalMin;
+	SInt32		logicalMax;
+	SInt32		physicalMin;
+	SInt32		physicalMax;
+	uint64_t	multiplier;			// |Physical range| / logical range, rounded up
+	UInt32		shift;				// Fraction bits of the multiplier
+	UInt32		reserved;
+};
+typedef struct HIDScaledValueEntry HIDScaledValueEntry;
+
+/*------------------------------------------------------------------------------*/
+/*																				*/
+/* HID Preparsed Data Image														*/
+/*																				*/
+/* A flat copy of a HIDPreparsedData that can be written out and opened again	*/
+/* in place, e.g. from a read-only mapping. The header is followed by one		*/
+/* table per array, each on an 8 byte boundary and located by its offset from	*/
+/* the start of the image. Offset 0 marks an absent table. Everything is in	*/
+/* the writer's byte order and structure layout; the magic and entry sizes	*/
+/* reject images from a different one.											*/
+/*																				*/
+/*------------------------------------------------------------------------------*/
+enum
+{
+	kHIDPreparsedDataImageMagic		= 0x68696470,	// 'hidp'
+	kHIDPreparsedDataImageVersion	= 1
+};
+
+enum
+{
+	kHIDImageCollections			= 0,
+	kHIDImageReportItems			= 1,
+	kHIDImageReports				= 2,
+	kHIDImageUsageItems				= 3,	// One zeroed spare entry follows
+	kHIDImageStringItems			= 4,	// One zeroed spare entry follows
+	kHIDImageDesigItems				= 5,	// One zeroed spare entry follows
+	kHIDImageUsageIndex				= 6,
+	kHIDImageUsageRangeIndex		= 7,
+	kHIDImageUsageOffsets			= 8,
+	kHIDImageTableCount				= 9
+};
+
+struct HIDPreparsedDataImageTable
+{
+	UInt32		offset;
+	UInt32		count;
+	UInt32		entrySize;
+	UInt32		reserved;
+};
+typedef struct HIDPreparsedDataImageTable HIDPreparsedDataImageTable;
+
+struct HIDPreparsedDataImageHeader
+{
+	UInt32		magic;
+	UInt32		checksum;		// Adler-32 of the image after this field
+	UInt32		version;
+	UInt32		headerSize;
+	UInt32		imageSize;
+	UInt32		flags;			// As passed to HIDOpenReportDescriptor
+	HIDPreparsedDataImageTable	tables[kHIDImageTableCount];
+};
+typedef struct HIDPreparsedDataImageHeader HIDPreparsedDataImageHeader;
+
 
 // Private methods
 extern
@@ -303,6 +466,48 @@ OSStatus
 HIDGetCollectionExtendedNodes ( HIDCollectionExtendedNodePtr	collectionNodes,
                                 UInt32 *			collectionNodesSize,
                                 HIDPreparsedDataRef		preparsedDataRef );
+
+extern
+OSStatus
+HIDOpenReportDescriptorWithLimits ( void *			hidReportDescriptor,
+                                IOByteCount			descriptorLength,
+                                HIDPreparsedDataRef *		preparsedDataRef,
+                                UInt32				flags,
+                                const HIDDescriptorLimits *	limits );
+
+extern
+OSStatus
+HIDGetDescriptorStatistics     ( HIDPreparsedDataRef		preparsedDataRef,
+                                HIDDescriptorStatistics *	statistics );
+
+extern
+OSStatus
+HIDGetScaledValueEntries       ( HIDReportType			reportType,
+                                UInt32				reportID,
+                                HIDScaledValueEntry *		entries,
+                                UInt32 *			entryCount,
+                                HIDPreparsedDataRef		preparsedDataRef );
+
+extern
+OSStatus
+HIDGetScaledUsageValues        ( const HIDScaledValueEntry *	entries,
+                                UInt32				entryCount,
+                                SInt32 *			values,
+                                OSStatus *			statuses,
+                                void *				report,
+                                IOByteCount			reportLength );
+
+extern
+OSStatus
+HIDGetPreparsedDataImage       ( HIDPreparsedDataRef		preparsedDataRef,
+                                void *				image,
+                                IOByteCount *			imageLength );
+
+extern
+OSStatus
+HIDOpenPreparsedDataImage      ( const void *			image,
+                                IOByteCount			imageLength,
+                                HIDPreparsedDataRef *		preparsedDataRef );
 #ifdef __cplusplus
 }
 #endif
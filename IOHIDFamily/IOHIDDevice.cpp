@@ -79,47 +79,79 @@ class IOHIDAsyncReportQueue : public IOEventSource
 {
     OSDeclareDefaultStructors( IOHIDAsyncReportQueue )
 
+    // Entries live in a ring preallocated at creation, each with a buffer
+    // large enough for the device's largest report. Producers fill the slot
+    // after the last pending entry under fQueueLock. checkForWork snapshots
+    // the pending count under the lock and processes those entries without
+    // it, since producers never touch a pending slot.
+    //
+    // The queue stays unbounded: a report larger than the preallocated
+    // buffer gets a buffer of its own, and reports posted while every slot
+    // is pending are allocated individually on fOverflowHead, as all reports
+    // were before the ring. Once the overflow list is in use, new reports
+    // join it until it drains, so reports are handled in the order posted.
     struct AsyncReportEntry {
-        queue_chain_t   chain;
+        queue_chain_t                   chain;
 
         AbsoluteTime                    timeStamp;
-        uint8_t *                       reportData;
-        size_t                          reportLength;
+        IOBufferMemoryDescriptor *      report;
+        IOBufferMemoryDescriptor *      allocatedReport;
         IOHIDReportType                 reportType;
         IOOptionBits                    options;
-        UInt32                          completionTimeout;
         IOHIDCompletion                 completion;
     };
 
-    IOLock *        fQueueLock;
-    queue_head_t    fQueueHead;
+    IOLock *            fQueueLock;
+    AsyncReportEntry *  fEntries;
+    queue_head_t        fOverflowHead;
+    uint32_t            fDepth;
+    uint32_t            fEntrySize;
+    uint32_t            fHead;
+    uint32_t            fCount;
+    uint32_t            fHighWaterMark;
+    uint64_t            fEnqueueCount;
+    uint64_t            fDropCount;
+    uint64_t            fOversizeCount;
+    uint64_t            fOverflowCount;
+    bool                fAborted;
+
+    void completeEntry(AsyncReportEntry * entry, IOReturn status);
 
 public:
-    static IOHIDAsyncReportQueue *withOwner(IOHIDDevice *inOwner);
+    static IOHIDAsyncReportQueue *withOwner(IOHIDDevice *inOwner, uint32_t entrySize, uint32_t depth);
 
-    virtual bool init(IOHIDDevice *owner);
+    virtual bool init(IOHIDDevice *owner, uint32_t entrySize, uint32_t depth);
+
+    virtual void free(void) APPLE_KEXT_OVERRIDE;
 
     virtual bool checkForWork(void) APPLE_KEXT_OVERRIDE;
 
+    virtual void abortPendingReports(void);
+
     virtual IOReturn postReport(AbsoluteTime         timeStamp,
                                 IOMemoryDescriptor * report,
                                 IOHIDReportType      reportType,
                                 IOOptionBits         options,
                                 UInt32               completionTimeout,
                                 IOHIDCompletion *    completion);
+
+    virtual bool serialize(OSSerialize * serializer) const APPLE_KEXT_OVERRIDE;
 };
 
 OSDefineMetaClassAndStructors( IOHIDAsyncReportQueue, IOEventSource )
 
+#define kIOHIDAsyncReportQueueDefaultDepth  32
+#define kIOHIDAsyncReportQueueMaxDepth      1024
+
 //---------------------------------------------------------------------------
-IOHIDAsyncReportQueue *IOHIDAsyncReportQueue::withOwner(IOHIDDevice *inOwner)
+IOHIDAsyncReportQueue *IOHIDAsyncReportQueue::withOwner(IOHIDDevice *inOwner, uint32_t entrySize, uint32_t depth)
 {
     IOHIDAsyncReportQueue *es = NULL;
     bool result = false;
 
     es = OSTypeAlloc( IOHIDAsyncReportQueue );
     if (es) {
-        result = es->init( inOwner/*, inAction*/ );
+        result = es->init( inOwner, entrySize, depth );
 
         if (!result) {
             es->release();
@@ -132,53 +164,144 @@ IOHIDAsyncReportQueue *IOHIDAsyncReportQueue::withOwner(IOHIDDevice *inOwner)
 }
 
 //---------------------------------------------------------------------------
-bool IOHIDAsyncReportQueue::init(IOHIDDevice *owner_I)
+bool IOHIDAsyncReportQueue::init(IOHIDDevice *owner_I, uint32_t entrySize, uint32_t depth)
 {
-    queue_init( &fQueueHead );
+    bool result = false;
+
+    queue_init( &fOverflowHead );
+
+    require(IOEventSource::init(owner_I/*, action*/), exit);
+
     fQueueLock = IOLockAlloc();
-    return IOEventSource::init(owner_I/*, action*/);
+    require(fQueueLock, exit);
+
+    fDepth      = depth;
+    fEntrySize  = entrySize;
+
+    fEntries = IONew(AsyncReportEntry, fDepth);
+    require(fEntries, exit);
+    bzero(fEntries, sizeof(AsyncReportEntry) * fDepth);
+
+    for (uint32_t index = 0; index < fDepth; index++) {
+        fEntries[index].report = IOBufferMemoryDescriptor::withCapacity(fEntrySize, kIODirectionOut);
+        require(fEntries[index].report, exit);
+    }
+
+    result = true;
+
+exit:
+    return result;
 }
 
 //---------------------------------------------------------------------------
-bool IOHIDAsyncReportQueue::checkForWork()
+void IOHIDAsyncReportQueue::free()
 {
-    bool moreToDo = false;
+    if (fEntries && fQueueLock) {
+        abortPendingReports();
+    }
+
+    if (fEntries) {
+        for (uint32_t index = 0; index < fDepth; index++) {
+            OSSafeReleaseNULL(fEntries[index].report);
+        }
+        IODelete(fEntries, AsyncReportEntry, fDepth);
+        fEntries = NULL;
+    }
+
+    if (fQueueLock) {
+        IOLockFree(fQueueLock);
+        fQueueLock = NULL;
+    }
+
+    IOEventSource::free();
+}
+
+//---------------------------------------------------------------------------
+void IOHIDAsyncReportQueue::completeEntry(AsyncReportEntry * entry, IOReturn status)
+{
+    OSSafeReleaseNULL(entry->allocatedReport);
+
+    if (entry->completion.action) {
+        (entry->completion.action)(entry->completion.target, entry->completion.parameter, status, 0);
+    }
+}
+
+//---------------------------------------------------------------------------
+// Called once the queue has been removed from the workloop, so checkForWork
+// can no longer run. Completes every pending report with kIOReturnAborted
+// and refuses any posted afterwards.
+void IOHIDAsyncReportQueue::abortPendingReports()
+{
+    AsyncReportEntry *  entry;
+    uint32_t            head;
+    uint32_t            count;
 
     IOLockLock(fQueueLock);
-    if (!queue_empty(&fQueueHead)) {
+    fAborted = true;
+    head     = fHead;
+    count    = fCount;
+    fHead    = (fHead + count) % fDepth;
+    fCount   = 0;
+    IOLockUnlock(fQueueLock);
 
-        AsyncReportEntry *entry = NULL;
-        queue_remove_first(&fQueueHead, entry, AsyncReportEntry *, chain);
+    for (uint32_t index = 0; index < count; index++) {
+        completeEntry(&fEntries[(head + index) % fDepth], kIOReturnAborted);
+    }
 
-        if (entry) {
-            IOLockUnlock(fQueueLock);
+    IOLockLock(fQueueLock);
+    while (!queue_empty(&fOverflowHead)) {
+        queue_remove_first(&fOverflowHead, entry, AsyncReportEntry *, chain);
+        IOLockUnlock(fQueueLock);
 
-            IOReturn status;
+        completeEntry(entry, kIOReturnAborted);
+        IOFreeType(entry, AsyncReportEntry);
 
-            IOMemoryDescriptor *md = IOMemoryDescriptor::withAddress(entry->reportData, entry->reportLength, kIODirectionOut);
+        IOLockLock(fQueueLock);
+    }
+    IOLockUnlock(fQueueLock);
+}
 
-            if (md) {
-                md->prepare();
+//---------------------------------------------------------------------------
+bool IOHIDAsyncReportQueue::checkForWork()
+{
+    bool                moreToDo = false;
+    AsyncReportEntry *  entry;
+    IOReturn            status;
+    uint32_t            count;
 
-                status = ((IOHIDDevice *)owner)->handleReportWithTime(entry->timeStamp, md, entry->reportType, entry->options);
+    IOLockLock(fQueueLock);
+    count = fCount;
+    IOLockUnlock(fQueueLock);
 
-                md->complete();
+    for (uint32_t index = 0; index < count; index++) {
+        entry = &fEntries[(fHead + index) % fDepth];
 
-                md->release();
+        status = ((IOHIDDevice *)owner)->handleReportWithTime(entry->timeStamp,
+                                                              entry->allocatedReport ? entry->allocatedReport : entry->report,
+                                                              entry->reportType,
+                                                              entry->options);
 
-                if (entry->completion.action) {
-                    (entry->completion.action)(entry->completion.target, entry->completion.parameter, status, 0);
-                }
-            }
+        completeEntry(entry, status);
+    }
 
-            IOFreeData(entry->reportData, entry->reportLength);
-            IOFreeType(entry, AsyncReportEntry);
+    IOLockLock(fQueueLock);
+    fHead   = (fHead + count) % fDepth;
+    fCount -= count;
 
-            IOLockLock(fQueueLock);
-        }
+    // Overflow entries were posted after every entry still in the ring
+    while (!fCount && !queue_empty(&fOverflowHead)) {
+        queue_remove_first(&fOverflowHead, entry, AsyncReportEntry *, chain);
+        IOLockUnlock(fQueueLock);
+
+        status = ((IOHIDDevice *)owner)->handleReportWithTime(entry->timeStamp, entry->allocatedReport, entry->reportType, entry->options);
+
+        completeEntry(entry, status);
+        IOFreeType(entry, AsyncReportEntry);
+
+        IOLockLock(fQueueLock);
     }
 
-    moreToDo = (!queue_empty(&fQueueHead));
+    moreToDo = (fCount != 0 || !queue_empty(&fOverflowHead));
     IOLockUnlock(fQueueLock);
 
     return moreToDo;
@@ -190,40 +313,108 @@ IOReturn IOHIDAsyncReportQueue::postReport(
                                         IOMemoryDescriptor * report,
                                         IOHIDReportType      reportType,
                                         IOOptionBits         options,
-                                        UInt32               completionTimeout,
+                                        UInt32               completionTimeout __unused,
                                         IOHIDCompletion *    completion)
 {
-    AsyncReportEntry *entry;
+    AsyncReportEntry *          entry;
+    IOBufferMemoryDescriptor *  allocatedReport = NULL;
+    IOByteCount                 reportLength = report->getLength();
+    bool                        overflow;
+    IOReturn                    ret = kIOReturnSuccess;
+
+    IOLockLock(fQueueLock);
+
+    require_action(!fAborted, exit, ret = kIOReturnAborted);
+
+    overflow = (fCount == fDepth || !queue_empty(&fOverflowHead));
 
-    entry = IOMallocType(AsyncReportEntry);
-    if (!entry)
-        return kIOReturnError;
+    if (overflow || reportLength > fEntrySize) {
+        allocatedReport = IOBufferMemoryDescriptor::withCapacity(reportLength, kIODirectionOut);
+        require_action(allocatedReport, exit, ret = kIOReturnNoMemory; fDropCount++);
+        allocatedReport->setLength(reportLength);
+        report->readBytes(0, allocatedReport->getBytesNoCopy(), reportLength);
 
-    entry->timeStamp = timeStamp;
+        if (reportLength > fEntrySize) {
+            fOversizeCount++;
+        }
+    }
 
-    entry->reportLength = report->getLength();
-    entry->reportData = (uint8_t *)IOMallocData(entry->reportLength);
+    if (overflow) {
+        entry = IOMallocType(AsyncReportEntry);
+        require_action(entry, exit, ret = kIOReturnNoMemory; fDropCount++);
+        queue_enter(&fOverflowHead, entry, AsyncReportEntry *, chain);
+        fOverflowCount++;
+    } else {
+        entry = &fEntries[(fHead + fCount) % fDepth];
+        fCount++;
+        if (fCount > fHighWaterMark) {
+            fHighWaterMark = fCount;
+        }
 
-    if (entry->reportData) {
-        report->readBytes(0, entry->reportData, entry->reportLength);
+        if (!allocatedReport) {
+            entry->report->setLength(reportLength);
+            report->readBytes(0, entry->report->getBytesNoCopy(), reportLength);
+        }
+    }
 
-        entry->reportType = reportType;
-        entry->options = options;
-        entry->completionTimeout = completionTimeout;
+    entry->timeStamp        = timeStamp;
+    entry->reportType       = reportType;
+    entry->options          = options;
+    entry->completion       = completion ? *completion : (IOHIDCompletion){NULL, NULL, NULL};
+    entry->allocatedReport  = allocatedReport;
+    allocatedReport         = NULL;
 
-        if (completion)
-            entry->completion = *completion;
+    fEnqueueCount++;
 
-        IOLockLock(fQueueLock);
-        queue_enter(&fQueueHead, entry, AsyncReportEntry *, chain);
-        IOLockUnlock(fQueueLock);
+exit:
+    IOLockUnlock(fQueueLock);
 
+    OSSafeReleaseNULL(allocatedReport);
+
+    if (ret == kIOReturnSuccess) {
         signalWorkAvailable();
-    } else {
-        IOFreeType(entry, AsyncReportEntry);
     }
 
-    return kIOReturnSuccess;
+    return ret;
+}
+
+#define SET_DICT_NUM(dict, key, val) do { \
+    if (val) { \
+        OSNumber *num = OSNumber::withNumber(val, 64); \
+        if (num) { \
+            dict->setObject(key, num); \
+            num->release(); \
+        } \
+    } \
+} while (0);
+
+//---------------------------------------------------------------------------
+bool IOHIDAsyncReportQueue::serialize(OSSerialize * serializer) const
+{
+    bool            ret = false;
+    OSDictionary *  dict;
+
+    if (serializer->previouslySerialized(this)) {
+        return true;
+    }
+
+    dict = OSDictionary::withCapacity(8);
+    require(dict, exit);
+
+    SET_DICT_NUM(dict, "Depth", fDepth);
+    SET_DICT_NUM(dict, "EntrySize", fEntrySize);
+    SET_DICT_NUM(dict, "Count", fCount);
+    SET_DICT_NUM(dict, "HighWaterMark", fHighWaterMark);
+    SET_DICT_NUM(dict, "EnqueueCount", fEnqueueCount);
+    SET_DICT_NUM(dict, "DropCount", fDropCount);
+    SET_DICT_NUM(dict, "OversizeCount", fOversizeCount);
+    SET_DICT_NUM(dict, "OverflowCount", fOverflowCount);
+
+    ret = dict->serialize(serializer);
+    dict->release();
+
+exit:
+    return ret;
 }
 
 struct AsyncReportCall {
@@ -374,6 +565,7 @@ void IOHIDDevice::free()
     }
 
     OSSafeReleaseNULL(_asyncTimer);
+    OSSafeReleaseNULL(_asyncReportQueue);
     OSSafeReleaseNULL(_eventSource);
     OSSafeReleaseNULL(_workLoop);
 
@@ -784,6 +976,10 @@ void IOHIDDevice::stop(IOService * provider)
             _asyncTimer->cancelTimeout();
             _workLoop->removeEventSource(_asyncTimer);
         }
+        if (_asyncReportQueue) {
+            _workLoop->removeEventSource(_asyncReportQueue);
+            _asyncReportQueue->abortPendingReports();
+        }
     }
 
     _readyForInputReports = false;
@@ -1829,7 +2025,7 @@ bool IOHIDDevice::createReportHandlerElements( HIDPreparsedDataRef parseData __u
     return true;
 }
 
-IOReturn IOHIDDevice::postElementTransaction(const void* elementData, UInt32 dataSize, UInt32 completionTimeout, IOHIDCompletion * completion)
+IOReturn IOHIDDevice::postElementTransaction(const void* elementData, UInt32 dataSize, UInt32 completionTimeout, IOHIDCompletion * completion, UInt32 * reportCount)
 {
     IOReturn ret = kIOReturnError;
     uint32_t   cookies_[kMaxLocalCookieArrayLength];
@@ -1841,6 +2037,8 @@ IOReturn IOHIDDevice::postElementTransaction(const void* elementData, UInt32 dat
     uint32_t   dataOffset = 0;
     size_t     index = 0;
     uint8_t    *data = (uint8_t*)elementData;
+    UInt8      reportMap[UINT8_MAX + 1] = {0};
+    UInt32     reportsToSend = 0;
     IOMemoryDescriptor *elementDesc = getMemoryWithCurrentElementValues();
     require(_elementArray && elementDesc, fail);
 
@@ -1927,6 +2125,8 @@ IOReturn IOHIDDevice::postElementTransaction(const void* elementData, UInt32 dat
         void *elementValuePtr;
         IOHIDElementPrivate *element;
         OSData *elementVal;
+        IOHIDReportType reportType;
+        UInt8 reportID;
 
         elementValuePtr = (void*)((const IOHIDElementValueHeader *)(data + dataOffset))->value;
         element = GetElement(cookies[index]);
@@ -1937,12 +2137,25 @@ IOReturn IOHIDDevice::postElementTransaction(const void* elementData, UInt32 dat
         require_action(elementVal, fail, ret = kIOReturnNoMemory);
         element->setDataBits(elementVal);
         elementVal->release();
+
+        // Count the reports postElementValues will send, one per
+        // (report type, report ID) of the output and feature elements.
+        if (element->getReportType(&reportType) && (reportType == kIOHIDReportTypeOutput || reportType == kIOHIDReportTypeFeature)) {
+            reportID = element->getReportID();
+            if (!(reportMap[reportID] & (1 << reportType))) {
+                reportMap[reportID] |= (1 << reportType);
+                reportsToSend++;
+            }
+        }
     }
 
-    // Actually post elements
+    // Actually post elements. All values are applied above, so every report
+    // touched by the transaction is built and sent once.
     ret = postElementValues((IOHIDElementCookie *)cookies, (UInt32)cookieCount, 0, completionTimeout, completion);
     if (ret != kIOReturnSuccess) {
         HIDDeviceLogError("postElementValues:%#x", ret);
+    } else if (reportCount) {
+        *reportCount = reportsToSend;
     }
 
 fail:
@@ -2455,10 +2668,21 @@ IOReturn IOHIDDevice::handleReportWithTimeAsync(
     WORKLOOP_LOCK;
 
     if (!_asyncReportQueue) {
-        _asyncReportQueue = IOHIDAsyncReportQueue::withOwner(this);
+        uint32_t    entrySize   = max(_maxInputReportSize, max(_maxOutputReportSize, max(_maxFeatureReportSize, (UInt32)sizeof(uint64_t))));
+        uint32_t    depth       = kIOHIDAsyncReportQueueDefaultDepth;
+        OSObject *  obj         = copyProperty(kIOHIDAsyncReportQueueDepthKey);
+        OSNumber *  number      = OSDynamicCast(OSNumber, obj);
+
+        if (number && number->unsigned32BitValue()) {
+            depth = min(number->unsigned32BitValue(), (uint32_t)kIOHIDAsyncReportQueueMaxDepth);
+        }
+        OSSafeReleaseNULL(obj);
+
+        _asyncReportQueue = IOHIDAsyncReportQueue::withOwner(this, entrySize, depth);
 
         if (_asyncReportQueue) {
             /*status =*/ getWorkLoop()->addEventSource ( _asyncReportQueue );
+            setProperty(kIOHIDAsyncReportQueueKey, _asyncReportQueue);
         }
     }
 
@@ -2625,6 +2849,9 @@ IOReturn IOHIDDevice::runElementValues(IOHIDElementCookie * cookies, UInt32 cook
             continue;
         }
 
+        // Elements are grouped by (report type, report ID). The first element
+        // of each report builds it from the current value of every element
+        // it contains, so later elements of the same report are skipped.
         reportID = element->getReportID();
         if (cookieCount > 1 && reportMap[reportID] & (1 << reportType)) {
             continue;
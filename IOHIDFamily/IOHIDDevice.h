@@ -176,7 +176,7 @@ private:
 
     OSArray * newDeviceUsagePairs(OSArray * elements, UInt32 start);
 
-    IOReturn postElementTransaction(const void* elementData, UInt32 dataSize, UInt32 completionTimeout = 0, IOHIDCompletion * completion = 0);
+    IOReturn postElementTransaction(const void* elementData, UInt32 dataSize, UInt32 completionTimeout = 0, IOHIDCompletion * completion = 0, UInt32 * reportCount = 0);
 
     static bool _publishDeviceNotificationHandler(void * target,
                                                   void * refCon,
@@ -135,6 +135,7 @@ IOReturn IOHIDElementContainer::createElementHierarchy(HIDPreparsedDataRef parse
 {
     OSStatus status;
     HIDCapabilities caps;
+    HIDDescriptorStatistics stats;
     bool result = false;
     IOReturn ret = kIOReturnError;
     
@@ -144,18 +145,24 @@ IOReturn IOHIDElementContainer::createElementHierarchy(HIDPreparsedDataRef parse
         DescriptorLog("createElementHierarchy HIDGetCapabilities failed: 0x%x", (unsigned int)status);
     });
     
+    // The statistics bound the number of elements created below, including
+    // the sub-elements of usage ranges and arrays, so the array never grows.
+    status = HIDGetDescriptorStatistics(parseData, &stats);
+    require_noerr_action(status, exit, {
+        DescriptorLog("createElementHierarchy HIDGetDescriptorStatistics failed: 0x%x", (unsigned int)status);
+    });
+    
+    DescriptorLog("Collections: %ld report items: %ld usages: %ld elements: %ld",
+                  (long)stats.collectionCount,
+                  (long)stats.reportItemCount,
+                  (long)stats.usageCount,
+                  (long)stats.elementCount);
+    
     _maxInputReportSize = (UInt32)caps.inputReportByteLength;
     _maxOutputReportSize = (UInt32)caps.outputReportByteLength;
     _maxFeatureReportSize = (UInt32)caps.featureReportByteLength;
     
-    _elements = OSArray::withCapacity(caps.numberCollectionNodes +
-                                      caps.numberInputButtonCaps +
-                                      caps.numberInputValueCaps +
-                                      caps.numberOutputButtonCaps +
-                                      caps.numberOutputValueCaps +
-                                      caps.numberFeatureButtonCaps +
-                                      caps.numberFeatureValueCaps +
-                                      10);
+    _elements = OSArray::withCapacity(stats.elementCount);
     require(_elements, exit);
     
     _elements->setCapacityIncrement(10);
@@ -90,6 +90,29 @@ enum {
 #define GAME_CONTROLLER_EXTENDED_MASK (0x000270C0 | GAME_CONTROLLER_STANDARD_MASK)
 #define GAME_CONTROLLER_FORM_FITTING_MASK (0x1000000)
 
+// Indexed by IOHIDEventDriver::kReportHandler*, keep in sync with hidartraceutil.
+static const char * const kReportHandlerNames[] = {
+    "ChildVendorMessage",
+    "Phase",
+    "BootPointing",
+    "Relative",
+    "GameController",
+    "MultiAxisPointer",
+    "Digitizer",
+    "Scroll",
+    "Keyboard",
+    "Unicode",
+    "Biometric",
+    "Accel",
+    "Gyro",
+    "Compass",
+    "Temperature",
+    "DeviceOrientation",
+    "Proximity",
+    "HeartRate",
+    "PrimaryVendorMessage",
+};
+
 //===========================================================================
 // EventElementCollection class
 class EventElementCollection: public OSObject
@@ -288,6 +311,7 @@ OSDefineMetaClassAndStructors( IOHIDEventDriver, IOHIDEventService )
 #define _workLoop                       _reserved->workLoop
 #define _commandGate                    _reserved->commandGate
 #define _appleVendorSupported           _reserved->appleVendorSupported
+#define _handlerStats                   _reserved->handlerStats
 
 
 //====================================================================================================
@@ -1658,6 +1682,14 @@ IOReturn IOHIDEventDriver::setProperties( OSObject * properties )
         });
     }
 
+    if ((boolVal = OSDynamicCast(OSBoolean, propertyDict->getObject(kIOHIDReportHandlerStatisticsKey)))) {
+        dispatch_workloop_sync ({
+            bzero(&_handlerStats, sizeof(_handlerStats));
+            _handlerStats.enabled = (boolVal == kOSBooleanTrue);
+        });
+        result = kIOReturnSuccess;
+    }
+
     if (_keyboard.keyboardPower) {
         if ((objVal = propertyDict->getObject(kIOHIDKeyboardEnabledEventKey))) {
             setProperty(kIOHIDKeyboardEnabledEventKey, objVal);
@@ -3120,6 +3152,25 @@ static inline void setButtonState(UInt32 * state, UInt32 bit, UInt32 value)
 //====================================================================================================
 // IOHIDEventDriver::handleInterruptReport
 //====================================================================================================
+// Each handler is bracketed by start/end tracepoints, arg1 is the handler index
+// (see kReportHandlerNames). Invocation and time counters are only maintained
+// while kIOHIDReportHandlerStatisticsKey is enabled.
+#define HANDLE_REPORT(index, call)                                                                  \
+    do {                                                                                            \
+        UInt64 handlerStart = _handlerStats.enabled ? mach_absolute_time() : 0;                     \
+        IOHIDTraceStart(kIOHIDDebugCode_EventDriver_ReportHandler, index, reportID, regID, 0);      \
+        call;                                                                                       \
+        IOHIDTraceEnd(kIOHIDDebugCode_EventDriver_ReportHandler, index, reportID, regID, 0);        \
+        if (handlerStart) {                                                                         \
+            UInt64 handlerTime = mach_absolute_time() - handlerStart;                               \
+            _handlerStats.count[index]++;                                                           \
+            _handlerStats.time[index] += handlerTime;                                               \
+            if (handlerTime > _handlerStats.maxTime[index]) {                                       \
+                _handlerStats.maxTime[index] = handlerTime;                                         \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
 void IOHIDEventDriver::handleInterruptReport (
                                 AbsoluteTime                timeStamp,
                                 IOMemoryDescriptor *        report,
@@ -3131,30 +3182,32 @@ void IOHIDEventDriver::handleInterruptReport (
   
     _lastReportTime = mach_continuous_time();
   
-    IOHID_DEBUG(kIOHIDDebugCode_InturruptReport, reportType, reportID, getRegistryEntryID(), 0);
+    UInt64 regID = getRegistryEntryID();
+
+    IOHID_DEBUG(kIOHIDDebugCode_InturruptReport, reportType, reportID, regID, 0);
 
-    handleVendorMessageReport(timeStamp, report, reportID, kIOHandleChildVendorMessageReport);
+    HANDLE_REPORT(kReportHandlerChildVendorMessage, handleVendorMessageReport(timeStamp, report, reportID, kIOHandleChildVendorMessageReport));
     // Update the phase before any events are dispatched.
-    handlePhaseReport(timeStamp, reportID);
-
-    handleBootPointingReport(timeStamp, report, reportID);
-    handleRelativeReport(timeStamp, reportID);
-    handleGameControllerReport(timeStamp, reportID);
-    handleMultiAxisPointerReport(timeStamp, reportID);
-    handleDigitizerReport(timeStamp, reportID);
-    handleScrollReport(timeStamp, reportID);
-    handleKeboardReport(timeStamp, reportID);
-    handleUnicodeReport(timeStamp, reportID);
-    handleBiometricReport(timeStamp, reportID);
-    handleAccelReport(timeStamp, reportID);
-    handleGyroReport (timeStamp, reportID);
-    handleCompassReport (timeStamp, reportID);
-    handleTemperatureReport (timeStamp, reportID);
-    handleDeviceOrientationReport (timeStamp, reportID);
-    handleProximityReport(timeStamp, reportID);
-    handleHeartRateReport(timeStamp, reportID);
-
-    handleVendorMessageReport(timeStamp, report, reportID, kIOHandlePrimaryVendorMessageReport);
+    HANDLE_REPORT(kReportHandlerPhase, handlePhaseReport(timeStamp, reportID));
+
+    HANDLE_REPORT(kReportHandlerBootPointing, handleBootPointingReport(timeStamp, report, reportID));
+    HANDLE_REPORT(kReportHandlerRelative, handleRelativeReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerGameController, handleGameControllerReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerMultiAxisPointer, handleMultiAxisPointerReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerDigitizer, handleDigitizerReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerScroll, handleScrollReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerKeyboard, handleKeboardReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerUnicode, handleUnicodeReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerBiometric, handleBiometricReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerAccel, handleAccelReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerGyro, handleGyroReport (timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerCompass, handleCompassReport (timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerTemperature, handleTemperatureReport (timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerDeviceOrientation, handleDeviceOrientationReport (timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerProximity, handleProximityReport(timeStamp, reportID));
+    HANDLE_REPORT(kReportHandlerHeartRate, handleHeartRateReport(timeStamp, reportID));
+
+    HANDLE_REPORT(kReportHandlerPrimaryVendorMessage, handleVendorMessageReport(timeStamp, report, reportID, kIOHandlePrimaryVendorMessageReport));
 
 }
 
@@ -5104,6 +5157,14 @@ bool   IOHIDEventDriver::serializeDebugState(void * ref __unused, OSSerialize *
         }
     }
 
+    if (_handlerStats.enabled) {
+        OSArray * handlerStats = copyHandlerStatistics();
+        if (handlerStats) {
+            debugDict->setObject("ReportHandlerStatistics", handlerStats);
+            OSSafeReleaseNULL(handlerStats);
+        }
+    }
+
     result = debugDict->serialize(serializer);
     debugDict->release();
 
@@ -5111,6 +5172,67 @@ exit:
     return result;
 }
 
+//====================================================================================================
+// IOHIDEventDriver::copyHandlerStatistics
+//====================================================================================================
+OSArray * IOHIDEventDriver::copyHandlerStatistics()
+{
+    OSArray * result = OSArray::withCapacity(kReportHandlerCount);
+    
+    static_assert(sizeof(kReportHandlerNames) / sizeof(kReportHandlerNames[0]) == kReportHandlerCount,
+                  "kReportHandlerNames out of sync with report handlers");
+    
+    require(result, exit);
+    
+    for (unsigned int index = 0; index < kReportHandlerCount; index++) {
+        OSDictionary *  handlerDict;
+        const OSSymbol * name;
+        OSNumber *      num;
+        uint64_t        nanoTime;
+        
+        if (!_handlerStats.count[index]) {
+            continue;
+        }
+        
+        handlerDict = OSDictionary::withCapacity(4);
+        if (!handlerDict) {
+            continue;
+        }
+        
+        name = OSSymbol::withCStringNoCopy(kReportHandlerNames[index]);
+        if (name) {
+            handlerDict->setObject("Handler", name);
+            OSSafeReleaseNULL(name);
+        }
+        
+        num = OSNumber::withNumber(_handlerStats.count[index], 64);
+        if (num) {
+            handlerDict->setObject("Count", num);
+            OSSafeReleaseNULL(num);
+        }
+        
+        absolutetime_to_nanoseconds(_handlerStats.time[index], &nanoTime);
+        num = OSNumber::withNumber(nanoTime, 64);
+        if (num) {
+            handlerDict->setObject("TotalTime", num);
+            OSSafeReleaseNULL(num);
+        }
+        
+        absolutetime_to_nanoseconds(_handlerStats.maxTime[index], &nanoTime);
+        num = OSNumber::withNumber(nanoTime, 64);
+        if (num) {
+            handlerDict->setObject("MaxTime", num);
+            OSSafeReleaseNULL(num);
+        }
+        
+        result->setObject(handlerDict);
+        handlerDict->release();
+    }
+    
+exit:
+    return result;
+}
+
 void IOHIDEventDriver::handleHeartRateReport(AbsoluteTime timeStamp, UInt32 reportID)
 {
     IOHIDDouble confidence = 1.0;
@@ -61,6 +61,28 @@ private:
     UInt32                      _reservedUInt32 __unused;
     bool                        _reservedBool1  __unused;
     
+    enum {
+        kReportHandlerChildVendorMessage,
+        kReportHandlerPhase,
+        kReportHandlerBootPointing,
+        kReportHandlerRelative,
+        kReportHandlerGameController,
+        kReportHandlerMultiAxisPointer,
+        kReportHandlerDigitizer,
+        kReportHandlerScroll,
+        kReportHandlerKeyboard,
+        kReportHandlerUnicode,
+        kReportHandlerBiometric,
+        kReportHandlerAccel,
+        kReportHandlerGyro,
+        kReportHandlerCompass,
+        kReportHandlerTemperature,
+        kReportHandlerDeviceOrientation,
+        kReportHandlerProximity,
+        kReportHandlerHeartRate,
+        kReportHandlerPrimaryVendorMessage,
+        kReportHandlerCount
+    };
     
     struct ExpansionData {
         SInt32  absoluteAxisRemovalPercentage;
@@ -228,6 +250,13 @@ private:
 
         IOWorkLoop *            workLoop;
         IOCommandGate *         commandGate;
+        
+        struct {
+            bool                enabled;
+            UInt64              count[kReportHandlerCount];
+            UInt64              time[kReportHandlerCount];
+            UInt64              maxTime[kReportHandlerCount];
+        } handlerStats;
     };
 
     ExpansionData *             _reserved;
@@ -318,6 +347,7 @@ private:
     bool                    conformTo (UInt32 usagePage, UInt32 usage);
     IOHIDEvent*             createDigitizerTransducerEventForReport(DigitizerTransducer * transducer, AbsoluteTime timeStamp, UInt32 reportID);
     bool                    serializeDebugState(void * ref, OSSerialize * serializer);
+    OSArray *               copyHandlerStatistics();
     UInt32                  getButtonStateFromElements(OSArray * elements);
 
 protected:
@@ -77,6 +77,7 @@ public:
     // start/stop are accessible from user space.
     inline virtual void start() { _state |= kHIDQueueStarted; }
     inline virtual void stop() { _state &= ~kHIDQueueStarted; }
+    inline bool isStarted() { return _state & kHIDQueueStarted; }
     
     // enable disable are only accessible from kernel.
     inline virtual void enable() { _state &= ~kHIDQueueDisabled; }
@@ -2831,6 +2831,7 @@ void IOHIDEventService::publishProperties()
         { .key = kIOHIDSupportsIOFastPathKey,           .type = OSTypeID(OSBoolean) },
         { .key = kIOHIDSpatialBluetoothAccessoryKey,    .type = OSTypeID(OSBoolean) },
         { .key = kIOUniformTypeIdentifiersKey,          .type = OSTypeID(OSObject)  },
+        { .key = kIOHIDFastPathEventFieldsKey,          .type = OSTypeID(OSArray)   },
     };
     const size_t count = sizeof(properties) / sizeof(properties[0]);
 
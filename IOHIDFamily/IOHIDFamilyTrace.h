@@ -68,6 +68,7 @@ enum kIOHIDDebugCodes {
     kIOHIDDebugCode_DK_Intf_HandleReport,
     kIOHIDDebugCode_CmplxEvtDrv_InterruptReport,
     kIOHIDDebugCode_IOFastPath_EnqueueSample,
+    kIOHIDDebugCode_EventDriver_ReportHandler,  // 36 0x5230090
     kIOHIDDebugCode_Invalid
 };
 
@@ -963,6 +963,7 @@ void IOHIDInterface::publishProperties()
         { .key = kIOHIDSpatialBluetoothAccessoryKey,    .type = OSTypeID(OSBoolean) },
         { .key = kIOUniformTypeIdentifiersKey,          .type = OSTypeID(OSObject)  },
         { .key = kIOHIDSupportsInputTopology,           .type = OSTypeID(OSBoolean) },
+        { .key = kIOHIDFastPathEventFieldsKey,          .type = OSTypeID(OSArray)   },
     };
     const size_t count = sizeof(properties) / sizeof(properties[0]);
 
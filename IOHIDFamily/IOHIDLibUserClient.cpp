@@ -228,7 +228,7 @@ sMethods[kIOHIDLibUserClientNumCommands] = {
     { //    kIOHIDLibUserClientPostElementValues
     (IOExternalMethodAction) &IOHIDLibUserClient::_postElementValues,
     1, kIOUCVariableStructureSize,
-    0, 0,
+    kIOUCVariableStructureSize, 0, /* optional scalar output : the number of reports sent */
     true
     },
     { //    kIOHIDLibUserClientGetReport
@@ -273,6 +273,12 @@ sMethods[kIOHIDLibUserClientNumCommands] = {
     0, 0,
     0, 0,
     true
+    },
+    { //   kIOHIDLibUserClientResizeQueue
+    (IOExternalMethodAction) &IOHIDLibUserClient::_resizeQueue,
+    2, 0,
+    1, 0,
+    true
     }
 };
 
@@ -1360,6 +1366,28 @@ IOReturn IOHIDLibUserClient::_createQueue(IOHIDLibUserClient * target, void * re
 }
 
 IOReturn IOHIDLibUserClient::createQueue(uint32_t flags, uint32_t depth, uint64_t * outQueue)
+{
+    IOReturn    ret                     = kIOReturnError;
+    IOHIDReportElementQueue *eventQueue = NULL;
+    
+    eventQueue = createElementQueue(flags, depth);
+    require_action(eventQueue, exit, ret = kIOReturnNoMemory);
+    
+    // add the queue to the map and set out queue
+    *outQueue = (uint64_t)createTokenForQueue(eventQueue);
+    eventQueue->release();
+    
+    ret = kIOReturnSuccess;
+    
+exit:
+    if (ret != kIOReturnSuccess) {
+        HIDLibUserClientLogError("createQueue failed: 0x%x", (unsigned int)ret);
+    }
+
+    return ret;
+}
+
+IOHIDReportElementQueue * IOHIDLibUserClient::createElementQueue(uint32_t flags, uint32_t depth)
 {
     OSNumber    *reportBufferCount      = NULL;
     OSNumber    *reportBufferEntrySize  = NULL;
@@ -1369,7 +1397,6 @@ IOReturn IOHIDLibUserClient::createQueue(uint32_t flags, uint32_t depth, uint64_
     UInt32      reportSize              = 0;
     UInt32      numEntries              = 0;
     UInt32      entrySize               = 0;
-    IOReturn    ret                     = kIOReturnError;
     IOHIDReportElementQueue *eventQueue         = NULL;
     
     if ((reportBufferCount = OSDynamicCast(OSNumber, copyProperty(kIOHIDMaxReportBufferCountKey))) ||
@@ -1419,7 +1446,7 @@ IOReturn IOHIDLibUserClient::createQueue(uint32_t flags, uint32_t depth, uint64_
         eventQueue = IOHIDReportElementQueue::withCapacity(queueSize, this);
     }
     
-    require_action(eventQueue, exit, ret = kIOReturnNoMemory);
+    require(eventQueue, exit);
     
     eventQueue->setOptions(flags);
     
@@ -1427,17 +1454,94 @@ IOReturn IOHIDLibUserClient::createQueue(uint32_t flags, uint32_t depth, uint64_
         eventQueue->disable();
     }
     
-    // add the queue to the map and set out queue
-    *outQueue = (uint64_t)createTokenForQueue(eventQueue);
-    eventQueue->release();
+exit:
+    return eventQueue;
+}
+
+IOReturn IOHIDLibUserClient::_resizeQueue(IOHIDLibUserClient * target, void * reference __unused, IOExternalMethodArguments * arguments)
+{
+    return target->resizeQueue(target->getQueueForToken((u_int)arguments->scalarInput[0]), (uint32_t)arguments->scalarInput[1], arguments->asyncWakePort, &(arguments->scalarOutput[0]));
+}
+
+// Creates a queue of the new depth and moves event delivery from queue over to
+// it in one gated step, so no report is lost or delivered twice. The old queue
+// stops receiving reports but stays mapped, so the client can drain it before
+// disposing of it and mapping the new one.
+IOReturn IOHIDLibUserClient::resizeQueue(IOHIDEventQueue * queue, uint32_t depth, mach_port_t port, uint64_t * outQueue)
+{
+    IOReturn                ret         = kIOReturnError;
+    IOHIDReportElementQueue *oldQueue   = OSDynamicCast(IOHIDReportElementQueue, queue);
+    IOHIDReportElementQueue *newQueue   = NULL;
+    u_int                   token       = 0;
+    
+    require_action(oldQueue, exit, ret = kIOReturnBadArgument);
+    require_action(fNub && !isInactive(), exit, ret = kIOReturnOffline);
+    
+    // A blocked report will be retried against the old queue once woken
+    require_action(!oldQueue->pendingReports(), exit, ret = kIOReturnBusy);
+    
+    newQueue = createElementQueue(oldQueue->getOptions(), depth);
+    require_action(newQueue, exit, ret = kIOReturnNoMemory);
     
+    newQueue->setNotificationPort(port);
+    
+    token = createTokenForQueue(newQueue);
+    require_action(token, exit, ret = kIOReturnNoResources);
+    
+    for (uint32_t elementType = kHIDElementType; elementType <= kHIDReportHandlerType; ++elementType) {
+        OSArray *elements = getElementsForType(elementType);
+        
+        if (!elements) {
+            continue;
+        }
+        
+        for (uint32_t i = 0; i < elements->getCount(); i++) {
+            IOHIDElementPrivate *element = OSDynamicCast(IOHIDElementPrivate, elements->getObject(i));
+            
+            if (!element || !element->hasEventQueue(oldQueue)) {
+                continue;
+            }
+            
+            // Stop at the first failure, later elements are still on oldQueue
+            require_action(element->addEventQueue(newQueue), rollback, ret = kIOReturnNoMemory);
+            
+            element->removeEventQueue(oldQueue);
+        }
+    }
+    
+    // Only the started state carries over, disable tracks the device
+    if (oldQueue->isStarted()) {
+        newQueue->start();
+    }
+    oldQueue->stop();
+    
+    *outQueue = (uint64_t)token;
     ret = kIOReturnSuccess;
+    goto exit;
+    
+rollback:
+    // Hand any elements we already moved back to the old queue
+    for (uint32_t elementType = kHIDElementType; elementType <= kHIDReportHandlerType; ++elementType) {
+        OSArray *elements = getElementsForType(elementType);
+        
+        for (uint32_t i = 0; elements && i < elements->getCount(); i++) {
+            IOHIDElementPrivate *element = OSDynamicCast(IOHIDElementPrivate, elements->getObject(i));
+            
+            if (element && element->hasEventQueue(newQueue)) {
+                element->addEventQueue(oldQueue);
+                element->removeEventQueue(newQueue);
+            }
+        }
+    }
+    removeQueueFromMap(newQueue);
     
 exit:
+    OSSafeReleaseNULL(newQueue);
+    
     if (ret != kIOReturnSuccess) {
-        HIDLibUserClientLogError("createQueue failed: 0x%x", (unsigned int)ret);
+        HIDLibUserClientLogError("resizeQueue failed: 0x%x", (unsigned int)ret);
     }
-
+    
     return ret;
 }
 
@@ -1694,6 +1798,7 @@ IOReturn IOHIDLibUserClient::_postElementValues(IOHIDLibUserClient * target, voi
     IOHIDCompletion * completion = NULL;
     OSValueObject<AsyncCommitParam> * asyncData  = NULL;
     AsyncCommitParam  pb;
+    UInt32            reportCount = 0;
 
     if (arguments->asyncWakePort) {
         target->retain();
@@ -1712,9 +1817,13 @@ IOReturn IOHIDLibUserClient::_postElementValues(IOHIDLibUserClient * target, voi
     }
 
     if (arguments->structureInputDescriptor) {
-        ret = target->postElementValues(arguments->structureInputDescriptor, timeout, completion);
+        ret = target->postElementValues(arguments->structureInputDescriptor, timeout, completion, &reportCount);
     } else {
-        ret = target->postElementValues((const uint8_t *)arguments->structureInput, arguments->structureInputSize, timeout, completion);
+        ret = target->postElementValues((const uint8_t *)arguments->structureInput, arguments->structureInputSize, timeout, completion, &reportCount);
+    }
+
+    if (arguments->scalarOutputCount) {
+        arguments->scalarOutput[0] = reportCount;
     }
 
 exit:
@@ -1726,7 +1835,7 @@ exit:
     return ret;
 }
 
-IOReturn IOHIDLibUserClient::postElementValues(IOMemoryDescriptor * desc, uint32_t timeout, IOHIDCompletion * completion)
+IOReturn IOHIDLibUserClient::postElementValues(IOMemoryDescriptor * desc, uint32_t timeout, IOHIDCompletion * completion, UInt32 * reportCount)
 {
     IOReturn      ret     = kIOReturnBadArgument;
     IOMemoryMap * mapping = NULL;
@@ -1740,7 +1849,7 @@ IOReturn IOHIDLibUserClient::postElementValues(IOMemoryDescriptor * desc, uint32
     require_action((mapping = desc->map()), exit, ret = kIOReturnNoMemory);
     require_action(elementData = reinterpret_cast<uint8_t*>(mapping->getVirtualAddress()), exit, ret = kIOReturnNoMemory);
 
-    ret = postElementValues(elementData, elementLength, timeout, completion);
+    ret = postElementValues(elementData, elementLength, timeout, completion, reportCount);
     require_noerr_action(ret, exit, HIDLibUserClientLogError("postElementValues failed: 0x%x", ret));
 
 exit:
@@ -1748,7 +1857,7 @@ exit:
     return ret;
 }
 
-IOReturn IOHIDLibUserClient::postElementValues(const uint8_t * data, uint32_t dataSize, uint32_t timeout, IOHIDCompletion * completion)
+IOReturn IOHIDLibUserClient::postElementValues(const uint8_t * data, uint32_t dataSize, uint32_t timeout, IOHIDCompletion * completion, UInt32 * reportCount)
 {
     IOReturn ret = kIOReturnError;
 
@@ -1758,7 +1867,7 @@ IOReturn IOHIDLibUserClient::postElementValues(const uint8_t * data, uint32_t da
     require_action(fNub && !isInactive(), exit, ret = kIOReturnNotAttached);
     require_action(data && dataSize, exit, ret = kIOReturnBadArgument);
 
-    ret = fNub->postElementTransaction(data, dataSize, timeout, completion);
+    ret = fNub->postElementTransaction(data, dataSize, timeout, completion, reportCount);
     require_noerr_action(ret, exit, HIDLibUserClientLogError("postElementValues failed: 0x%x", ret));
 
 exit:
@@ -65,7 +65,8 @@ enum IOHIDLibUserClientCommandCodes {
 	kIOHIDLibUserClientSetQueueAsyncPort,
     kIOHIDLibUserClientReleaseReport,
     kIOHIDLibUserClientResumeReports,
-	kIOHIDLibUserClientNumCommands // 19
+    kIOHIDLibUserClientResizeQueue,
+	kIOHIDLibUserClientNumCommands // 20
 };
 
 enum IOHIDElementValueFlags {
@@ -138,6 +139,7 @@ struct IOHIDElementStruct
 typedef struct _IOHIDQueueHeader
 {
 	uint64_t _Atomic status;
+	uint64_t _Atomic dropCount;
 } IOHIDQueueHeader;
 
 enum IOHIDQueueStatus {
@@ -301,6 +303,11 @@ protected:
 	// Create a queue
 	static IOReturn _createQueue(IOHIDLibUserClient * target, void * reference, IOExternalMethodArguments * arguments);
 	IOReturn		createQueue(uint32_t flags, uint32_t depth, uint64_t * outQueue);
+	IOHIDReportElementQueue * createElementQueue(uint32_t flags, uint32_t depth);
+
+	// Replace a queue with one of a different depth
+	static IOReturn _resizeQueue(IOHIDLibUserClient * target, void * reference, IOExternalMethodArguments * arguments);
+	IOReturn		resizeQueue(IOHIDEventQueue * queue, uint32_t depth, mach_port_t port, uint64_t * outQueue);
 
 	// Dispose a queue
 	static IOReturn _disposeQueue(IOHIDLibUserClient * target, void * reference, IOExternalMethodArguments * arguments);
@@ -333,8 +340,8 @@ protected:
 												
 	// Post element value
 	static IOReturn _postElementValues(IOHIDLibUserClient * target, void * reference, IOExternalMethodArguments * arguments);
-    IOReturn        postElementValues(IOMemoryDescriptor * desc, uint32_t timeout = 0, IOHIDCompletion * completion = 0);
-	IOReturn		postElementValues(const uint8_t * data, uint32_t dataSize, uint32_t timeout = 0, IOHIDCompletion * completion = 0);
+    IOReturn        postElementValues(IOMemoryDescriptor * desc, uint32_t timeout = 0, IOHIDCompletion * completion = 0, UInt32 * reportCount = 0);
+	IOReturn		postElementValues(const uint8_t * data, uint32_t dataSize, uint32_t timeout = 0, IOHIDCompletion * completion = 0, UInt32 * reportCount = 0);
 												
 	// Get report
 	static IOReturn _getReport(IOHIDLibUserClient * target, void * reference, IOExternalMethodArguments * arguments);
@@ -145,6 +145,14 @@ enum {
 
 #define kIOHIDPerfEventKey                 "PerfEvent"
 
+/*!
+    @defined kIOHIDReportHandlerStatisticsKey
+    @abstract Boolean enabling per handler invocation and time counters in IOHIDEventDriver.
+    @discussion Counters are reset when enabled and published in the DebugState property.
+*/
+
+#define kIOHIDReportHandlerStatisticsKey   "ReportHandlerStatistics"
+
 
 /*!
     @defined HID Element Dictionary Keys
@@ -161,6 +169,16 @@ enum {
 
 #define kIOHIDMaxReportEnqueueSizeKey        "MaxQueuedReportSize"
 
+/*!
+ * @define      kIOHIDAsyncReportQueueDepthKey
+ * @abstract    Number of preallocated entries handleReportWithTimeAsync
+ *              holds reports in, set on the IOHIDDevice before its first async
+ *              report. Reports posted while all of them are pending are
+ *              allocated individually, so none are dropped.
+ */
+#define kIOHIDAsyncReportQueueDepthKey      "AsyncReportQueueDepth"
+#define kIOHIDAsyncReportQueueKey           "AsyncReportQueue"
+
 #define kIOHIDAppleVendorSupported          "AppleVendorSupported"
 
 #define kIOHIDSetButtonPropertiesKey        "SetButtonProperties"
@@ -180,6 +198,22 @@ enum {
 
 #define kIOHIDFastPathHasEntitlementKey     "FastPathHasEntitlement"
 
+/*!
+ * @define      kIOHIDFastPathEventFieldsKey
+ * @abstract    Array of fields published by an IOFastPathHIDEventService.
+ * @discussion  Property of the HID device, for example from the IOHIDUserDevice properties or a
+ *              device personality. IOHIDInterface and IOHIDEventService publish it, and an event
+ *              service that has it, along with kIOHIDSupportsIOFastPathKey, matches the HID Event
+ *              IOFastPath personality. Each entry is a dictionary containing
+ *              kIOHIDFastPathEventFieldKey (IOHIDEventField), kIOHIDFastPathFieldKeyKey
+ *              (IOFastPathFieldKey) and optionally kIOHIDFastPathFieldTypeKey (IOFastPathFieldType,
+ *              integer by default). All event fields must belong to the same event type.
+ */
+#define kIOHIDFastPathEventFieldsKey        "FastPathEventFields"
+#define kIOHIDFastPathEventFieldKey         "EventField"
+#define kIOHIDFastPathFieldKeyKey           "FieldKey"
+#define kIOHIDFastPathFieldTypeKey          "FieldType"
+
 /*!
  * @define      kIOHIDFastPathMotionEventEntitlementKey
  * @abstract    Fast Path User Client has privileges to receive motion events during restricted states.
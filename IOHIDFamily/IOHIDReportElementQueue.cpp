@@ -74,6 +74,10 @@ Boolean IOHIDReportElementQueue::enqueue(void *data, UInt32 dataSize)
     Boolean result;
 
     result = super::enqueue(data, dataSize);
+    if (!result) {
+        // Let the client see overflow without having to poll the registry
+        header->dropCount++;
+    }
 
     return result;
 }
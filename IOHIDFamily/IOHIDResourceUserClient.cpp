@@ -42,7 +42,6 @@ enum {
 
 #include "IOHIDResourceUserClient.h"
 #include <libkern/OSAtomic.h>
-#include <libkern/c++/OSValueObject.h>
 #include "IOHIDDebug.h"
 #include "IOHIDPrivateKeys.h"
 #include "IOHIDFamilyPrivate.h"
@@ -50,22 +49,47 @@ enum {
 
 #define kHIDQueueSize           16384
 
+#define kHIDReportRingSize      32768
+
 #define kMaxQueueReportSize     4 * 1024 // 4k. This size already works.
 
+#define kMaxStagedReportSize    kHIDReportRingSize // largest report posted through the ring or a batch
+
+#define ReportRingOffsetIsValid(offset) \
+    ((offset) < kHIDReportRingSize && ((offset) % kIOHIDResourceReportRingAlignment) == 0)
+
 #define super IOUserClient2022
 
 
 OSDefineMetaClassAndStructors(IOHIDResourceDeviceUserClient, IOUserClient2022)
 
-typedef struct {
+// Pending get/set report requests live in a fixed table of slots. The low
+// bits of a request's token are its slot index, so a response from the user
+// process finds its request without a search, and the rest of the token is a
+// sequence number that rejects responses to a request that has already
+// completed or timed out.
+#define kPendingReportSlotShift     6
+#define kPendingReportSlotCount     (1 << kPendingReportSlotShift)
+#define kPendingReportSlotMask      (kPendingReportSlotCount - 1)
+#define kPendingReportSlotNone      UINT32_MAX
+
+enum {
+    kPendingReportStateFree,
+    kPendingReportStatePending,
+    kPendingReportStateTimedOut
+};
+
+struct IOHIDResourceDeviceUserClient::PendingReport {
     IOReturn             ret;
     IOMemoryDescriptor * descriptor;
     u_int64_t            token;
     IOHIDCompletion      completion;
     AbsoluteTime         deadline;
-} __ReportResult;
-
-OSDefineValueObjectForDependentType(__ReportResult)
+    uint64_t             startTime;
+    IOHIDResourceReportDirection direction;
+    uint32_t             state;
+    uint32_t             nextFree;
+};
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // IOHIDResourceDeviceUserClient::_methods
@@ -107,6 +131,18 @@ const IOExternalMethodDispatch2022 IOHIDResourceDeviceUserClient::_methods[kIOHI
         0, 0,
         false
     },
+    {   // kIOHIDResourceDeviceUserClientMethodDrainReportRing
+        (IOExternalMethodAction) &IOHIDResourceDeviceUserClient::_drainReportRing,
+        0, 0,
+        1, 0, /* 1 scalar output : the number of reports drained */
+        false
+    },
+    {   // kIOHIDResourceDeviceUserClientMethodHandleReportBatch
+        (IOExternalMethodAction) &IOHIDResourceDeviceUserClient::_handleReportBatch,
+        0, kIOUCVariableStructureSize, /* 1 struct input : the packed reports */
+        0, kIOUCVariableStructureSize, /* 1 struct output : the status of each report */
+        true
+    },
 };
 
 
@@ -148,7 +184,14 @@ bool IOHIDResourceDeviceUserClient::initWithTask(task_t owningTask, void * secur
       goto exit;
     }
     
-    _pending            = OSSet::withCapacity(4);
+    _pending            = IONew(PendingReport, kPendingReportSlotCount);
+    require_action(_pending, exit, result = false);
+    
+    bzero(_pending, sizeof(PendingReport) * kPendingReportSlotCount);
+    for (uint32_t index = 0; index < kPendingReportSlotCount; index++) {
+        _pending[index].nextFree = index + 1 < kPendingReportSlotCount ? index + 1 : kPendingReportSlotNone;
+    }
+    _pendingFree        = 0;
     _maxClientTimeoutUS = kIOHIDDeviceDefaultAsyncRequestTimeout * 1000;
     _owningTask = owningTask;
     _overSizedReports = OSArray::withCapacity(2);
@@ -250,12 +293,15 @@ void IOHIDResourceDeviceUserClient::free()
         _asyncReportTimer->release();
     
     if (_pending) {
-        _pending->release();
+        IODelete(_pending, PendingReport, kPendingReportSlotCount);
     }
     
     if ( _queue )
         _queue->release();
     
+    OSSafeReleaseNULL(_reportRing);
+    OSSafeReleaseNULL(_reportBuffer);
+    
     if ( _owner )
         _owner->release();
 
@@ -319,13 +365,13 @@ exit:
 //----------------------------------------------------------------------------------------------------
 // IOHIDResourceDeviceUserClient::clientMemoryForType
 //----------------------------------------------------------------------------------------------------
-IOReturn IOHIDResourceDeviceUserClient::clientMemoryForType(UInt32 type __unused, IOOptionBits * options, IOMemoryDescriptor ** memory )
+IOReturn IOHIDResourceDeviceUserClient::clientMemoryForType(UInt32 type, IOOptionBits * options, IOMemoryDescriptor ** memory )
 {
     IOReturn result;
     
     require_action(!isInactive(), exit, result=kIOReturnOffline);
 
-    result = _commandGate->runAction(OSMemberFunctionCast(IOCommandGate::Action, this, &IOHIDResourceDeviceUserClient::clientMemoryForTypeGated), options, memory);
+    result = _commandGate->runAction(OSMemberFunctionCast(IOCommandGate::Action, this, &IOHIDResourceDeviceUserClient::clientMemoryForTypeGated), (void *)(uintptr_t)type, options, memory);
     
 exit:
     return result;
@@ -334,21 +380,47 @@ exit:
 //----------------------------------------------------------------------------------------------------
 // IOHIDResourceDeviceUserClient::clientMemoryForTypeGated
 //----------------------------------------------------------------------------------------------------
-IOReturn IOHIDResourceDeviceUserClient::clientMemoryForTypeGated(IOOptionBits * options, IOMemoryDescriptor ** memory )
+IOReturn IOHIDResourceDeviceUserClient::clientMemoryForTypeGated(UInt32 type, IOOptionBits * options, IOMemoryDescriptor ** memory )
 {
     IOReturn ret;
     IOMemoryDescriptor * memoryToShare = NULL;
     
     require_action(!isInactive(), exit, ret=kIOReturnOffline);
     
-    if ( !_queue ) {
-        _queue = IOHIDResourceQueue::withCapacity(this, kHIDQueueSize);
+    switch (type) {
+        case kIOHIDResourceUserClientMemoryTypeQueue:
+            if ( !_queue ) {
+                _queue = IOHIDResourceQueue::withCapacity(this, kHIDQueueSize);
+            }
+            
+            require_action(_queue, exit, ret = kIOReturnNoMemory);
+            
+            memoryToShare = _queue->getMemoryDescriptor();
+            require_action(memoryToShare, exit, ret = kIOReturnNoMemory);
+            break;
+            
+        case kIOHIDResourceUserClientMemoryTypeReportRing:
+            if ( !_reportRing ) {
+                IOHIDResourceReportRingHeader * ring;
+                
+                _reportRing = IOBufferMemoryDescriptor::withOptions(kIODirectionInOut | kIOMemoryKernelUserShared,
+                                                                    sizeof(IOHIDResourceReportRingHeader) + kHIDReportRingSize,
+                                                                    page_size);
+                require_action(_reportRing, exit, ret = kIOReturnNoMemory);
+                
+                ring = (IOHIDResourceReportRingHeader *)_reportRing->getBytesNoCopy();
+                bzero(ring, _reportRing->getLength());
+                ring->size = kHIDReportRingSize;
+                _reportRingHead = 0;
+            }
+            
+            memoryToShare = _reportRing;
+            break;
+            
+        default:
+            ret = kIOReturnBadArgument;
+            goto exit;
     }
-    
-    require_action(_queue, exit, ret = kIOReturnNoMemory);
-    
-    memoryToShare = _queue->getMemoryDescriptor();
-    require_action(memoryToShare, exit, ret = kIOReturnNoMemory);
 
     memoryToShare->retain();
 
@@ -640,6 +712,269 @@ IOReturn IOHIDResourceDeviceUserClient::_handleReport(IOHIDResourceDeviceUserCli
     return target->handleReport(arguments);
 }
 
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::stageReport
+//----------------------------------------------------------------------------------------------------
+IOMemoryDescriptor * IOHIDResourceDeviceUserClient::stageReport(const void * bytes, uint32_t length)
+{
+    // Reports posted through the ring or a batch are copied into a buffer
+    // owned by the kernel before being handed to the device, so the user
+    // process can never modify a report while it is being parsed. The buffer
+    // is reused for every report since handleReportWithTime is synchronous.
+    require_action(length <= kMaxStagedReportSize, exit, HIDLogError("report too large: %u", length));
+    
+    if (!_reportBuffer || _reportBuffer->getCapacity() < length) {
+        OSSafeReleaseNULL(_reportBuffer);
+        _reportBuffer = IOBufferMemoryDescriptor::withCapacity(MAX(length, kMaxQueueReportSize), kIODirectionOut);
+        require(_reportBuffer, exit);
+    }
+    
+    _reportBuffer->setLength(length);
+    bcopy(bytes, _reportBuffer->getBytesNoCopy(), length);
+    
+    return _reportBuffer;
+    
+exit:
+    return NULL;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::handleReportBatch
+//----------------------------------------------------------------------------------------------------
+IOReturn IOHIDResourceDeviceUserClient::handleReportBatch(IOExternalMethodArguments * arguments)
+{
+    IOBufferMemoryDescriptor * batchDesc = NULL;
+    const uint8_t *         batch       = NULL;
+    size_t                  batchSize   = 0;
+    IOReturn *              statuses    = (IOReturn *)arguments->structureOutput;
+    uint32_t                count       = 0;
+    size_t                  offset;
+    bool                    submitted   = false;
+    IOReturn                ret         = kIOReturnSuccess;
+    
+    require_action(_device, exit, ret = kIOReturnNotOpen; HIDLogError("failed : device is NULL"));
+    
+    if (arguments->structureInputDescriptor) {
+        batchDesc = OSDynamicCast(IOBufferMemoryDescriptor, createMemoryDescriptorFromInputArguments(arguments));
+        require_action(batchDesc, exit, ret = kIOReturnNoMemory; HIDLogError("failed : could not create descriptor"));
+        
+        batch       = (const uint8_t *)batchDesc->getBytesNoCopy();
+        batchSize   = batchDesc->getLength();
+    } else {
+        batch       = (const uint8_t *)arguments->structureInput;
+        batchSize   = arguments->structureInputSize;
+    }
+    
+    // Validate the whole batch up front, so a malformed batch submits nothing.
+    for (offset = 0; offset < batchSize; count++) {
+        const IOHIDResourceReportRingEntry * entry = (const IOHIDResourceReportRingEntry *)(batch + offset);
+        size_t entrySize;
+        
+        require_action(count < kIOHIDResourceReportBatchMaxCount, exit, ret = kIOReturnBadArgument);
+        require_action(batchSize - offset >= sizeof(IOHIDResourceReportRingEntry), exit, ret = kIOReturnBadArgument);
+        require_action(entry->length && entry->length <= kMaxStagedReportSize, exit, ret = kIOReturnBadArgument);
+        
+        entrySize = IOHIDResourceReportRingEntrySize((size_t)entry->length);
+        require_action(entrySize <= batchSize - offset || sizeof(IOHIDResourceReportRingEntry) + entry->length == batchSize - offset, exit, ret = kIOReturnBadArgument);
+        
+        offset += entrySize;
+    }
+    
+    require_action(count, exit, ret = kIOReturnBadArgument);
+    require_action(!arguments->structureOutputSize || arguments->structureOutputSize >= count * sizeof(IOReturn), exit, ret = kIOReturnBadArgument);
+    
+    if (!arguments->structureOutputSize) {
+        statuses = NULL;
+    }
+    
+    // Reports are submitted in order. The batch fails with the status of the
+    // first report that failed, and later reports are still submitted.
+    submitted = true;
+    offset = 0;
+    
+    for (uint32_t index = 0; index < count; index++) {
+        const IOHIDResourceReportRingEntry *    entry = (const IOHIDResourceReportRingEntry *)(batch + offset);
+        IOMemoryDescriptor *                    report;
+        AbsoluteTime                            timestamp;
+        IOReturn                                status;
+        
+        if (entry->timestamp) {
+            AbsoluteTime_to_scalar(&timestamp) = entry->timestamp;
+        } else {
+            clock_get_uptime(&timestamp);
+        }
+        
+        report = stageReport(entry->report, entry->length);
+        if (report) {
+            _handleReportCount++;
+            status = _device->handleReportWithTime(timestamp, report);
+        } else {
+            status = kIOReturnNoMemory;
+        }
+        
+        if (statuses) {
+            statuses[index] = status;
+        }
+        
+        if (ret == kIOReturnSuccess) {
+            ret = status;
+        }
+        
+        offset += IOHIDResourceReportRingEntrySize((size_t)entry->length);
+    }
+    
+    _handleReportBatchCount++;
+    
+    if (statuses) {
+        arguments->structureOutputSize = count * sizeof(IOReturn);
+    }
+    
+exit:
+    // Async callers get a single completion for the whole batch, carrying the
+    // batch status and the number of reports submitted.
+    if (arguments->asyncWakePort && submitted) {
+        io_user_reference_t args[1] = { count };
+        
+        sendAsyncResult64(arguments->asyncReference, ret, args, 1);
+        ret = kIOReturnSuccess;
+    }
+    
+    OSSafeReleaseNULL(batchDesc);
+    
+    return ret;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::_handleReportBatch
+//----------------------------------------------------------------------------------------------------
+IOReturn IOHIDResourceDeviceUserClient::_handleReportBatch(IOHIDResourceDeviceUserClient *target,
+                                                           void                          *reference __unused,
+                                                           IOExternalMethodArguments     *arguments)
+{
+    return target->handleReportBatch(arguments);
+}
+
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::drainReportRing
+//----------------------------------------------------------------------------------------------------
+IOReturn IOHIDResourceDeviceUserClient::drainReportRing(IOExternalMethodArguments * arguments)
+{
+    IOHIDResourceReportRingHeader * ring;
+    IOReturn                        ret     = kIOReturnSuccess;
+    uint32_t                        head    = _reportRingHead;
+    uint32_t                        tail    = 0;
+    uint64_t                        count   = 0;
+    
+    require_action(_device, exit, ret = kIOReturnNotOpen; HIDLogError("failed : device is NULL"));
+    require_action(_reportRing, exit, ret = kIOReturnNotReady); // client has not mapped the ring
+    
+    ring = (IOHIDResourceReportRingHeader *)_reportRing->getBytesNoCopy();
+    
+    _reportRingDrainCount++;
+    
+    // head is owned by the kernel, and is never read back from shared memory.
+    tail = __c11_atomic_load((_Atomic uint32_t *)&ring->tail, __ATOMIC_ACQUIRE);
+    require_action(ReportRingOffsetIsValid(tail), exit, ret = kIOReturnBadArgument);
+    
+    while (head != tail) {
+        // Bytes published between head and tail, counting any skipped to wrap.
+        // Every entry and wrap has to fit in them, so the loop ends once they
+        // are consumed whatever the producer wrote.
+        uint32_t used = (tail + kHIDReportRingSize - head) % kHIDReportRingSize;
+        
+        while (used) {
+            IOHIDResourceReportRingEntry *  entry;
+            IOMemoryDescriptor *            report;
+            AbsoluteTime                    timestamp;
+            uint32_t                        length;
+            uint64_t                        entrySize;
+            
+            if (kHIDReportRingSize - head < sizeof(IOHIDResourceReportRingEntry)) {
+                require_action(kHIDReportRingSize - head <= used, exit, ret = kIOReturnBadArgument);
+                used -= kHIDReportRingSize - head;
+                head = 0;
+                continue;
+            }
+            
+            entry = (IOHIDResourceReportRingEntry *)(ring->data + head);
+            AbsoluteTime_to_scalar(&timestamp) = __c11_atomic_load((_Atomic uint64_t *)&entry->timestamp, __ATOMIC_RELAXED);
+            length = __c11_atomic_load((_Atomic uint32_t *)&entry->length, __ATOMIC_RELAXED);
+            
+            if (length == kIOHIDResourceReportRingWrap) {
+                require_action(kHIDReportRingSize - head <= used, exit, ret = kIOReturnBadArgument);
+                used -= kHIDReportRingSize - head;
+                head = 0;
+                continue;
+            }
+            
+            // Bound length before rounding it up, so a length near UINT32_MAX
+            // cannot wrap entrySize into something that fits.
+            require_action(length && (uint64_t)length <= (uint64_t)kHIDReportRingSize - head - sizeof(IOHIDResourceReportRingEntry), exit, ret = kIOReturnBadArgument);
+            require_action(length <= kMaxStagedReportSize, exit, ret = kIOReturnBadArgument);
+            
+            entrySize = IOHIDResourceReportRingEntrySize((uint64_t)length);
+            require_action(entrySize <= (uint64_t)kHIDReportRingSize - head && entrySize <= used, exit, ret = kIOReturnBadArgument);
+            
+            report = stageReport(entry->report, length);
+            require_action(report, exit, ret = kIOReturnNoMemory);
+            
+            head = (uint32_t)((head + entrySize) % kHIDReportRingSize);
+            used -= (uint32_t)entrySize;
+            
+            if (!AbsoluteTime_to_scalar(&timestamp)) {
+                clock_get_uptime(&timestamp);
+            }
+            
+            _handleReportCount++;
+            _reportRingCount++;
+            count++;
+            
+            _device->handleReportWithTime(timestamp, report);
+        }
+        
+        // Publish head, then look at tail again. This pairs with the fence the
+        // producer issues between publishing tail and reading head, so either
+        // we see the new entry here or the producer sees the ring empty and
+        // rings the doorbell.
+        _reportRingHead = head;
+        __c11_atomic_store((_Atomic uint32_t *)&ring->head, head, __ATOMIC_RELEASE);
+        __c11_atomic_thread_fence(__ATOMIC_SEQ_CST);
+        tail = __c11_atomic_load((_Atomic uint32_t *)&ring->tail, __ATOMIC_ACQUIRE);
+        require_action(ReportRingOffsetIsValid(tail), exit, ret = kIOReturnBadArgument);
+    }
+    
+exit:
+    if (ret == kIOReturnBadArgument) {
+        // The producer corrupted the ring. Discard everything it has posted so
+        // far rather than try to resynchronize on untrusted offsets.
+        HIDLogError("0x%llx: IOHIDUserDevice report ring corrupt head:%u tail:%u", getRegistryEntryID(), head, tail);
+        _reportRingErrorCount++;
+        head = ReportRingOffsetIsValid(tail) ? tail : 0;
+    }
+    
+    if (_reportRing && head != _reportRingHead) {
+        ring = (IOHIDResourceReportRingHeader *)_reportRing->getBytesNoCopy();
+        _reportRingHead = head;
+        __c11_atomic_store((_Atomic uint32_t *)&ring->head, head, __ATOMIC_RELEASE);
+    }
+    
+    if (arguments->scalarOutputCount) {
+        arguments->scalarOutput[0] = count;
+    }
+    
+    return ret;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::_drainReportRing
+//----------------------------------------------------------------------------------------------------
+IOReturn IOHIDResourceDeviceUserClient::_drainReportRing(IOHIDResourceDeviceUserClient *target,
+                                                         void                          *reference __unused,
+                                                         IOExternalMethodArguments     *arguments)
+{
+    return target->drainReportRing(arguments);
+}
+
 //----------------------------------------------------------------------------------------------------
 // IOHIDResourceDeviceUserClient::getReport
 //----------------------------------------------------------------------------------------------------
@@ -667,36 +1002,26 @@ exit:
 IOReturn IOHIDResourceDeviceUserClient::getReportGated(ReportGatedArguments * arguments)
 {
     IOHIDResourceDataQueueHeader    header;
-    __ReportResult                  result;
     IOReturn                        ret = kIOReturnSuccess;
-    OSValueObject<__ReportResult> * retData = NULL;
+    PendingReport *                 pending = NULL;
     bool                            async = arguments->completion && arguments->completion->action;
     
     require_action(!isInactive() && !_suspended, exit, ret=kIOReturnOffline);
 
-    arguments->completionTimeout = async && arguments->completionTimeout >= kIOHIDDeviceMinAsyncRequestTimeout && arguments->completionTimeout <= kIOHIDDeviceMaxAsyncRequestTimeout ? arguments->completionTimeout * 1000 : _maxClientTimeoutUS;
-    clock_interval_to_deadline(arguments->completionTimeout, kMicrosecondScale, &result.deadline);
-
-    result.ret        = kIOReturnError;
-    result.descriptor = arguments->report;
-    result.token      = _tokenIndex++;
-    result.completion = async ? *arguments->completion : (IOHIDCompletion){NULL, NULL, NULL};
-
-    retData = OSValueObject<__ReportResult>::withValue(result);
-
-    require_action(retData, exit, ret=kIOReturnNoMemory);
+    pending = allocPendingReport(kIOHIDResourceReportDirectionIn, arguments);
+    require_action(pending, exit, ret=kIOReturnNoResources; _pendingExhaustedCount++);
+    
+    pending->descriptor = arguments->report;
+    if (pending->descriptor) {
+        pending->descriptor->retain();
+    }
     
     header.direction   = kIOHIDResourceReportDirectionIn;
     header.type        = arguments->reportType;
     header.reportID    = arguments->options & 0xff;
     header.length      = (uint32_t)arguments->report->getLength();
-    header.token       = result.token;
+    header.token       = pending->token;
     header.reportFlags = 0;
-
-    _pending->setObject(retData);
-    if (result.descriptor) {
-        result.descriptor->retain();
-    }
     
     require_action(_queue, exit, ret = kIOReturnNotReady); // client has not mapped memory
     require_action(_port, exit, ret = kIOReturnOffline); // client has not registered a port
@@ -715,10 +1040,9 @@ IOReturn IOHIDResourceDeviceUserClient::getReportGated(ReportGatedArguments * ar
         setNextAsyncTimeout();
         _outstandingAsyncCount++;
     } else {
-        const __ReportResult& resultRef = retData->getRef();
-        switch (_commandGate->commandSleep(retData, resultRef.deadline, THREAD_ABORTSAFE)) {
+        switch (_commandGate->commandSleep(pending, pending->deadline, THREAD_ABORTSAFE)) {
             case THREAD_AWAKENED:
-                ret = resultRef.ret;
+                ret = pending->ret;
                 _getReportCompletedCount++;
                 break;
             case THREAD_TIMED_OUT:
@@ -733,14 +1057,13 @@ IOReturn IOHIDResourceDeviceUserClient::getReportGated(ReportGatedArguments * ar
     }
     
 exit:
-    if (retData && (!async || ret)) {
-        _pending->removeObject(retData);
-        OSSafeReleaseNULL(result.descriptor);
+    if (pending && (!async || ret)) {
+        OSSafeReleaseNULL(pending->descriptor);
+        freePendingReport(pending);
         if (!async) {
             _commandGate->commandWakeup(&_pending);
         }
     }
-    OSSafeReleaseNULL(retData);
     return ret;
 }
 
@@ -771,34 +1094,23 @@ exit:
 IOReturn IOHIDResourceDeviceUserClient::setReportGated(ReportGatedArguments * arguments)
 {
     IOHIDResourceDataQueueHeader    header;
-    __ReportResult                  result;
     IOReturn                        ret = kIOReturnSuccess;
-    OSValueObject<__ReportResult> * retData = NULL;
+    PendingReport *                 pending = NULL;
     IOMemoryDescriptor *            report = arguments->report;
     bool                            async = arguments->completion && arguments->completion->action;
 
+    header.reportFlags = 0;
+    
     require_action(!isInactive() && !_suspended, exit, ret = kIOReturnOffline);
     
-    arguments->completionTimeout = async && arguments->completionTimeout >= kIOHIDDeviceMinAsyncRequestTimeout && arguments->completionTimeout <= kIOHIDDeviceMaxAsyncRequestTimeout ? arguments->completionTimeout * 1000 : _maxClientTimeoutUS;
-    clock_interval_to_deadline(arguments->completionTimeout, kMicrosecondScale, &result.deadline);
-
-    result.ret        = kIOReturnError;
-    result.descriptor = NULL;
-    result.token      = _tokenIndex++;
-    result.completion = async ? *arguments->completion : (IOHIDCompletion){NULL, NULL, NULL};
-
-    retData = OSValueObject<__ReportResult>::withValue(result);
-
-    require_action(retData, exit, ret = kIOReturnNoMemory);
+    pending = allocPendingReport(kIOHIDResourceReportDirectionOut, arguments);
+    require_action(pending, exit, ret = kIOReturnNoResources; _pendingExhaustedCount++);
     
     header.direction   = kIOHIDResourceReportDirectionOut;
     header.type        = arguments->reportType;
     header.reportID    = arguments->options & 0xff;
     header.length      = (uint32_t)report->getLength();
-    header.token       = result.token;
-    header.reportFlags = 0;
-
-    _pending->setObject(retData);
+    header.token       = pending->token;
     
     require_action(_queue, exit, ret = kIOReturnNotReady); // client has not mapped memory
     require_action(_port, exit, ret = kIOReturnOffline); // client has not registered a port
@@ -842,10 +1154,9 @@ IOReturn IOHIDResourceDeviceUserClient::setReportGated(ReportGatedArguments * ar
         setNextAsyncTimeout();
         _outstandingAsyncCount++;
     } else {
-        const __ReportResult& resultRef = retData->getRef();
-        switch (_commandGate->commandSleep(retData, resultRef.deadline, THREAD_ABORTSAFE)) {
+        switch (_commandGate->commandSleep(pending, pending->deadline, THREAD_ABORTSAFE)) {
             case THREAD_AWAKENED:
-                ret = resultRef.ret;
+                ret = pending->ret;
                 _setReportCompletedCount++;
                 break;
             case THREAD_TIMED_OUT:
@@ -860,13 +1171,12 @@ IOReturn IOHIDResourceDeviceUserClient::setReportGated(ReportGatedArguments * ar
     }
 
 exit:
-    if (retData && (!async || ret)) {
-        _pending->removeObject(retData);
+    if (pending && (!async || ret)) {
+        freePendingReport(pending);
         if (!async) {
             _commandGate->commandWakeup(&_pending);
         }
     }
-    OSSafeReleaseNULL(retData);
 
     if (header.reportFlags & kIOHIDResourceOOBReport) {
         report->release();
@@ -875,99 +1185,166 @@ exit:
     return ret;
 }
 
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::allocPendingReport
+//----------------------------------------------------------------------------------------------------
+IOHIDResourceDeviceUserClient::PendingReport * IOHIDResourceDeviceUserClient::allocPendingReport(IOHIDResourceReportDirection direction, ReportGatedArguments * arguments)
+{
+    PendingReport * pending = NULL;
+    bool            async   = arguments->completion && arguments->completion->action;
+    uint32_t        index   = _pendingFree;
+    
+    require_action(index != kPendingReportSlotNone, exit, HIDLogError("0x%llx: IOHIDUserDevice has too many pending requests", getRegistryEntryID()));
+    
+    pending         = &_pending[index];
+    _pendingFree    = pending->nextFree;
+    _pendingCount++;
+    
+    arguments->completionTimeout = async && arguments->completionTimeout >= kIOHIDDeviceMinAsyncRequestTimeout && arguments->completionTimeout <= kIOHIDDeviceMaxAsyncRequestTimeout ? arguments->completionTimeout * 1000 : _maxClientTimeoutUS;
+    clock_interval_to_deadline(arguments->completionTimeout, kMicrosecondScale, &pending->deadline);
+    
+    pending->ret        = kIOReturnError;
+    pending->descriptor = NULL;
+    pending->token      = (_tokenIndex++ << kPendingReportSlotShift) | index;
+    pending->completion = async ? *arguments->completion : (IOHIDCompletion){NULL, NULL, NULL};
+    pending->startTime  = mach_absolute_time();
+    pending->direction  = direction;
+    pending->state      = kPendingReportStatePending;
+    pending->nextFree   = kPendingReportSlotNone;
+    
+exit:
+    return pending;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::freePendingReport
+//----------------------------------------------------------------------------------------------------
+void IOHIDResourceDeviceUserClient::freePendingReport(PendingReport * pending)
+{
+    uint32_t index = (uint32_t)(pending - _pending);
+    
+    pending->state      = kPendingReportStateFree;
+    pending->token      = 0;
+    pending->nextFree   = _pendingFree;
+    _pendingFree        = index;
+    _pendingCount--;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IOHIDResourceDeviceUserClient::recordPendingReportLatency
+//----------------------------------------------------------------------------------------------------
+void IOHIDResourceDeviceUserClient::recordPendingReportLatency(PendingReport * pending)
+{
+    uint64_t    latencyUS;
+    uint32_t    bucket = 0;
+    
+    absolutetime_to_nanoseconds(mach_absolute_time() - pending->startTime, &latencyUS);
+    latencyUS /= 1000;
+    
+    // Bucket n counts requests that completed in [2^(n-1), 2^n) us.
+    while (latencyUS && bucket < kReportLatencyBucketCount - 1) {
+        latencyUS >>= 1;
+        bucket++;
+    }
+    
+    if (pending->direction == kIOHIDResourceReportDirectionIn) {
+        _getReportLatency[bucket]++;
+    } else {
+        _setReportLatency[bucket]++;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 // IOHIDResourceDeviceUserClient::postReportResult
 //----------------------------------------------------------------------------------------------------
 IOReturn IOHIDResourceDeviceUserClient::postReportResult(IOExternalMethodArguments * arguments)
 {
-    __block OSObject * target = NULL;
-    __block IOReturn result = kIOReturnNotFound;
-    __block IOByteCount descriptorLength = 0;
-    __block __ReportResult * pResult = NULL;
+    IOReturn        result              = kIOReturnNotFound;
+    IOByteCount     descriptorLength    = 0;
+    PendingReport * pending;
     
     u_int64_t token = (u_int64_t)arguments->scalarInput[kIOHIDResourceUserClientResponseIndexToken];
     
-    _pending->iterateObjects(^bool(OSObject * object) {
+    pending = &_pending[token & kPendingReportSlotMask];
+    require(pending->state == kPendingReportStatePending && pending->token == token, exit);
+    
+    recordPendingReportLatency(pending);
+    
+    if ( pending->descriptor && arguments->structureInputDescriptor ){
         IOMemoryDescriptor * reportDescriptor = NULL;
         IOMemoryMap * reportMap = NULL;
+        
+        // response > 4K, we got a memory descriptor from the response.
 
-        pResult = (__ReportResult*)((OSValueObject<__ReportResult>*)object)->getBytesNoCopy();
+        // Check that the HIDUserDevice didn't change the report size over the allocated size.
+        descriptorLength = pending->descriptor->getLength();
 
-        if (pResult->token != token) {
-            pResult = NULL;
-            return false;
+        if (descriptorLength < arguments->structureInputDescriptor->getLength()) {
+            pending->ret = kIOReturnOverrun;
+            result = kIOReturnOverrun;
+            HIDLogError("Invalid report length expected : %d got : %d",(int)descriptorLength, (int)arguments->structureInputSize);
+            goto complete;
+        }
+        // Map result into kernel task
+        reportDescriptor = arguments->structureInputDescriptor;
+        reportMap = reportDescriptor->map(kIOMapReadOnly);
+        if (!reportMap) {
+            pending->ret = kIOReturnNoMemory;
+            result = kIOReturnNoMemory;
+            HIDLogError("Failed to map report, could not copy results of get report.");
+            goto complete;
         }
-        target = object;
-
-        if ( pResult->descriptor && arguments->structureInputDescriptor ){
-            // response > 4K, we got a memory descriptor from the response.
-
-            // Check that the HIDUserDevice didn't change the report size over the allocated size.
-            descriptorLength = pResult->descriptor->getLength();
-
-            if (descriptorLength < arguments->structureInputDescriptor->getLength()) {
-                pResult->ret = kIOReturnOverrun;
-                result = kIOReturnOverrun;
-                HIDLogError("Invalid report length expected : %d got : %d",(int)descriptorLength, (int)arguments->structureInputSize);
-                return true;
-            }
-            // Map result into kernel task
-            reportDescriptor = arguments->structureInputDescriptor;
-            reportMap = reportDescriptor->map(kIOMapReadOnly);
-            if (!reportMap) {
-                pResult->ret = kIOReturnNoMemory;
-                result = kIOReturnNoMemory;
-                HIDLogError("Failed to map report, could not copy results of get report.");
-                return true;
-            }
 
-            pResult->descriptor->writeBytes(0, (void*)reportMap->getVirtualAddress(), reportDescriptor->getLength());
+        pending->descriptor->writeBytes(0, (void*)reportMap->getVirtualAddress(), reportDescriptor->getLength());
 
-            OSSafeReleaseNULL(reportMap);
-            // 12978252:  If we get an IOBMD passed in, set the length to be the # of bytes that were transferred
-            IOBufferMemoryDescriptor * buffer = OSDynamicCast(IOBufferMemoryDescriptor, pResult->descriptor);
-            if (buffer)
-                buffer->setLength(MIN((vm_size_t)reportDescriptor->getLength(), buffer->getCapacity()));
-        } else if ( pResult->descriptor && arguments->structureInput ) {
-            
-            // HID User device API with length allows caller to modify return length
-            // which can be greater than orginal length of descriptor, we should check
-            // that here
-            descriptorLength = pResult->descriptor->getLength();
-
-            if (descriptorLength < arguments->structureInputSize) {
-                pResult->ret = kIOReturnOverrun;
-                result = kIOReturnOverrun;
-                HIDLogError("Invalid report length expected : %d got : %d",(int)descriptorLength, (int)arguments->structureInputSize);
-                return true;
-            }
+        OSSafeReleaseNULL(reportMap);
+        // 12978252:  If we get an IOBMD passed in, set the length to be the # of bytes that were transferred
+        IOBufferMemoryDescriptor * buffer = OSDynamicCast(IOBufferMemoryDescriptor, pending->descriptor);
+        if (buffer)
+            buffer->setLength(MIN((vm_size_t)reportDescriptor->getLength(), buffer->getCapacity()));
+    } else if ( pending->descriptor && arguments->structureInput ) {
         
-            pResult->descriptor->writeBytes(0, arguments->structureInput, arguments->structureInputSize);
-            
-            // 12978252:  If we get an IOBMD passed in, set the length to be the # of bytes that were transferred
-            IOBufferMemoryDescriptor * buffer = OSDynamicCast(IOBufferMemoryDescriptor, pResult->descriptor);
-            if (buffer)
-                buffer->setLength(MIN((vm_size_t)arguments->structureInputSize, buffer->getCapacity()));
+        // HID User device API with length allows caller to modify return length
+        // which can be greater than orginal length of descriptor, we should check
+        // that here
+        descriptorLength = pending->descriptor->getLength();
+
+        if (descriptorLength < arguments->structureInputSize) {
+            pending->ret = kIOReturnOverrun;
+            result = kIOReturnOverrun;
+            HIDLogError("Invalid report length expected : %d got : %d",(int)descriptorLength, (int)arguments->structureInputSize);
+            goto complete;
         }
+    
+        pending->descriptor->writeBytes(0, arguments->structureInput, arguments->structureInputSize);
         
-        pResult->ret = (IOReturn)arguments->scalarInput[kIOHIDResourceUserClientResponseIndexResult];
-        
-        result = kIOReturnSuccess;
-        return true;
-    });
+        // 12978252:  If we get an IOBMD passed in, set the length to be the # of bytes that were transferred
+        IOBufferMemoryDescriptor * buffer = OSDynamicCast(IOBufferMemoryDescriptor, pending->descriptor);
+        if (buffer)
+            buffer->setLength(MIN((vm_size_t)arguments->structureInputSize, buffer->getCapacity()));
+    }
+    
+    pending->ret = (IOReturn)arguments->scalarInput[kIOHIDResourceUserClientResponseIndexResult];
+    
+    result = kIOReturnSuccess;
 
-    if (pResult) {
-        if (pResult->completion.action) {
-            pResult->completion.action(pResult->completion.target, pResult->completion.parameter, pResult->ret, (uint32_t)(descriptorLength - (pResult->descriptor ? pResult->descriptor->getLength() : 0)));
-            OSSafeReleaseNULL(pResult->descriptor);
-            _pending->removeObject(target);
-            setNextAsyncTimeout();
-            _outstandingAsyncCount--;
-        } else {
-            _commandGate->commandWakeup(target);
-        }
+complete:
+    if (pending->completion.action) {
+        IOHIDCompletion completion  = pending->completion;
+        IOReturn        ret         = pending->ret;
+        UInt32          remaining   = (uint32_t)(descriptorLength - (pending->descriptor ? pending->descriptor->getLength() : 0));
+        
+        OSSafeReleaseNULL(pending->descriptor);
+        freePendingReport(pending);
+        _outstandingAsyncCount--;
+        setNextAsyncTimeout();
+        
+        completion.action(completion.target, completion.parameter, ret, remaining);
+    } else {
+        _commandGate->commandWakeup(pending);
     }
 
+exit:
     return result;
 }
 
@@ -982,55 +1359,56 @@ IOReturn IOHIDResourceDeviceUserClient::_postReportResult(IOHIDResourceDeviceUse
 }
 
 //----------------------------------------------------------------------------------------------------
-// IOHIDResourceDeviceUserClient::cleanupAsyncReports
+// IOHIDResourceDeviceUserClient::setNextAsyncTimeout
 //----------------------------------------------------------------------------------------------------
 void IOHIDResourceDeviceUserClient::setNextAsyncTimeout()
 {
-    __block AbsoluteTime nextDeadline = UINT64_MAX;
-    OSSet              * set          = OSSet::withSet(_pending);
-    OSSet              * timedOut     = OSSet::withCapacity(set->getCount());
-    require_action(set, exit, HIDLogError("Failed to allocate pending set copy"));
-    require_action(timedOut, exit, HIDLogError("Failed to allocate set for requests that timed out"));
+    AbsoluteTime    nextDeadline    = UINT64_MAX;
+    AbsoluteTime    now             = mach_absolute_time();
 
     _asyncReportTimer->cancelTimeout();
 
-    // TODO: Decide if there is a better way to iterate pending. Iterators fail if the collection is modified, and sets do not use indices. Switch to array?
-    set->iterateObjects(^bool(OSObject * object) {
-        __ReportResult * pResult = (__ReportResult*)((OSValueObject<__ReportResult>*)object)->getBytesNoCopy();
-
-        if (!pResult->completion.action) {
-            return false;
+    // Mark expired requests first and arm the timer for the rest, so that
+    // completions that issue new requests see a consistent table.
+    for (uint32_t index = 0; index < kPendingReportSlotCount; index++) {
+        PendingReport * pending = &_pending[index];
+        
+        if (pending->state != kPendingReportStatePending || !pending->completion.action) {
+            continue;
         }
-
-        if (pResult->deadline > mach_absolute_time()) {
-            if (pResult->deadline < nextDeadline) {
-                nextDeadline = pResult->deadline;
+        
+        if (pending->deadline > now) {
+            if (pending->deadline < nextDeadline) {
+                nextDeadline = pending->deadline;
             }
-            return false;
+            continue;
         }
-
-        timedOut->setObject(object);
-        _pending->removeObject(object);
+        
+        pending->state = kPendingReportStateTimedOut;
         _outstandingAsyncCount--;
-        return false;
-    });
+    }
 
     if (nextDeadline < UINT64_MAX) {
         _asyncReportTimer->wakeAtTime(nextDeadline);
     }
 
-    timedOut->iterateObjects(^bool(OSObject *object) {
-        __ReportResult * pResult = (__ReportResult*)((OSValueObject<__ReportResult>*)object)->getBytesNoCopy();
-
-        pResult->completion.action(pResult->completion.target, pResult->completion.parameter, kIOReturnTimeout, pResult->descriptor ? (uint32_t)pResult->descriptor->getLength() : 0);
-        OSSafeReleaseNULL(pResult->descriptor);
-        return false;
-    });
-
-exit:
-    OSSafeReleaseNULL(set);
-    OSSafeReleaseNULL(timedOut);
-    return;
+    for (uint32_t index = 0; index < kPendingReportSlotCount; index++) {
+        PendingReport * pending = &_pending[index];
+        IOHIDCompletion completion;
+        UInt32          remaining;
+        
+        if (pending->state != kPendingReportStateTimedOut) {
+            continue;
+        }
+        
+        completion  = pending->completion;
+        remaining   = pending->descriptor ? (uint32_t)pending->descriptor->getLength() : 0;
+        
+        OSSafeReleaseNULL(pending->descriptor);
+        freePendingReport(pending);
+        
+        completion.action(completion.target, completion.parameter, kIOReturnTimeout, remaining);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1038,33 +1416,34 @@ exit:
 //----------------------------------------------------------------------------------------------------
 void IOHIDResourceDeviceUserClient::cleanupPendingReports()
 {
-    OSSet * set = OSSet::withSet(_pending);
-    require_action(set, exit, HIDLogError("Failed to allocate pending set copy"));
-
     _asyncReportTimer->cancelTimeout();
     
-    set->iterateObjects(^bool(OSObject * object) {
-        __ReportResult * pResult = (__ReportResult*)((OSValueObject<__ReportResult>*)object)->getBytesNoCopy();
-
-        pResult->ret = kIOReturnAborted;
+    for (uint32_t index = 0; index < kPendingReportSlotCount; index++) {
+        PendingReport * pending = &_pending[index];
+        
+        if (pending->state != kPendingReportStatePending) {
+            continue;
+        }
+        
+        pending->ret = kIOReturnAborted;
 
-        if (pResult->completion.action) {
-            pResult->completion.action(pResult->completion.target, pResult->completion.parameter, pResult->ret, pResult->descriptor ? (uint32_t)pResult->descriptor->getLength() : 0);
-            OSSafeReleaseNULL(pResult->descriptor);
-            _pending->removeObject(object);
+        if (pending->completion.action) {
+            IOHIDCompletion completion  = pending->completion;
+            UInt32          remaining   = pending->descriptor ? (uint32_t)pending->descriptor->getLength() : 0;
+            
+            OSSafeReleaseNULL(pending->descriptor);
+            freePendingReport(pending);
             _outstandingAsyncCount--;
+            
+            completion.action(completion.target, completion.parameter, kIOReturnAborted, remaining);
         } else {
-            _commandGate->commandWakeup(object);
+            _commandGate->commandWakeup(pending);
         }
-        return false;
-    });
+    }
     
-    while (_pending->getCount()) {
+    while (_pendingCount) {
         _commandGate->commandSleep(&_pending);
     }
-exit:
-    OSSafeReleaseNULL(set);
-    return;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1209,9 +1588,18 @@ bool IOHIDResourceDeviceUserClient::serializeDebugState(void *ref __unused, OSSe
     SET_DICT_NUM(dict, "GetReportTimeoutCount", _getReportTimeoutCount);
     SET_DICT_NUM(dict, "EnqueueFailCount", _enqueueFailCount);
     SET_DICT_NUM(dict, "HandleReportCount", _handleReportCount);
+    SET_DICT_NUM(dict, "HandleReportBatchCount", _handleReportBatchCount);
+    SET_DICT_NUM(dict, "ReportRingCount", _reportRingCount);
+    SET_DICT_NUM(dict, "ReportRingDrainCount", _reportRingDrainCount);
+    SET_DICT_NUM(dict, "ReportRingErrorCount", _reportRingErrorCount);
     SET_DICT_NUM(dict, "OutstandingAsyncCount", _outstandingAsyncCount);
+    SET_DICT_NUM(dict, "PendingCount", _pendingCount);
+    SET_DICT_NUM(dict, "PendingExhaustedCount", _pendingExhaustedCount);
     SET_DICT_NUM(dict, "MaxClientTimeoutUS", _maxClientTimeoutUS);
     
+    serializeLatencyHistogram(dict, "GetReportLatencyHistogram", _getReportLatency);
+    serializeLatencyHistogram(dict, "SetReportLatencyHistogram", _setReportLatency);
+    
     result = dict->serialize(serializer);
     OSSafeReleaseNULL(dict);
     
@@ -1219,6 +1607,27 @@ exit:
     return result;
 }
 
+void IOHIDResourceDeviceUserClient::serializeLatencyHistogram(OSDictionary * dict, const char * key, const UInt32 * histogram)
+{
+    OSArray * array = OSArray::withCapacity(kReportLatencyBucketCount);
+    
+    require(array, exit);
+    
+    for (uint32_t bucket = 0; bucket < kReportLatencyBucketCount; bucket++) {
+        OSNumber * num = OSNumber::withNumber(histogram[bucket], 32);
+        if (num) {
+            array->setObject(num);
+            num->release();
+        }
+    }
+    
+    dict->setObject(key, array);
+    array->release();
+    
+exit:
+    return;
+}
+
 //====================================================================================================
 // IOHIDResourceQueue
 //====================================================================================================
@@ -44,6 +44,8 @@ typedef enum {
     @constant kIOHIDResourceDeviceUserClientMethodPostReportResult Posts a report requested via GetReport and SetReport
     @constant kIOHIDResourceDeviceUserClientMethodRegisterService calls registerService on the IOHIDUserDevice.
     @constant kIOHIDResourceDeviceUserClientMethodReleaseToken calls releaseToken on the IOHIDUserDevice's ReportQueue.
+    @constant kIOHIDResourceDeviceUserClientMethodDrainReportRing Doorbell for the mapped input report ring. Drains all pending reports.
+    @constant kIOHIDResourceDeviceUserClientMethodHandleReportBatch Sends several reports packed as IOHIDResourceReportRingEntry records.
     @constant kIOHIDResourceDeviceUserClientMethodCount
 */
 typedef enum {
@@ -53,6 +55,8 @@ typedef enum {
     kIOHIDResourceDeviceUserClientMethodPostReportResponse,
     kIOHIDResourceDeviceUserClientMethodRegisterService,
     kIOHIDResourceDeviceUserClientMethodReleaseToken,
+    kIOHIDResourceDeviceUserClientMethodDrainReportRing,
+    kIOHIDResourceDeviceUserClientMethodHandleReportBatch,
     kIOHIDResourceDeviceUserClientMethodCount
 } IOHIDResourceDeviceUserClientExternalMethods;
 
@@ -93,6 +97,67 @@ typedef struct __attribute__((packed)) {
     uint32_t length;
 } IOHIDResourceOOBReportInfo;
 
+/*!
+    @enum IOHIDResourceUserClientMemoryType
+    @abstract Memory types that can be mapped with IOConnectMapMemory.
+    @constant kIOHIDResourceUserClientMemoryTypeQueue Queue used for sending get/set report requests to the user process.
+    @constant kIOHIDResourceUserClientMemoryTypeReportRing Ring used by the user process to post input reports.
+*/
+typedef enum {
+    kIOHIDResourceUserClientMemoryTypeQueue = 0,
+    kIOHIDResourceUserClientMemoryTypeReportRing
+} IOHIDResourceUserClientMemoryType;
+
+/*!
+    @struct IOHIDResourceReportRingHeader
+    @abstract Header of the mapped input report ring.
+    @discussion The user process is the only producer and the kernel is the only
+    consumer. The producer writes an IOHIDResourceReportRingEntry at tail and
+    publishes the new tail with release semantics, then issues a sequentially
+    consistent fence and reloads head. If head still equals the tail it started
+    from, the ring was empty (or was drained concurrently) and the producer calls
+    kIOHIDResourceDeviceUserClientMethodDrainReportRing. The kernel drains every
+    pending entry on the workloop, publishes head, and re-checks tail before
+    returning, so a report is never left behind without a doorbell.
+    head == tail means the ring is empty, so the producer must never advance
+    tail onto head; a report that does not fit is dropped by the producer.
+    Offsets are relative to data and always a multiple of
+    kIOHIDResourceReportRingAlignment. When fewer than
+    sizeof(IOHIDResourceReportRingEntry) bytes remain before the end of the
+    data area, or an entry's length is kIOHIDResourceReportRingWrap, the
+    consumer continues at offset 0.
+*/
+typedef struct {
+    volatile uint32_t   head;
+    volatile uint32_t   tail;
+    uint32_t            size;
+    uint32_t            reserved;
+    uint8_t             data[];
+} IOHIDResourceReportRingHeader;
+
+/*!
+    @struct IOHIDResourceReportRingEntry
+    @abstract Input report record in the mapped report ring or a report batch.
+    @discussion Records in a kIOHIDResourceDeviceUserClientMethodHandleReportBatch
+    buffer are packed back to back, each starting at a multiple of
+    kIOHIDResourceReportRingAlignment. The padding after the last record may be
+    omitted.
+    @field timestamp Mach absolute time of the report, or 0 to use the time it is drained.
+    @field length Length of report in bytes, or kIOHIDResourceReportRingWrap.
+*/
+typedef struct {
+    uint64_t    timestamp;
+    uint32_t    length;
+    uint32_t    reserved;
+    uint8_t     report[];
+} IOHIDResourceReportRingEntry;
+
+#define kIOHIDResourceReportRingWrap        0xffffffff
+#define kIOHIDResourceReportBatchMaxCount   256
+#define kIOHIDResourceReportRingAlignment   sizeof(uint64_t)
+#define IOHIDResourceReportRingEntrySize(length) \
+    ((sizeof(IOHIDResourceReportRingEntry) + (length) + kIOHIDResourceReportRingAlignment - 1) & ~(kIOHIDResourceReportRingAlignment - 1))
+
 /*
  * Kernel
  */
@@ -100,6 +165,7 @@ typedef struct __attribute__((packed)) {
 
 #include <IOKit/IOUserClient.h>
 #include <IOKit/IOSharedDataQueue.h>
+#include <IOKit/IOBufferMemoryDescriptor.h>
 #include <IOKit/IOCommandGate.h>
 #include <IOKit/IOTimerEventSource.h>
 #include "IOHIDResource.h"
@@ -140,6 +206,11 @@ class IOHIDResourceDeviceUserClient : public IOUserClient2022
     OSDeclareDefaultStructors(IOHIDResourceDeviceUserClient);
     
 private:
+    struct PendingReport;
+    
+    enum {
+        kReportLatencyBucketCount = 16
+    };
 
     IOHIDResource *         _owner;
     OSDictionary *          _properties;
@@ -149,7 +220,12 @@ private:
     mach_port_t             _port;
     task_t                  _owningTask;
     IOHIDResourceQueue *    _queue;
-    OSSet *                 _pending;
+    IOBufferMemoryDescriptor * _reportRing;
+    IOBufferMemoryDescriptor * _reportBuffer;
+    uint32_t                _reportRingHead;
+    PendingReport *         _pending;
+    uint32_t                _pendingFree;
+    uint32_t                _pendingCount;
     uint32_t                _maxClientTimeoutUS;
     u_int64_t               _tokenIndex;
     bool                    _suspended;
@@ -165,7 +241,14 @@ private:
     UInt32                  _getReportTimeoutCount;
     UInt32                  _enqueueFailCount;
     UInt32                  _handleReportCount;
+    UInt32                  _handleReportBatchCount;
+    UInt32                  _reportRingCount;
+    UInt32                  _reportRingDrainCount;
+    UInt32                  _reportRingErrorCount;
     UInt32                  _outstandingAsyncCount;
+    UInt32                  _pendingExhaustedCount;
+    UInt32                  _getReportLatency[kReportLatencyBucketCount];
+    UInt32                  _setReportLatency[kReportLatencyBucketCount];
     bool                    _asyncSupport;
     bool                    _privileged;
 
@@ -177,6 +260,8 @@ private:
     static IOReturn _postReportResult(IOHIDResourceDeviceUserClient *target,  void *reference, IOExternalMethodArguments *arguments);
     static IOReturn _registerService(IOHIDResourceDeviceUserClient *target,  void *reference, IOExternalMethodArguments *arguments);
     static IOReturn _releaseToken(IOHIDResourceDeviceUserClient *target, void *reference, IOExternalMethodArguments *arguments);
+    static IOReturn _handleReportBatch(IOHIDResourceDeviceUserClient *target, void *reference, IOExternalMethodArguments *arguments);
+    static IOReturn _drainReportRing(IOHIDResourceDeviceUserClient *target, void *reference, IOExternalMethodArguments *arguments);
 
     typedef struct {
         uint32_t                          selector;
@@ -185,7 +270,7 @@ private:
 
     IOReturn externalMethodGated(ExternalMethodGatedArguments * arguments);
     IOReturn registerNotificationPortGated(mach_port_t port);
-    IOReturn clientMemoryForTypeGated(IOOptionBits * options, IOMemoryDescriptor ** memory);
+    IOReturn clientMemoryForTypeGated(UInt32 type, IOOptionBits * options, IOMemoryDescriptor ** memory);
     
     typedef struct {
         IOMemoryDescriptor * report;
@@ -198,9 +283,16 @@ private:
     IOReturn getReportGated(ReportGatedArguments * arguments);
     IOReturn setReportGated(ReportGatedArguments * arguments);
     
+    PendingReport * allocPendingReport(IOHIDResourceReportDirection direction, ReportGatedArguments * arguments);
+    void freePendingReport(PendingReport * pending);
+    void recordPendingReportLatency(PendingReport * pending);
+    
     IOReturn createAndStartDevice();
     IOReturn createDevice(IOExternalMethodArguments *arguments);
     IOReturn handleReport(IOExternalMethodArguments *arguments);
+    IOReturn handleReportBatch(IOExternalMethodArguments *arguments);
+    IOReturn drainReportRing(IOExternalMethodArguments *arguments);
+    IOMemoryDescriptor * stageReport(const void * bytes, uint32_t length);
     IOReturn postReportResult(IOExternalMethodArguments *arguments);
     IOReturn terminateDevice();
     void setNextAsyncTimeout();
@@ -212,6 +304,7 @@ private:
     
     IOReturn setPropertiesGated(OSObject *properties);
     bool serializeDebugState(void *ref, OSSerialize *serializer);
+    void serializeLatencyHistogram(OSDictionary * dict, const char * key, const UInt32 * histogram);
     IOReturn releaseToken(mach_vm_address_t token);
     IOReturn releaseTokenGated(mach_vm_address_t token);
 
@@ -37,7 +37,8 @@
     IOHIDElementStruct  _elementStruct;
     BOOL                _isConstant;
     BOOL                _isUpdated;
-    
+    NSTimeInterval      _pollInterval;
+    NSTimeInterval      _nextPollTime;
 }
 
 - (nullable instancetype)initWithElementRef:(nonnull IOHIDElementRef)elementRef;
@@ -58,6 +59,8 @@
 @property (readonly)        IOHIDElementStruct  elementStruct;
 @property                   BOOL                isConstant;
 @property                   BOOL                isUpdated;
+@property                   NSTimeInterval      pollInterval;
+@property                   NSTimeInterval      nextPollTime;
 
 /*
  * These properties can be predicated against using the kIOHIDElement keys.
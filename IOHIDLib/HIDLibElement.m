@@ -34,6 +34,8 @@
 @synthesize defaultValueRef = _defaultValue;
 @synthesize isConstant = _isConstant;
 @synthesize isUpdated = _isUpdated;
+@synthesize pollInterval = _pollInterval;
+@synthesize nextPollTime = _nextPollTime;
 
 - (nullable instancetype)initWithElementRef:(nonnull IOHIDElementRef)elementRef
 {
@@ -42,9 +42,39 @@ enum {
 };
 
 enum {
-    kHIDCopyMatchingElementsDictionary = 0x1
+    kHIDCopyMatchingElementsDictionary = 0x1,
+    // Skip the element indexes and filter with predicates only (benchmarks)
+    kHIDCopyMatchingElementsNoIndex    = 0x2
 };
 
+/*
+ * A single input report delivered without copying. report points directly
+ * into the mapped report queue and is only valid until the callback returns.
+ */
+typedef struct {
+    const uint8_t * _Nonnull    report;
+    CFIndex                     reportLength;
+    uint32_t                    reportID;
+    uint64_t                    timestamp;
+} IOHIDReportBatchEntry;
+
+typedef void (*IOHIDReportNoCopyCallback)(void * _Nullable context,
+                                          IOReturn result,
+                                          void * _Nullable sender,
+                                          IOHIDReportType type,
+                                          uint32_t reportID,
+                                          const uint8_t * _Nonnull report,
+                                          CFIndex reportLength,
+                                          uint64_t timeStamp);
+
+typedef void (*IOHIDReportBatchCallback)(void * _Nullable context,
+                                         IOReturn result,
+                                         void * _Nullable sender,
+                                         const IOHIDReportBatchEntry * _Nonnull reports,
+                                         uint32_t reportCount);
+
+#define kIOHIDReportBatchMaxCount   64
+
 @interface IOHIDDeviceClass : IOHIDPlugin {
     IOHIDDeviceTimeStampedDeviceInterface   *_device;
     io_service_t                            _service;
@@ -64,6 +94,11 @@ enum {
     NSMutableArray                          *_elements;
     NSMutableArray                          *_sortedElements;
     NSMutableArray                          *_reportElements;
+    NSMutableDictionary                     *_cookieIndex;
+    NSMutableDictionary                     *_usageIndex;
+    NSMutableDictionary                     *_usagePageIndex;
+    NSMutableDictionary                     *_reportIDIndex;
+    NSMutableDictionary                     *_collectionTypeIndex;
     NSMutableDictionary                     *_properties;
     
     os_unfair_recursive_lock                _callbackLock;
@@ -72,6 +107,10 @@ enum {
     void                                    *_inputReportContext;
     uint8_t                                 *_inputReportBuffer;
     CFIndex                                 _inputReportBufferLength;
+    IOHIDReportNoCopyCallback               _inputReportNoCopyCallback;
+    IOHIDReportBatchCallback                _inputReportBatchCallback;
+    void                                    *_inputReportNoCopyContext;
+    void                                    *_inputReportBatchContext;
     NSDictionary                            *_protectedEvent;
 }
 
@@ -91,6 +130,26 @@ enum {
                            context:(void * _Nullable)context
                            options:(IOOptionBits)options;
 
+/*
+ * Registers a callback that receives each input report as a pointer into the
+ * mapped report queue. The report is only valid until the callback returns;
+ * its queue space is released right after. Callers that need the data later
+ * must copy it.
+ */
+- (IOReturn)setInputReportNoCopyCallback:(IOHIDReportNoCopyCallback _Nullable)callback
+                                 context:(void * _Nullable)context
+                                 options:(IOOptionBits)options;
+
+/*
+ * Registers a callback that receives every report available at each wakeup
+ * in batches of up to kIOHIDReportBatchMaxCount, with the same lifetime rules
+ * as the no-copy callback. The queue space for a batch is released in one
+ * step after the callback returns.
+ */
+- (IOReturn)setInputReportBatchCallback:(IOHIDReportBatchCallback _Nullable)callback
+                                context:(void * _Nullable)context
+                                options:(IOOptionBits)options;
+
 - (IOReturn)setReport:(IOHIDReportType)reportType
              reportID:(uint32_t)reportID
                report:(const uint8_t * _Nonnull)report
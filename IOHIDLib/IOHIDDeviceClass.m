@@ -100,6 +100,12 @@ static NSString *SetPropsPassthrough[] = {
  *  NSMutableArray                          *_sortedElements;
  *  Lifetime: Object, created in initElements, released in dealloc. Doesn't change. Mutating or reading/writing elements requires the _deviceLock.
  *  NSMutableArray                          *_reportElements;
+ *  Lifetime: Objects, created in initElements, released in dealloc. Don't change. Reading requires the _deviceLock.
+ *  NSMutableDictionary                     *_cookieIndex;
+ *  NSMutableDictionary                     *_usageIndex;
+ *  NSMutableDictionary                     *_usagePageIndex;
+ *  NSMutableDictionary                     *_reportIDIndex;
+ *  NSMutableDictionary                     *_collectionTypeIndex;
  *  Lifetime: Object, created in init, released in dealloc. Only read/write under _deviceLock.
  *  NSMutableDictionary                     *_properties;
  * 
@@ -107,6 +113,10 @@ static NSString *SetPropsPassthrough[] = {
  *  IOHIDReportCallback                     _inputReportCallback;
  *  IOHIDReportWithTimeStampCallback        _inputReportTimestampCallback;
  *  void                                    *_inputReportContext;
+ *  IOHIDReportNoCopyCallback               _inputReportNoCopyCallback;
+ *  IOHIDReportBatchCallback                _inputReportBatchCallback;
+ *  void                                    *_inputReportNoCopyContext;
+ *  void                                    *_inputReportBatchContext;
  *  
  *  uint8_t                                 *_inputReportBuffer;
  *  CFIndex                                 _inputReportBufferLength;
@@ -181,6 +191,52 @@ static NSString *SetPropsPassthrough[] = {
     return elementRef;
 }
 
+static NSNumber *_usageIndexKey(uint32_t usagePage, uint32_t usage)
+{
+    return @(((uint64_t)usagePage << 32) | usage);
+}
+
+static void _addIndexedElement(NSMutableDictionary *index,
+                               id key,
+                               HIDLibElement *element)
+{
+    NSMutableArray *bucket = index[key];
+    
+    if (!bucket) {
+        bucket = [[NSMutableArray alloc] init];
+        index[key] = bucket;
+    }
+    
+    [bucket addObject:element];
+}
+
+- (void)initElementIndexes
+{
+    /*
+     * Secondary indexes over _elements for the matching keys that are used
+     * most often, so copyMatchingElements can answer them without building a
+     * predicate and scanning every element. Each bucket keeps the elements in
+     * _elements order, so indexed results match the predicate results.
+     * Must be called with _deviceLock held.
+     */
+    _cookieIndex = [[NSMutableDictionary alloc] init];
+    _usageIndex = [[NSMutableDictionary alloc] init];
+    _usagePageIndex = [[NSMutableDictionary alloc] init];
+    _reportIDIndex = [[NSMutableDictionary alloc] init];
+    _collectionTypeIndex = [[NSMutableDictionary alloc] init];
+    
+    for (HIDLibElement *element in _elements) {
+        _cookieIndex[@(element.elementCookie)] = element;
+        
+        _addIndexedElement(_usageIndex,
+                           _usageIndexKey(element.usagePage, element.usage),
+                           element);
+        _addIndexedElement(_usagePageIndex, @(element.usagePage), element);
+        _addIndexedElement(_reportIDIndex, @(element.reportID), element);
+        _addIndexedElement(_collectionTypeIndex, @(element.collectionType), element);
+    }
+}
+
 - (IOReturn)initElements
 {
     IOReturn ret = kIOReturnError;
@@ -335,6 +391,8 @@ static NSString *SetPropsPassthrough[] = {
     for (HIDLibElement *element in _reportElements) {
         [_sortedElements replaceObjectAtIndex:element.elementCookie withObject:element];
     }
+    
+    [self initElementIndexes];
     os_unfair_recursive_lock_unlock(&_deviceLock);
     
     ret = kIOReturnSuccess;
@@ -590,7 +648,8 @@ static IOReturn _open(void *iunknown, IOOptionBits options)
     os_unfair_recursive_lock_lock(&_deviceLock);
     _opened = (ret == kIOReturnSuccess || ret == kIOReturnExclusiveAccess);
         
-    if (_inputReportCallback || _inputReportTimestampCallback) {
+    if (_inputReportCallback || _inputReportTimestampCallback ||
+        _inputReportNoCopyCallback || _inputReportBatchCallback) {
         [_queue start];
     }
     os_unfair_recursive_lock_unlock(&_deviceLock);
@@ -619,7 +678,8 @@ static IOReturn _close(void * iunknown, IOOptionBits options)
     require_noerr_action(ret, exit, os_unfair_recursive_lock_lock(&_deviceLock));
     
     os_unfair_recursive_lock_lock(&_deviceLock);
-    if (_inputReportCallback || _inputReportTimestampCallback) {
+    if (_inputReportCallback || _inputReportTimestampCallback ||
+        _inputReportNoCopyCallback || _inputReportBatchCallback) {
         [_queue stop];
     }
     os_unfair_recursive_lock_unlock(&_deviceLock);
@@ -777,6 +837,83 @@ static IOReturn _getAsyncEventSource(void *iunknown, CFTypeRef *pSource)
     return prop;
 }
 
+- (NSArray *)copyIndexedElements:(NSDictionary *)matching
+                      indexedKeys:(NSMutableSet *)indexedKeys
+{
+    /*
+     * Picks the most selective index that can answer part of the matching
+     * dictionary and returns its elements, adding the keys it satisfied to
+     * indexedKeys. Returns nil if no index applies. Must be called with
+     * _deviceLock held.
+     */
+    NSNumber *cookie = matching[@kIOHIDElementCookieKey];
+    NSNumber *cookieMin = matching[@kIOHIDElementCookieMinKey];
+    NSNumber *cookieMax = matching[@kIOHIDElementCookieMaxKey];
+    NSNumber *usagePage = matching[@kIOHIDElementUsagePageKey];
+    NSNumber *usage = matching[@kIOHIDElementUsageKey];
+    NSNumber *reportID = matching[@kIOHIDElementReportIDKey];
+    NSNumber *collectionType = matching[@kIOHIDElementCollectionTypeKey];
+    NSArray *result = nil;
+    
+    /*
+     * Only whole numbers that fit in 32 bits can be answered from an index.
+     * Anything else (negative, too large, fractional) would be truncated by
+     * unsignedIntValue and could hit a different element, so leave it to the
+     * predicate path.
+     */
+    for (id val in @[cookie ?: @0, cookieMin ?: @0, cookieMax ?: @0,
+                     usagePage ?: @0, usage ?: @0, reportID ?: @0,
+                     collectionType ?: @0]) {
+        if (![val isKindOfClass:[NSNumber class]] ||
+            ![val isEqualToNumber:@([val unsignedIntValue])]) {
+            return nil;
+        }
+    }
+    
+    if (cookie) {
+        HIDLibElement *element = _cookieIndex[@(cookie.unsignedIntValue)];
+        
+        result = element ? @[element] : @[];
+        [indexedKeys addObject:@kIOHIDElementCookieKey];
+    } else if (usagePage && usage) {
+        result = _usageIndex[_usageIndexKey(usagePage.unsignedIntValue,
+                                            usage.unsignedIntValue)] ?: @[];
+        [indexedKeys addObject:@kIOHIDElementUsagePageKey];
+        [indexedKeys addObject:@kIOHIDElementUsageKey];
+    } else if (cookieMin || cookieMax) {
+        // Walk _elements rather than the cookie index so the range keeps
+        // _elements order, as the predicate path does.
+        NSMutableArray *range = [[NSMutableArray alloc] init];
+        uint32_t min = cookieMin ? cookieMin.unsignedIntValue : 0;
+        uint32_t max = cookieMax ? cookieMax.unsignedIntValue : UINT32_MAX;
+        
+        for (HIDLibElement *element in _elements) {
+            if (element.elementCookie >= min && element.elementCookie <= max) {
+                [range addObject:element];
+            }
+        }
+        
+        result = range;
+        if (cookieMin) {
+            [indexedKeys addObject:@kIOHIDElementCookieMinKey];
+        }
+        if (cookieMax) {
+            [indexedKeys addObject:@kIOHIDElementCookieMaxKey];
+        }
+    } else if (reportID) {
+        result = _reportIDIndex[reportID] ?: @[];
+        [indexedKeys addObject:@kIOHIDElementReportIDKey];
+    } else if (usagePage) {
+        result = _usagePageIndex[usagePage] ?: @[];
+        [indexedKeys addObject:@kIOHIDElementUsagePageKey];
+    } else if (collectionType) {
+        result = _collectionTypeIndex[collectionType] ?: @[];
+        [indexedKeys addObject:@kIOHIDElementCollectionTypeKey];
+    }
+    
+    return result;
+}
+
 - (NSMutableArray *)copyObsoleteDictionary:(NSArray *)elements
 {
     /*
@@ -846,7 +983,7 @@ static IOReturn _copyMatchingElements(void *iunknown,
 
 - (IOReturn)copyMatchingElements:(NSDictionary *)matching
                         elements:(CFArrayRef *)pElements
-                         options:(IOOptionBits __unused)options
+                         options:(IOOptionBits)options
 {
     IOReturn ret;
     
@@ -859,8 +996,15 @@ static IOReturn _copyMatchingElements(void *iunknown,
         return ret;
     }
     
+    NSMutableSet *indexedKeys = [[NSMutableSet alloc] init];
+    
     os_unfair_recursive_lock_lock(&_deviceLock);
-    NSMutableArray *elements = [[NSMutableArray alloc] initWithArray:_elements];
+    NSArray *candidates = nil;
+    if (!(options & kHIDCopyMatchingElementsNoIndex)) {
+        candidates = [self copyIndexedElements:matching
+                                   indexedKeys:indexedKeys];
+    }
+    NSMutableArray *elements = [[NSMutableArray alloc] initWithArray:candidates ?: _elements];
     os_unfair_recursive_lock_unlock(&_deviceLock);
     NSMutableArray *result = nil;
     
@@ -868,6 +1012,11 @@ static IOReturn _copyMatchingElements(void *iunknown,
                                                   NSNumber *val,
                                                   BOOL *stop __unused)
     {
+        // Keys already answered by an index don't need a predicate
+        if ([indexedKeys containsObject:key]) {
+            return;
+        }
+        
         @autoreleasepool {
             NSPredicate *predicate = nil;
             NSString *prop;
@@ -1169,6 +1318,96 @@ static void _valueAvailableCallback(void *context,
     [me valueAvailableCallback:result];
 }
 
+- (void)dispatchReportsNoCopy
+{
+    IOHIDReportBatchEntry reports[kIOHIDReportBatchMaxCount];
+    uint32_t count;
+    
+    os_unfair_recursive_lock_lock(&_deviceLock);
+    CFIndex inputReportLength = _inputReportBufferLength;
+    uint8_t * inputReportBuffer = _inputReportBuffer;
+    os_unfair_recursive_lock_unlock(&_deviceLock);
+    
+    while ((count = [_queue peekReports:reports
+                               maxCount:kIOHIDReportBatchMaxCount])) {
+        os_unfair_recursive_lock_lock(&_deviceLock);
+        IOHIDReportCallback inputReportCallback = _inputReportCallback;
+        IOHIDReportWithTimeStampCallback inputReportTimestampCallback = _inputReportTimestampCallback;
+        IOHIDReportNoCopyCallback inputReportNoCopyCallback = _inputReportNoCopyCallback;
+        IOHIDReportBatchCallback inputReportBatchCallback = _inputReportBatchCallback;
+        void * inputReportContext = _inputReportContext;
+        void * inputReportNoCopyContext = _inputReportNoCopyContext;
+        void * inputReportBatchContext = _inputReportBatchContext;
+        os_unfair_recursive_lock_unlock(&_deviceLock);
+        
+        os_unfair_recursive_lock_lock(&_callbackLock);
+        for (uint32_t i = 0; i < count; i++) {
+            IOHIDReportBatchEntry *report = &reports[i];
+            
+            if (IOHIDFAMILY_HID_TRACE_ENABLED()) {
+                uint64_t regID;
+                IORegistryEntryGetRegistryEntryID(_service, &regID);
+                
+                IOHIDFAMILY_HID_TRACE(kHIDTraceHandleReport, (uintptr_t)regID, (uintptr_t)report->reportID, (uintptr_t)report->reportLength, (uintptr_t)report->timestamp, (uintptr_t)report->report);
+            }
+            
+            if (inputReportNoCopyCallback) {
+                (inputReportNoCopyCallback)(inputReportNoCopyContext,
+                                            kIOReturnSuccess,
+                                            &_device,
+                                            kIOHIDReportTypeInput,
+                                            report->reportID,
+                                            report->report,
+                                            report->reportLength,
+                                            report->timestamp);
+            }
+            
+            // Copying callbacks registered alongside still get their copy
+            if (inputReportBuffer && (inputReportCallback || inputReportTimestampCallback)) {
+                CFIndex size = min(inputReportLength, report->reportLength);
+                
+                bcopy(report->report, inputReportBuffer, size);
+                
+                if (inputReportCallback) {
+                    (inputReportCallback)(inputReportContext,
+                                          kIOReturnSuccess,
+                                          &_device,
+                                          kIOHIDReportTypeInput,
+                                          report->reportID,
+                                          inputReportBuffer,
+                                          size);
+                }
+                
+                if (inputReportTimestampCallback) {
+                    (inputReportTimestampCallback)(inputReportContext,
+                                                   kIOReturnSuccess,
+                                                   &_device,
+                                                   kIOHIDReportTypeInput,
+                                                   report->reportID,
+                                                   inputReportBuffer,
+                                                   size,
+                                                   report->timestamp);
+                }
+            }
+        }
+        
+        if (inputReportBatchCallback) {
+            (inputReportBatchCallback)(inputReportBatchContext,
+                                       kIOReturnSuccess,
+                                       &_device,
+                                       reports,
+                                       count);
+        }
+        os_unfair_recursive_lock_unlock(&_callbackLock);
+        
+        // The report pointers are invalid past this point
+        [_queue releaseReports:count];
+    }
+    
+    // If there are any blocked reports signal that they can be dequeued
+    [_queue signalQueueEmpty];
+}
+
 - (void)valueAvailableCallback:(IOReturn)result
 {
     IOHIDValueRef value;
@@ -1177,7 +1416,13 @@ static void _valueAvailableCallback(void *context,
     os_unfair_recursive_lock_lock(&_deviceLock);
     CFIndex inputReportLength = _inputReportBufferLength;
     uint8_t * inputReportBuffer = _inputReportBuffer;
+    bool noCopy = (_inputReportNoCopyCallback || _inputReportBatchCallback);
     os_unfair_recursive_lock_unlock(&_deviceLock);
+    
+    if (noCopy) {
+        [self dispatchReportsNoCopy];
+        return;
+    }
 
     while ((result = [_queue copyNextValue:&value]) == kIOReturnSuccess) {
         IOHIDElementRef element;
@@ -1265,7 +1510,7 @@ static IOReturn _setInputReportCallback(void *iunknown,
                       reportLength:(CFIndex)reportLength
                           callback:(IOHIDReportCallback)callback
                            context:(void *)context
-                           options:(IOOptionBits __unused)options
+                           options:(IOOptionBits)options
 {
     os_unfair_recursive_lock_lock(&_deviceLock);
     os_unfair_recursive_lock_lock(&_callbackLock);
@@ -1287,6 +1532,50 @@ static IOReturn _setInputReportCallback(void *iunknown,
     return kIOReturnSuccess;
 }
 
+- (IOReturn)setInputReportNoCopyCallback:(IOHIDReportNoCopyCallback)callback
+                                 context:(void *)context
+                                 options:(IOOptionBits)options
+{
+    os_unfair_recursive_lock_lock(&_deviceLock);
+    os_unfair_recursive_lock_lock(&_callbackLock);
+    _inputReportNoCopyContext = context;
+    _inputReportNoCopyCallback = callback;
+    os_unfair_recursive_lock_unlock(&_callbackLock);
+    os_unfair_recursive_lock_unlock(&_deviceLock);
+    
+    [self initQueue];
+    
+    os_unfair_recursive_lock_lock(&_deviceLock);
+    if (_opened) {
+        [_queue start];
+    }
+    os_unfair_recursive_lock_unlock(&_deviceLock);
+    
+    return kIOReturnSuccess;
+}
+
+- (IOReturn)setInputReportBatchCallback:(IOHIDReportBatchCallback)callback
+                                context:(void *)context
+                                options:(IOOptionBits)options
+{
+    os_unfair_recursive_lock_lock(&_deviceLock);
+    os_unfair_recursive_lock_lock(&_callbackLock);
+    _inputReportBatchContext = context;
+    _inputReportBatchCallback = callback;
+    os_unfair_recursive_lock_unlock(&_callbackLock);
+    os_unfair_recursive_lock_unlock(&_deviceLock);
+    
+    [self initQueue];
+    
+    os_unfair_recursive_lock_lock(&_deviceLock);
+    if (_opened) {
+        [_queue start];
+    }
+    os_unfair_recursive_lock_unlock(&_deviceLock);
+    
+    return kIOReturnSuccess;
+}
+
 typedef struct {
     IOHIDReportType     type;
     uint8_t           * buffer;
@@ -1550,7 +1839,7 @@ static IOReturn _setInputReportWithTimeStampCallback(void *iunknown,
                         reportLength:(CFIndex)reportLength
                             callback:(IOHIDReportWithTimeStampCallback)callback
                             context:(void *)context
-                            options:(IOOptionBits __unused)options
+                            options:(IOOptionBits)options
 {
     os_unfair_recursive_lock_lock(&_deviceLock);
     _inputReportBuffer = report;
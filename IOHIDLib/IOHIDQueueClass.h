@@ -50,6 +50,17 @@
     uint32_t                    _depth;
     uint64_t                    _queueToken;
     
+    uint64_t                    _pendingQueueToken;
+    uint32_t                    _queueGeneration;
+    uint32_t                    _autotuneMinDepth;
+    uint32_t                    _autotuneMaxDepth;
+    uint32_t                    _autotuneHighWaterCount;
+    uint64_t                    _autotuneLowWaterStart;
+    uint64_t                    _autotuneDropCount;
+    uint32_t                    _autotuneLastTail;
+    bool                        _autotuneResize;
+    bool                        _resizeInProgress;
+    
     IOHIDCallback               _valueAvailableCallback;
     void                        *_valueAvailableContext;
 
@@ -68,6 +79,27 @@
 - (IOReturn)stop;
 - (IOReturn)copyNextValue:(IOHIDValueRef _Nullable * _Nullable)pValue;
 
+/*
+ * Fills reports with pointers into the mapped queue for up to maxCount queued
+ * reports without dequeuing them. The pointers stay valid until the entries
+ * are released with releaseReports:, which frees the queue space for all of
+ * them in one step.
+ */
+- (uint32_t)peekReports:(IOHIDReportBatchEntry * _Nonnull)reports
+               maxCount:(uint32_t)maxCount;
+- (void)releaseReports:(uint32_t)count;
+
+/*
+ * Lets the queue pick its own depth between minDepth and maxDepth. The depth
+ * doubles after sustained high occupancy or any dropped report, and halves
+ * after prolonged low occupancy. The kernel queue is replaced only once the
+ * mapped queue has drained, and each replacement bumps queueGeneration.
+ * Passing a maxDepth of 0 turns autotuning off and keeps the current depth.
+ */
+- (IOReturn)setAutotuneMinDepth:(uint32_t)minDepth
+                       maxDepth:(uint32_t)maxDepth;
+- (uint32_t)queueGeneration;
+
 - (void)queueCallback:(CFMachPortRef _Nonnull)port
                   msg:(mach_msg_header_t * _Nonnull)msg
                  size:(CFIndex)size
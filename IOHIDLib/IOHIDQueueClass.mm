@@ -32,6 +32,11 @@
 #import <IOKit/hid/IOHIDLibPrivate.h>
 #import <IOKit/hid/IOHIDAnalytics.h>
 
+#define kQueueAutotuneHighWaterPercent  75
+#define kQueueAutotuneLowWaterPercent   10
+#define kQueueAutotuneHighWaterSamples  4
+#define kQueueAutotuneLowWaterNS        (10 * NSEC_PER_SEC)
+
 @implementation IOHIDQueueClass
 
 - (HRESULT)queryInterface:(REFIID)uuidBytes
@@ -113,6 +118,53 @@ static IOReturn _getDepth(void *iunknown, uint32_t *pDepth)
     return kIOReturnSuccess;
 }
 
+- (IOReturn)setAutotuneMinDepth:(uint32_t)minDepth
+                       maxDepth:(uint32_t)maxDepth
+{
+    if (maxDepth && (!minDepth || minDepth > maxDepth)) {
+        return kIOReturnBadArgument;
+    }
+    
+    os_unfair_lock_lock(&_queueLock);
+    _autotuneMinDepth = minDepth;
+    _autotuneMaxDepth = maxDepth;
+    _autotuneHighWaterCount = 0;
+    _autotuneLowWaterStart = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    
+    if (maxDepth) {
+        // The first safe point brings the queue within the new bounds
+        _depth = MIN(MAX(_depth, minDepth), maxDepth);
+        _autotuneResize = true;
+    }
+    os_unfair_lock_unlock(&_queueLock);
+    
+    return kIOReturnSuccess;
+}
+
+- (uint32_t)queueGeneration
+{
+    uint32_t generation;
+    
+    os_unfair_lock_lock(&_queueLock);
+    generation = _queueGeneration;
+    os_unfair_lock_unlock(&_queueLock);
+    
+    return generation;
+}
+
+// Element and start/stop calls go to the queue that is receiving reports,
+// which is the replacement queue while the old one drains.
+- (uint64_t)deliveryToken
+{
+    uint64_t token;
+    
+    os_unfair_lock_lock(&_queueLock);
+    token = _pendingQueueToken ? _pendingQueueToken : _queueToken;
+    os_unfair_lock_unlock(&_queueLock);
+    
+    return token;
+}
+
 static IOReturn _addElement(void *iunknown,
                             IOHIDElementRef element,
                             IOOptionBits options __unused)
@@ -133,7 +185,7 @@ static IOReturn _addElement(void *iunknown,
     if (!element) {
         return kIOReturnBadArgument;
     }
-    input[0] = _queueToken;
+    input[0] = [self deliveryToken];
     input[1] = (uint64_t)IOHIDElementGetCookie(element);
 
     ret = IOConnectCallScalarMethod(_device.connect,
@@ -168,7 +220,7 @@ static IOReturn _removeElement(void *iunknown,
         return kIOReturnBadArgument;
     }
     
-    input[0] = _queueToken;
+    input[0] = [self deliveryToken];
     input[1] = (uint64_t)IOHIDElementGetCookie(element);
     
     ret = IOConnectCallScalarMethod(_device.connect,
@@ -204,7 +256,7 @@ static IOReturn _containsElement(void *iunknown,
         return kIOReturnBadArgument;
     }
     
-    input[0] = _queueToken;
+    input[0] = [self deliveryToken];
     input[1] = (uint64_t)IOHIDElementGetCookie(element);
     
     ret = IOConnectCallScalarMethod(_device.connect,
@@ -229,9 +281,10 @@ static IOReturn _start(void *iunknown, IOOptionBits options __unused)
 
 - (IOReturn)start
 {
+    uint64_t token = [self deliveryToken];
     IOReturn ret = IOConnectCallScalarMethod(_device.connect,
                                              kIOHIDLibUserClientStartQueue,
-                                             &_queueToken,
+                                             &token,
                                              1,
                                              NULL,
                                              NULL);
@@ -258,9 +311,11 @@ static IOReturn _stop(void *iunknown, IOOptionBits options __unused)
 
 - (IOReturn)stop
 {
+    uint64_t token = [self deliveryToken];
+    
     return IOConnectCallScalarMethod(_device.connect,
                                      kIOHIDLibUserClientStopQueue,
-                                     &_queueToken,
+                                     &token,
                                      1,
                                      NULL,
                                      NULL);
@@ -310,8 +365,12 @@ static IOReturn _copyNextValue(void *iunknown,
 
     os_unfair_lock_lock(&_queueLock);
     [self updateUsageAnalytics];
+    [self updateAutotune];
     
     entry = IODataQueuePeek(_queueMemory);
+    if (!entry && [self resizeQueueIfNeeded]) {
+        entry = IODataQueuePeek(_queueMemory);
+    }
     require_action(entry, exit_locked, ret = kIOReturnUnderrun);
 
     elementValue = (IOHIDElementValue *)&(entry->data);
@@ -334,6 +393,129 @@ exit:
     return ret;
 }
 
+// Must be called with _queueLock held. Returns the entry at *offset, moving
+// *offset to 0 if the producer wrapped, or NULL if the entry is malformed.
+- (IODataQueueEntry *)entryAtOffset:(uint32_t *)offset
+                          queueSize:(uint32_t)queueSize
+{
+    IODataQueueEntry *entry = NULL;
+    uint32_t head = *offset;
+    
+    // The producer wraps to the start of the queue when the entry (or its
+    // header) does not fit between head and the end of the queue.
+    if (queueSize - head < DATA_QUEUE_ENTRY_HEADER_SIZE) {
+        head = 0;
+    } else {
+        entry = (IODataQueueEntry *)((uint8_t *)_queueMemory->queue + head);
+        if (entry->size > queueSize - head - DATA_QUEUE_ENTRY_HEADER_SIZE) {
+            head = 0;
+        }
+    }
+    
+    entry = (IODataQueueEntry *)((uint8_t *)_queueMemory->queue + head);
+    require_action(entry->size <= queueSize - head - DATA_QUEUE_ENTRY_HEADER_SIZE, exit, entry = NULL);
+    require_action(entry->size >= ELEMENT_VALUE_HEADER_SIZE((IOHIDElementValue *)entry->data), exit, entry = NULL);
+    
+    *offset = head;
+    
+exit:
+    return entry;
+}
+
+- (uint32_t)peekReports:(IOHIDReportBatchEntry *)reports
+               maxCount:(uint32_t)maxCount
+{
+    uint32_t count = 0;
+    uint32_t queueSize;
+    uint32_t head;
+    uint32_t tail;
+    
+    os_unfair_lock_lock(&_queueLock);
+    require(_queueMemory, exit);
+    
+    [self updateUsageAnalytics];
+    [self updateAutotune];
+    
+    if (_queueMemory->head == _queueMemory->tail) {
+        [self resizeQueueIfNeeded];
+        require(_queueMemory, exit);
+    }
+    
+    queueSize = _queueMemory->queueSize;
+    require(queueSize <= _queueMemorySize, exit);
+    
+    head = __c11_atomic_load((_Atomic uint32_t *)&_queueMemory->head, __ATOMIC_RELAXED);
+    tail = __c11_atomic_load((_Atomic uint32_t *)&_queueMemory->tail, __ATOMIC_ACQUIRE);
+    
+    while (head != tail && count < maxCount) {
+        IODataQueueEntry *entry = [self entryAtOffset:&head queueSize:queueSize];
+        IOHIDElementValue *elementValue;
+        IOHIDReportBatchEntry *report = &reports[count];
+        
+        if (!entry) {
+            HIDLogError("Malformed queue entry at offset %u", head);
+            break;
+        }
+        
+        elementValue = (IOHIDElementValue *)entry->data;
+        
+        report->reportID = IOHIDElementGetReportID([_device getElement:(uint32_t)elementValue->cookie]);
+        report->timestamp = *((uint64_t *)&elementValue->timestamp);
+        report->reportLength = ELEMENT_VALUE_REPORT_SIZE(elementValue);
+        
+        if (elementValue->flags & kIOHIDElementValueOOBReport) {
+            // Large reports are mapped separately and stay mapped until released
+            report->report = (const uint8_t *)(uintptr_t)*((uint64_t *)elementValue->value);
+        } else {
+            report->report = (const uint8_t *)elementValue->value;
+            if (report->reportLength > (CFIndex)(entry->size - ELEMENT_VALUE_HEADER_SIZE(elementValue))) {
+                report->reportLength = entry->size - ELEMENT_VALUE_HEADER_SIZE(elementValue);
+            }
+        }
+        
+        head += entry->size + DATA_QUEUE_ENTRY_HEADER_SIZE;
+        count++;
+    }
+    
+exit:
+    os_unfair_lock_unlock(&_queueLock);
+    return count;
+}
+
+- (void)releaseReports:(uint32_t)count
+{
+    uint32_t queueSize;
+    uint32_t head;
+    
+    os_unfair_lock_lock(&_queueLock);
+    require(_queueMemory && count, exit);
+    
+    queueSize = _queueMemory->queueSize;
+    require(queueSize <= _queueMemorySize, exit);
+    
+    head = __c11_atomic_load((_Atomic uint32_t *)&_queueMemory->head, __ATOMIC_RELAXED);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        IODataQueueEntry *entry = [self entryAtOffset:&head queueSize:queueSize];
+        IOHIDElementValue *elementValue;
+        
+        require(entry, exit);
+        
+        elementValue = (IOHIDElementValue *)entry->data;
+        if (elementValue->flags & kIOHIDElementValueOOBReport) {
+            [_device releaseReport:*((uint64_t *)elementValue->value)];
+        }
+        
+        head += entry->size + DATA_QUEUE_ENTRY_HEADER_SIZE;
+    }
+    
+    // Hand all of the consumed entries back to the producer at once
+    __c11_atomic_store((_Atomic uint32_t *)&_queueMemory->head, head, __ATOMIC_RELEASE);
+    
+exit:
+    os_unfair_lock_unlock(&_queueLock);
+}
+
 static void _queueCallback(CFMachPortRef port,
                            mach_msg_header_t *msg,
                            CFIndex size,
@@ -523,6 +705,15 @@ exit:
                               NULL,
                               NULL);
     
+    if (_pendingQueueToken) {
+        IOConnectCallScalarMethod(_device.connect,
+                                  kIOHIDLibUserClientDisposeQueue,
+                                  &_pendingQueueToken,
+                                  1,
+                                  NULL,
+                                  NULL);
+    }
+    
     if (_queue) {
         free(_queue);
     }
@@ -550,8 +741,16 @@ exit:
 
 - (bool)setupAnalytics
 {
-    bool                   result = false;
-    NSMutableDictionary *  eventDesc = [@{ @"staticSize"    : @(_queueMemorySize),
+    _usageAnalytics = [self createUsageAnalytics:_queueMemorySize];
+
+    return _usageAnalytics != NULL;
+}
+
+// Does not touch the queue state, so it can be called without _queueLock
+- (CFTypeRef)createUsageAnalytics:(vm_size_t)queueMemorySize
+{
+    CFTypeRef              usageAnalytics = NULL;
+    NSMutableDictionary *  eventDesc = [@{ @"staticSize"    : @(queueMemorySize),
                                            @"queueType"     : @"deviceQueue"
                                         } mutableCopy];
     IOHIDAnalyticsHistogramSegmentConfig analyticsConfig = {
@@ -580,17 +779,14 @@ exit:
 
     
     
-    _usageAnalytics = IOHIDAnalyticsHistogramEventCreate(CFSTR("com.apple.hid.queueUsage"), (__bridge CFDictionaryRef)eventDesc, CFSTR("UsagePercent"), &analyticsConfig, 1);
+    usageAnalytics = IOHIDAnalyticsHistogramEventCreate(CFSTR("com.apple.hid.queueUsage"), (__bridge CFDictionaryRef)eventDesc, CFSTR("UsagePercent"), &analyticsConfig, 1);
 
-    require_action(_usageAnalytics, exit, HIDLogError("Unable to create queue analytics"));
+    require_action(usageAnalytics, exit, HIDLogError("Unable to create queue analytics"));
     
-    IOHIDAnalyticsEventActivate(_usageAnalytics);
-   
-
-    result = true;
+    IOHIDAnalyticsEventActivate(usageAnalytics);
 
 exit:
-    return result;
+    return usageAnalytics;
 }
 
 - (void)updateUsageAnalytics
@@ -627,6 +823,207 @@ exit:
     return;
 }
 
+// Must be called with _queueLock held
+- (void)updateAutotune
+{
+    uint32_t head;
+    uint32_t tail;
+    uint64_t queueUsage;
+    uint64_t dropCount;
+    uint64_t now;
+    uint32_t depth;
+
+    require_quiet(_autotuneMaxDepth, exit);
+    require(_queueHeader && _queueMemory && _queueMemorySize, exit);
+
+    // Wait for the last decision to take effect before making another
+    require_quiet(!_autotuneResize && !_pendingQueueToken, exit);
+
+    head = (uint32_t)_queueMemory->head;
+    tail = (uint32_t)_queueMemory->tail;
+    dropCount = _queueHeader->dropCount;
+    now = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    depth = _depth;
+
+    if (head <= tail) {
+        queueUsage = tail - head;
+    }
+    else {
+        queueUsage = _queueMemorySize - (head - tail);
+    }
+    queueUsage = (queueUsage * 100) / _queueMemorySize;
+
+    if (dropCount != _autotuneDropCount || (_queueHeader->status & kIOHIDQueueStatusBlocked)) {
+        // Reports were lost or held back, so don't wait for more samples
+        _autotuneDropCount = dropCount;
+        _autotuneHighWaterCount = kQueueAutotuneHighWaterSamples;
+    } else if (tail != _autotuneLastTail) {
+        // Only count a sample when new reports arrived since the last one,
+        // otherwise a single burst is counted once per dequeue.
+        if (queueUsage >= kQueueAutotuneHighWaterPercent) {
+            _autotuneHighWaterCount++;
+        } else {
+            _autotuneHighWaterCount = 0;
+        }
+    }
+    _autotuneLastTail = tail;
+
+    if (queueUsage > kQueueAutotuneLowWaterPercent) {
+        _autotuneLowWaterStart = now;
+    }
+
+    if (_autotuneHighWaterCount >= kQueueAutotuneHighWaterSamples) {
+        depth = (depth > _autotuneMaxDepth / 2) ? _autotuneMaxDepth : MAX(depth * 2, 1);
+        _autotuneHighWaterCount = 0;
+        _autotuneLowWaterStart = now;
+    } else if (now - _autotuneLowWaterStart >= kQueueAutotuneLowWaterNS) {
+        depth = MAX(depth / 2, _autotuneMinDepth);
+        _autotuneLowWaterStart = now;
+    }
+
+    if (depth != _depth) {
+        _depth = depth;
+        _autotuneResize = true;
+    }
+
+exit:
+    return;
+}
+
+// Must be called with _queueLock held, and only once the mapped queue has
+// been drained. The lock is dropped around every call into the kernel and
+// retaken before returning, so callers must re-read the queue state.
+// Returns true if a new queue was mapped.
+- (bool)resizeQueueIfNeeded
+{
+    IOReturn            ret;
+    uint64_t            input[2];
+    uint64_t            output;
+    uint32_t            outputCount = 1;
+    io_async_ref64_t    async;
+    uint64_t            newToken;
+    uint64_t            oldToken;
+    IOHIDQueueHeader *  oldHeader;
+    CFTypeRef           oldAnalytics;
+    CFTypeRef           newAnalytics = NULL;
+    vm_size_t           newQueueMemorySize = 0;
+#if !__LP64__
+    vm_address_t        mappedMem = (vm_address_t)0;
+    vm_size_t           memSize = 0;
+#else
+    mach_vm_address_t   mappedMem = (mach_vm_address_t)0;
+    mach_vm_size_t      memSize = 0;
+#endif
+
+    // Another thread already dropped the lock to resize
+    require_quiet(!_resizeInProgress, exit);
+
+    if (_autotuneResize && !_pendingQueueToken) {
+        input[0] = _queueToken;
+        input[1] = _depth;
+
+        _resizeInProgress = true;
+        os_unfair_lock_unlock(&_queueLock);
+
+        // The kernel moves delivery over to a new queue in one step, after
+        // which the old queue only holds reports that are still to be read.
+        ret = IOConnectCallAsyncScalarMethod(_device.connect,
+                                             kIOHIDLibUserClientResizeQueue,
+                                             _port,
+                                             async,
+                                             1,
+                                             input,
+                                             2,
+                                             &output,
+                                             &outputCount);
+
+        os_unfair_lock_lock(&_queueLock);
+        _resizeInProgress = false;
+
+        if (ret == kIOReturnBusy) {
+            // A report is blocked on the old queue, retry at the next safe point
+            return false;
+        } else if (ret != kIOReturnSuccess) {
+            HIDLogError("kIOHIDLibUserClientResizeQueue:%#x depth:%u, disabling autotune", ret, _depth);
+            _autotuneResize = false;
+            _autotuneMaxDepth = 0;
+            return false;
+        }
+
+        _autotuneResize = false;
+        _pendingQueueToken = output;
+    }
+
+    require_quiet(_pendingQueueToken && _queueMemory, exit);
+    require_quiet(_queueMemory->head == _queueMemory->tail, exit);
+
+    // Map the new queue while the old one stays in place. Nothing is
+    // enqueued to the old queue anymore, so readers only find it empty.
+    newToken = _pendingQueueToken;
+    _resizeInProgress = true;
+    os_unfair_lock_unlock(&_queueLock);
+
+    IOConnectMapMemory(_device.connect,
+                       (uint32_t)newToken,
+                       mach_task_self(),
+                       &mappedMem,
+                       &memSize,
+                       kIOMapAnywhere);
+    if (mappedMem) {
+        newQueueMemorySize = memSize - sizeof(IOHIDQueueHeader) - DATA_QUEUE_MEMORY_HEADER_SIZE - DATA_QUEUE_MEMORY_APPENDIX_SIZE;
+        newAnalytics = [self createUsageAnalytics:newQueueMemorySize];
+    }
+
+    os_unfair_lock_lock(&_queueLock);
+    _resizeInProgress = false;
+    require_action(mappedMem, exit, HIDLogError("Unable to map queue generation %u", _queueGeneration + 1));
+
+    oldToken = _queueToken;
+    oldHeader = _queueHeader;
+    oldAnalytics = _usageAnalytics;
+
+    _queueToken = newToken;
+    _queueHeader = (IOHIDQueueHeader *)mappedMem;
+    _queueMemory = (IODataQueueMemory *)(mappedMem + sizeof(IOHIDQueueHeader));
+    _queueMemorySize = newQueueMemorySize;
+    _usageAnalytics = newAnalytics;
+    _pendingQueueToken = 0;
+    _lastTail = 0;
+    _autotuneLastTail = 0;
+    _autotuneDropCount = 0;
+    _queueGeneration++;
+
+    HIDLogDebug("Queue generation %u depth %u size %u", _queueGeneration, _depth, (uint32_t)_queueMemorySize);
+
+    // The old queue is no longer reachable, so release it without the lock
+    os_unfair_lock_unlock(&_queueLock);
+
+    if (oldHeader) {
+#if !__LP64__
+        IOConnectUnmapMemory(_device.connect, (uint32_t)oldToken, mach_task_self(), (vm_address_t)oldHeader);
+#else
+        IOConnectUnmapMemory(_device.connect, (uint32_t)oldToken, mach_task_self(), (mach_vm_address_t)oldHeader);
+#endif
+    }
+    if (oldAnalytics) {
+        IOHIDAnalyticsEventCancel(oldAnalytics);
+        CFRelease(oldAnalytics);
+    }
+    IOConnectCallScalarMethod(_device.connect,
+                              kIOHIDLibUserClientDisposeQueue,
+                              &oldToken,
+                              1,
+                              NULL,
+                              NULL);
+
+    os_unfair_lock_lock(&_queueLock);
+
+    return true;
+
+exit:
+    return false;
+}
+
 - (void)signalQueueEmpty
 {
     if (!_queueHeader) {
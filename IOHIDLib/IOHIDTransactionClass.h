@@ -34,10 +34,16 @@
     IOHIDTransactionDirectionType   _direction;
     NSMutableArray                  *_elements;
     __weak IOHIDDeviceClass         *_device;
+    uint32_t                        _lastCommitReportCount;
 }
 
 - (nullable instancetype)initWithDevice:(nonnull IOHIDDeviceClass *)device;
 
+// Number of reports sent to the device by the last synchronous output commit.
+// Elements that share a report are sent together, so this is at most the
+// number of distinct (report type, report ID) pairs in the transaction.
+@property (readonly) uint32_t lastCommitReportCount;
+
 @end
 
 @interface IOHIDOutputTransactionClass : IOHIDTransactionClass {
@@ -32,6 +32,8 @@
 
 @implementation IOHIDTransactionClass
 
+@synthesize lastCommitReportCount = _lastCommitReportCount;
+
 - (HRESULT)queryInterface:(REFIID)uuidBytes
              outInterface:(LPVOID *)outInterface
 {
@@ -340,6 +342,8 @@ static IOReturn _commit(void *iunknown,
     uint64_t                  regID;
     IOReturn                  ret          = kIOReturnError;
     uint64_t                  input[3]     = {0};
+    uint64_t                  reportCount  = 0;
+    uint32_t                  outputCount  = 1;
     size_t                    dataSize     = 0;
     size_t                    dataOffset   = 0;
     void                    * cookies      = NULL;
@@ -397,10 +401,14 @@ static IOReturn _commit(void *iunknown,
         if (callback) {
             ret = IOConnectCallAsyncMethod(_device.connect, kIOHIDLibUserClientPostElementValues, [_device getPort], asyncRef, kIOAsyncCalloutCount, input, 1, elementData, dataSize, NULL, NULL, NULL, NULL);
         } else {
-            ret = IOConnectCallMethod(_device.connect, kIOHIDLibUserClientPostElementValues, input, 1, elementData, dataSize, NULL, NULL, NULL, NULL);
+            ret = IOConnectCallMethod(_device.connect, kIOHIDLibUserClientPostElementValues, input, 1, elementData, dataSize, &reportCount, &outputCount, NULL, NULL);
         }
         require_noerr_action(ret, exit, HIDLogError("kIOHIDLibUserClientPostElementValues(%#llx):%#x", regID, ret));
 
+        if (!callback) {
+            _lastCommitReportCount = (uint32_t)reportCount;
+        }
+
     } else {
         for (uint32_t i = 0; i < count; i++) {
             element = [_elements objectAtIndex:i];
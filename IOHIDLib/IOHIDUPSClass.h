@@ -49,6 +49,10 @@
     
     NSMutableArray                          *_commandElements;
     NSMutableArray                          *_eventElements;
+    NSMutableArray                          *_pollElements;
+    NSMutableDictionary                     *_eventElementsByKey;
+    NSMutableDictionary                     *_inputElementsByCookie;
+    NSMutableDictionary                     *_pollElementsByInputUsage;
     
     IOUPSEventCallbackFunction              _eventCallback;
     void *                                  _eventTarget;
@@ -44,6 +44,10 @@
 
 #define kIOHIDUnitExponentVolt  7
 
+// Poll interval bounds (in seconds) for polled feature elements
+#define kUPSPollIntervalMin     5.0
+#define kUPSPollIntervalMax     60.0
+
 @implementation IOHIDUPSClass
 
 - (HRESULT)queryInterface:(REFIID)uuidBytes
@@ -130,6 +134,34 @@ static void logUpsEventDict(NSDictionary* dict, NSString* s)
     }
 }
 
+/*
+ * Power source state that needs to be seen promptly: AC present, charging
+ * state and shutdown requests. These elements keep the minimum poll interval
+ * instead of backing off.
+ */
+static bool isStateCriticalElement(HIDLibElement *element)
+{
+    switch (element.usagePage) {
+        case kHIDPage_PowerDevice:
+            switch (element.usage) {
+                case kHIDUsage_PD_ShutdownRequested:
+                case kHIDUsage_PD_ShutdownImminent:
+                    return true;
+            }
+            break;
+        case kHIDPage_BatterySystem:
+            switch (element.usage) {
+                case kHIDUsage_BS_ACPresent:
+                case kHIDUsage_BS_Charging:
+                case kHIDUsage_BS_Discharging:
+                    return true;
+            }
+            break;
+    }
+    
+    return false;
+}
+
 - (void)parseElements:(NSArray *)elements
 {
     /*
@@ -382,56 +414,6 @@ static void logUpsEventDict(NSDictionary* dict, NSString* s)
             [_elements.output addObject:element];
         } else {
             [_elements.feature addObject:element];
-            
-            UPSLog("Feature element (UP : %x, U : %x) added for polling", element.usagePage, element.usage);
-            
-            /*
-             * Feature elements should be polled every 5 seconds. We create a
-             * timer here and return it with the array we pass back in the
-             * createAsyncEventSource method.
-             */
-            if (!_timer) {
-                UPSLog("Create time for polling feature reports");
-                
-                _timer = [[NSTimer alloc] initWithFireDate:[NSDate date]
-                                                  interval:5.0
-                                                   repeats:YES
-                                                     block:^(NSTimer *timer __unused)
-                {
-                    // Check if feature reports need updating, if all elements are
-                    // const and updated we can stop the timer.
-                    bool needsUpdate = false;
-                    for (id obj in _elements.feature) {
-                        HIDLibElement *feature = (HIDLibElement*)obj;
-                        if (feature.isConstant) {
-                            needsUpdate = !feature.isUpdated;
-                            if (needsUpdate) {
-                                break;
-                            }
-                        } else {
-                            needsUpdate = true;
-                            break;
-                        }
-                    }
-
-                    if (!needsUpdate) {
-                        [_timer invalidate];
-                        _timer = nil;
-                        return;
-                    }
-
-                    // only dispatch an event if the element values were updated.
-                    if ([self pollEventUpdate] && _eventCallback) {
-                        logUpsEventDict(_upsUpdatedEvent, @"timer dispatchEvent");
-
-                        (_eventCallback)(_eventTarget,
-                                         kIOReturnSuccess,
-                                         _eventRefcon,
-                                         (void *)&_ups,
-                                         (__bridge CFDictionaryRef)_upsUpdatedEvent);
-                    }
-                }];
-            }
         }
     }
     
@@ -449,6 +431,78 @@ static void logUpsEventDict(NSDictionary* dict, NSString* s)
     [_eventElements addObjectsFromArray:_elements.input];
     [_eventElements addObjectsFromArray:_elements.feature];
     
+    for (HIDLibElement *element in _eventElements) {
+        NSMutableArray *keyElements = _eventElementsByKey[element.psKey];
+        
+        if (!keyElements) {
+            keyElements = [[NSMutableArray alloc] init];
+            _eventElementsByKey[element.psKey] = keyElements;
+        }
+        
+        [keyElements addObject:element];
+    }
+    
+    for (HIDLibElement *element in _elements.input) {
+        _inputElementsByCookie[@(element.elementCookie)] = element;
+    }
+    
+    /*
+     * Feature elements whose usage is also declared by an input element are
+     * kept up to date by the element queue once that input is actually
+     * reported. Many UPSes declare input elements but never send interrupt
+     * reports, so those features are polled like the others until the first
+     * input value for their usage arrives, see valueAvailableCallback.
+     */
+    for (HIDLibElement *feature in _elements.feature) {
+        for (HIDLibElement *input in _elements.input) {
+            if (input.usagePage == feature.usagePage &&
+                input.usage == feature.usage) {
+                NSNumber *usageKey = @(((uint64_t)feature.usagePage << 32) | feature.usage);
+                NSMutableArray *features = _pollElementsByInputUsage[usageKey];
+                
+                if (!features) {
+                    features = [[NSMutableArray alloc] init];
+                    _pollElementsByInputUsage[usageKey] = features;
+                }
+                
+                [features addObject:feature];
+                break;
+            }
+        }
+        
+        feature.pollInterval = kUPSPollIntervalMin;
+        [_pollElements addObject:feature];
+        
+        UPSLog("Feature element (UP : %x, U : %x) added for polling", feature.usagePage, feature.usage);
+    }
+    
+    /*
+     * Polled feature elements are read on a timer that we return with the
+     * array we pass back in the createAsyncEventSource method. The timer
+     * fires at the minimum poll interval, and each element is only read once
+     * its own interval has elapsed.
+     */
+    if (_pollElements.count && !_timer) {
+        UPSLog("Create timer for polling feature reports");
+        
+        _timer = [[NSTimer alloc] initWithFireDate:[NSDate date]
+                                          interval:kUPSPollIntervalMin
+                                           repeats:YES
+                                             block:^(NSTimer *timer __unused)
+        {
+            // only dispatch an event if the element values were updated.
+            if ([self pollEventUpdate] && _upsUpdatedEvent.count && _eventCallback) {
+                logUpsEventDict(_upsUpdatedEvent, @"timer dispatchEvent");
+                
+                (_eventCallback)(_eventTarget,
+                                 kIOReturnSuccess,
+                                 _eventRefcon,
+                                 (void *)&_ups,
+                                 (__bridge CFDictionaryRef)_upsUpdatedEvent);
+            }
+        }];
+    }
+    
     UPSLog("capabilities: %@", _capabilities);
 }
 
@@ -475,7 +529,8 @@ static void logUpsEventDict(NSDictionary* dict, NSString* s)
      */
     HIDLibElement *latest = nil;
     uint64_t latestTimestamp = 0;
-    NSArray *elements = [self copyElements:array psKey:psKey];
+    NSArray *elements = (array == _eventElements) ? _eventElementsByKey[psKey] :
+                                                    [self copyElements:array psKey:psKey];
     
     for (HIDLibElement *element in elements) {
         if (element.timestamp > latestTimestamp) {
@@ -843,23 +898,21 @@ static void _valueAvailableCallback(void *context,
         IOHIDValueRef value = NULL;
         result = (*_queue)->copyNextValue(_queue, &value, 0, 0);
         if (value) {
-            HIDLibElement *tmp;
             HIDLibElement *element;
-            NSUInteger index;
             IOHIDElementRef elementRef = IOHIDValueGetElement(value);
             
-            tmp = [[HIDLibElement alloc] initWithElementRef:elementRef];
-            index = [_elements.input indexOfObject:tmp];
-            
-            element = [_elements.input objectAtIndex:index];
-            element.valueRef = value;
+            element = _inputElementsByCookie[@(IOHIDElementGetCookie(elementRef))];
+            if (element) {
+                element.valueRef = value;
+                [self stopPollingInputUsage:element];
+            }
             
             CFRelease(value);
         }
     }
     
-    [self updateEvent];
-    if (_eventCallback) {
+    // only dispatch the keys that actually changed
+    if ([self updateEvent] && _upsUpdatedEvent.count && _eventCallback) {
         logUpsEventDict(_upsEvent, @"dispatchEvent");
         
         (_eventCallback)(_eventTarget,
@@ -870,17 +923,98 @@ static void _valueAvailableCallback(void *context,
     }
 }
 
+- (void)stopPollingInputUsage:(HIDLibElement *)input
+{
+    // The device reports this usage through input reports, so its feature
+    // elements no longer need to be polled
+    NSNumber *usageKey = @(((uint64_t)input.usagePage << 32) | input.usage);
+    NSArray *features = _pollElementsByInputUsage[usageKey];
+    
+    if (!features) {
+        return;
+    }
+    
+    for (HIDLibElement *feature in features) {
+        UPSLog("Feature element (UP : %x, U : %x) reported via input, stop polling", feature.usagePage, feature.usage);
+        [_pollElements removeObject:feature];
+    }
+    [_pollElementsByInputUsage removeObjectForKey:usageKey];
+    
+    if (!_pollElements.count && _timer) {
+        UPSLog("No feature elements left to poll, stop timer");
+        [_timer invalidate];
+        _timer = nil;
+    }
+}
+
 - (void)initialEventUpdate
 {
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    
     [self updateElements:_elements.input];
     [self updateElements:_elements.feature];
+    
+    // every feature element was just read, so start each poll interval now
+    for (HIDLibElement *element in _pollElements) {
+        element.nextPollTime = now + element.pollInterval;
+    }
 
     [self updateEvent];
 }
 
 - (BOOL)pollEventUpdate
 {
-    [self updateElements:_elements.feature];
+    /*
+     * Only read the polled feature elements whose poll interval has elapsed.
+     * Elements that keep returning the same value back off up to
+     * kUPSPollIntervalMax, and drop back to kUPSPollIntervalMin as soon as
+     * they change. State-critical elements are always polled at
+     * kUPSPollIntervalMin. Constant elements are removed once they have
+     * been read.
+     */
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    NSMutableArray *dueElements = [[NSMutableArray alloc] init];
+    NSMutableArray *previousValues = [[NSMutableArray alloc] init];
+    NSUInteger index = 0;
+    
+    for (HIDLibElement *element in _pollElements) {
+        if (element.nextPollTime > now) {
+            continue;
+        }
+        
+        [dueElements addObject:element];
+        [previousValues addObject:@(element.integerValue)];
+    }
+    
+    if (!dueElements.count) {
+        return NO;
+    }
+    
+    [self updateElements:dueElements];
+    
+    for (HIDLibElement *element in dueElements) {
+        NSNumber *previousValue = previousValues[index++];
+        
+        if (element.isConstant && element.isUpdated) {
+            [_pollElements removeObject:element];
+            continue;
+        }
+        
+        if (element.integerValue != previousValue.integerValue || isStateCriticalElement(element)) {
+            element.pollInterval = kUPSPollIntervalMin;
+        } else {
+            element.pollInterval = MIN(element.pollInterval * 2, kUPSPollIntervalMax);
+        }
+        
+        element.nextPollTime = now + element.pollInterval;
+    }
+    
+    if (!_pollElements.count) {
+        UPSLog("No feature elements left to poll, stop timer");
+        [_timer invalidate];
+        _timer = nil;
+    }
+    
     return [self updateEvent];
 }
 
@@ -1271,6 +1405,10 @@ static IOReturn _createAsyncEventSource(void *iunknown, CFTypeRef *source)
     _elements.feature = [[NSMutableArray alloc] init];
     _commandElements = [[NSMutableArray alloc] init];
     _eventElements = [[NSMutableArray alloc] init];
+    _pollElements = [[NSMutableArray alloc] init];
+    _eventElementsByKey = [[NSMutableDictionary alloc] init];
+    _inputElementsByCookie = [[NSMutableDictionary alloc] init];
+    _pollElementsByInputUsage = [[NSMutableDictionary alloc] init];
     _upsEvent = [[NSMutableDictionary alloc] init];
     _upsUpdatedEvent = [[NSMutableDictionary alloc] init];
     _debugInformation = [[NSMutableDictionary alloc] init];
@@ -71,6 +71,234 @@ IOMallocZeroData(size_t length);
 
 #endif
 
+static const HIDDescriptorLimits gHIDDefaultDescriptorLimits =
+{
+	kHIDDefaultMaxCollections,
+	kHIDDefaultMaxReportItems,
+	kHIDDefaultMaxUsages,
+	kHIDDefaultMaxReportItemBits,
+	kHIDDefaultMaxNesting
+};
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDInitItemCounts - Reset the running item totals
+ *
+ *	 Input:
+ *			  ptCounts				- The Item Counts Structure
+ *			  ptLimits				- The limits to count against, or NULL
+ *										for the defaults
+ *	 Output:
+ *			  ptCounts				- The Item Counts Structure
+ *
+ *------------------------------------------------------------------------------
+*/
+void HIDInitItemCounts(HIDItemCounts *ptCounts, const HIDDescriptorLimits *ptLimits)
+{
+	ptCounts->collectionCount = 1;
+	ptCounts->reportItemCount = 0;
+	ptCounts->usages = 0;
+	ptCounts->usageRanges = 0;
+	ptCounts->strings = 0;
+	ptCounts->stringRanges = 0;
+	ptCounts->desigs = 0;
+	ptCounts->desigRanges = 0;
+	ptCounts->reportCount = 1;
+	ptCounts->globalsNesting = 0;
+	ptCounts->maxGlobalsNesting = 0;
+	ptCounts->collectionNesting = 0;
+	ptCounts->maxCollectionNesting = 0;
+	ptCounts->expandedUsages = 0;
+	ptCounts->haveUsageMin = false;
+	ptCounts->haveUsageMax = false;
+	ptCounts->usageMinimum = 0;
+	ptCounts->usageMaximum = 0;
+	ptCounts->reportSize = 0;
+	ptCounts->reportCountGlobal = 0;
+	ptCounts->limits = (ptLimits != NULL) ? ptLimits : &gHIDDefaultDescriptorLimits;
+}
+
+/*
+ *	Deepest Collection or Push nesting the limits allow
+*/
+static int HIDMaxNesting(HIDItemCounts *ptCounts)
+{
+	if (ptCounts->limits->maxNesting > kHIDMaxNesting)
+		return kHIDMaxNesting;
+	return (int) ptCounts->limits->maxNesting;
+}
+
+/*
+ *	Add the usages of a Usage Minimum and Maximum pair once both are seen,
+ *	  the usage page half of a 4 byte usage is not part of the range
+*/
+static OSStatus HIDCountUsageRange(HIDItem *ptItem, HIDItemCounts *ptCounts)
+{
+	UInt32 iUsage = ptItem->unsignedValue;
+	UInt32 iUsages = 1;
+
+	if (ptItem->byteCount == 4)
+		iUsage &= 0xFFFF;
+	if (ptItem->tag == kHIDTagUsageMinimum)
+	{
+		ptCounts->usageMinimum = iUsage;
+		ptCounts->haveUsageMin = true;
+	}
+	else
+	{
+		ptCounts->usageMaximum = iUsage;
+		ptCounts->haveUsageMax = true;
+	}
+	if (!ptCounts->haveUsageMin || !ptCounts->haveUsageMax)
+		return kHIDSuccess;
+	ptCounts->haveUsageMin = false;
+	ptCounts->haveUsageMax = false;
+
+	if (ptCounts->usageMaximum >= ptCounts->usageMinimum)
+		iUsages = ptCounts->usageMaximum - ptCounts->usageMinimum + 1;
+	if (os_add_overflow(ptCounts->expandedUsages, iUsages, &ptCounts->expandedUsages)
+	 || (ptCounts->expandedUsages > ptCounts->limits->maxUsages))
+		return kHIDInvalidPreparsedDataErr;
+	return kHIDSuccess;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDCountItem - Add one item to the running totals
+ *
+ *	 Input:
+ *			  ptItem				- The Item just read by HIDNextItem
+ *			  ptCounts				- The Item Counts Structure
+ *	 Output:
+ *			  ptCounts				- The Item Counts Structure
+ *	 Returns:
+ *			  kHIDSuccess		   - Success
+ *			  kHIDInvalidPreparsedDataErr - Unbalanced Collection or Pop,
+ *										or over one of the limits
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDCountItem(HIDItem *ptItem, HIDItemCounts *ptCounts)
+{
+	const HIDDescriptorLimits *ptLimits = ptCounts->limits;
+
+	switch (ptItem->itemType)
+	{
+		case kHIDTypeMain:
+			switch (ptItem->tag)
+			{
+				case kHIDTagCollection:
+					ptCounts->collectionCount++;
+					ptCounts->collectionNesting++;
+					if (ptCounts->collectionNesting > ptCounts->maxCollectionNesting)
+						ptCounts->maxCollectionNesting = ptCounts->collectionNesting;
+					if (((UInt32)(ptCounts->collectionCount - 1) > ptLimits->maxCollections)
+					 || (ptCounts->collectionNesting > HIDMaxNesting(ptCounts)))
+						return kHIDInvalidPreparsedDataErr;
+					break;
+				case kHIDTagEndCollection:
+					if (ptCounts->collectionNesting-- == 0)
+						return kHIDInvalidPreparsedDataErr;
+					break;
+				case kHIDTagInput:
+				case kHIDTagOutput:
+				case kHIDTagFeature:
+					ptCounts->reportItemCount++;
+					if (((UInt32)ptCounts->reportItemCount > ptLimits->maxReportItems)
+					 || (((uint64_t)ptCounts->reportSize * ptCounts->reportCountGlobal) > ptLimits->maxReportItemBits))
+						return kHIDInvalidPreparsedDataErr;
+					break;
+			}
+			break;
+		case kHIDTypeGlobal:
+			switch (ptItem->tag)
+			{
+				case kHIDTagReportSize:
+					ptCounts->reportSize = ptItem->unsignedValue;
+					break;
+				case kHIDTagReportCount:
+					ptCounts->reportCountGlobal = ptItem->unsignedValue;
+					break;
+				case kHIDTagReportID:
+					ptCounts->reportCount++;
+					break;
+				case kHIDTagPush:
+					if (ptCounts->globalsNesting >= HIDMaxNesting(ptCounts))
+						return kHIDInvalidPreparsedDataErr;
+					ptCounts->reportSizeStack[ptCounts->globalsNesting] = ptCounts->reportSize;
+					ptCounts->reportCountStack[ptCounts->globalsNesting] = ptCounts->reportCountGlobal;
+					ptCounts->globalsNesting++;
+					if (ptCounts->globalsNesting > ptCounts->maxGlobalsNesting)
+						ptCounts->maxGlobalsNesting = ptCounts->globalsNesting;
+					break;
+				case kHIDTagPop:
+					ptCounts->globalsNesting--;
+					if (ptCounts->globalsNesting < 0)
+						return kHIDInvalidPreparsedDataErr;
+					ptCounts->reportSize = ptCounts->reportSizeStack[ptCounts->globalsNesting];
+					ptCounts->reportCountGlobal = ptCounts->reportCountStack[ptCounts->globalsNesting];
+					break;
+			}
+			break;
+		case kHIDTypeLocal:
+			switch (ptItem->tag)
+			{
+				case kHIDTagUsage:
+					ptCounts->usages++;
+					ptCounts->expandedUsages++;
+					if (ptCounts->expandedUsages > ptLimits->maxUsages)
+						return kHIDInvalidPreparsedDataErr;
+					break;
+				case kHIDTagUsageMinimum:
+				case kHIDTagUsageMaximum:
+					ptCounts->usageRanges++;
+					return HIDCountUsageRange(ptItem, ptCounts);
+				case kHIDTagStringIndex:
+					ptCounts->strings++;
+					break;
+				case kHIDTagStringMinimum:
+				case kHIDTagStringMaximum:
+					ptCounts->stringRanges++;
+					break;
+				case kHIDTagDesignatorIndex:
+					ptCounts->desigs++;
+					break;
+				case kHIDTagDesignatorMinimum:
+				case kHIDTagDesignatorMaximum:
+					ptCounts->desigRanges++;
+					break;
+			}
+	}
+	return kHIDSuccess;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDCheckItemCounts - Reject malformed descriptors once all items are counted
+ *
+ *	 Input:
+ *			  ptCounts				- The Item Counts Structure
+ *	 Returns:
+ *			  kHIDSuccess		   - Success
+ *			  kHIDInvalidPreparsedDataErr - Descriptor is malformed
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDCheckItemCounts(HIDItemCounts *ptCounts)
+{
+	if ((ptCounts->collectionNesting != 0)
+	 || (ptCounts->collectionCount == 1)
+	 || (ptCounts->reportItemCount == 0)
+	 || ((ptCounts->usageRanges & 1) == 1)
+	 || ((ptCounts->stringRanges & 1) == 1)
+	 || ((ptCounts->desigRanges & 1) == 1))
+		return kHIDInvalidPreparsedDataErr;
+	return kHIDSuccess;
+}
+
 /*
  *------------------------------------------------------------------------------
  *
@@ -90,26 +318,20 @@ IOMallocZeroData(size_t length);
 OSStatus HIDCountDescriptorItems(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
 {
 	OSStatus iStatus;
+	OSStatus iCountStatus;
 	IOByteCount iSpaceRequired;
+	HIDItemCounts tCounts;
 	HIDItem *ptItem;
 	UInt8 *pMem;
 	vm_size_t sz = 0;
-/*
- *	Initialize Counters
-*/
-	int collectionCount	 = 1;
-	int reportItemCount	 = 0;
-	int iUsages		  = 0;
-	int iUsageRanges  = 0;
-	int iStrings	  = 0;
-	int iStringRanges = 0;
-	int iDesigs		  = 0;
-	int iDesigRanges  = 0;
-	int reportCount		 = 1;
-	int globalsNesting = 0;
-	int iMaxGlobalsNesting = 0;
-	int collectionNesting = 0;
-	int iMaxCollectionNesting = 0;
+	int collectionCount;
+	int reportItemCount;
+	int iUsages;
+	int iStrings;
+	int iDesigs;
+	int reportCount;
+	int iMaxGlobalsNesting;
+	int iMaxCollectionNesting;
 /*
  *	Disallow NULL Pointers
 */
@@ -127,91 +349,30 @@ OSStatus HIDCountDescriptorItems(HIDReportDescriptor *ptDescriptor, HIDPreparsed
 /*
  *	Count various items in the descriptor
 */
+	HIDInitItemCounts(&tCounts, ptDescriptor->limits);
 	while ((iStatus = HIDNextItem(ptDescriptor)) == kHIDSuccess)
 	{
-		switch (ptItem->itemType)
-		{
-			case kHIDTypeMain:
-				switch (ptItem->tag)
-				{
-					case kHIDTagCollection:
-						collectionCount++;
-						collectionNesting++;
-						if (collectionNesting > iMaxCollectionNesting)
-							iMaxCollectionNesting = collectionNesting;
-						break;
-					case kHIDTagEndCollection:
-						if (collectionNesting-- == 0)
-							return kHIDInvalidPreparsedDataErr;
-						break;
-					case kHIDTagInput:
-					case kHIDTagOutput:
-					case kHIDTagFeature:
-						reportItemCount++;
-						break;
-				}
-				break;
-			case kHIDTypeGlobal:
-				switch (ptItem->tag)
-				{
-					case kHIDTagReportID:
-						reportCount++;
-						break;
-					case kHIDTagPush:
-						globalsNesting++;
-						if (globalsNesting > iMaxGlobalsNesting)
-							iMaxGlobalsNesting = globalsNesting;
-						break;
-					case kHIDTagPop:
-						globalsNesting--;
-						if (globalsNesting < 0)
-							return kHIDInvalidPreparsedDataErr;
-						break;
-				}
-				break;
-			case kHIDTypeLocal:
-				switch (ptItem->tag)
-				{
-					case kHIDTagUsage:
-						iUsages++;
-						break;
-					case kHIDTagUsageMinimum:
-					case kHIDTagUsageMaximum:
-						iUsageRanges++;
-						break;
-					case kHIDTagStringIndex:
-						iStrings++;
-						break;
-					case kHIDTagStringMinimum:
-					case kHIDTagStringMaximum:
-						iStringRanges++;
-						break;
-					case kHIDTagDesignatorIndex:
-						iDesigs++;
-						break;
-					case kHIDTagDesignatorMinimum:
-					case kHIDTagDesignatorMaximum:
-						iDesigRanges++;
-						break;
-				}
-		}
+		iCountStatus = HIDCountItem(ptItem, &tCounts);
+		if (iCountStatus != kHIDSuccess)
+			return iCountStatus;
 	}
 /*
  *	Disallow malformed descriptors
 */
-	if ((collectionNesting != 0)
-	 || (collectionCount == 1)
-	 || (reportItemCount == 0)
-	 || ((iUsageRanges & 1) == 1)
-	 || ((iStringRanges & 1) == 1)
-	 || ((iDesigRanges & 1) == 1))
-		return kHIDInvalidPreparsedDataErr;
+	iCountStatus = HIDCheckItemCounts(&tCounts);
+	if (iCountStatus != kHIDSuccess)
+		return iCountStatus;
+	collectionCount = tCounts.collectionCount;
+	reportItemCount = tCounts.reportItemCount;
+	reportCount = tCounts.reportCount;
+	iMaxGlobalsNesting = tCounts.maxGlobalsNesting;
+	iMaxCollectionNesting = tCounts.maxCollectionNesting;
 /*
  *	Summarize the Indices and Ranges
 */
-	iUsages += (iUsageRanges/2);
-	iStrings += (iStringRanges/2);
-	iDesigs += (iDesigRanges/2);
+	iUsages = tCounts.usages + (tCounts.usageRanges/2);
+	iStrings = tCounts.strings + (tCounts.stringRanges/2);
+	iDesigs = tCounts.desigs + (tCounts.desigRanges/2);
 /*
  *	Calculate the space needed for the structures
 */
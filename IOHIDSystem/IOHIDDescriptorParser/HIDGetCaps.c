@@ -256,3 +256,118 @@ OSStatus HIDGetCapabilities(HIDPreparsedDataRef preparsedDataRef, HIDCapabilitie
 	}
 	return kHIDSuccess;
 }
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDGetDescriptorStatistics - Summarize what an open descriptor describes
+ *
+ *	 Input:
+ *			  preparsedDataRef		- Pre-Parsed Data
+ *			  ptStatistics			- Pointer to caller-provided structure
+ *	 Output:
+ *			  ptStatistics			- Statistics
+ *	 Returns:
+ *			  kHIDSuccess			- Success
+ *			  kHIDNullPointerErr	- Argument, Pointer was Null
+ *			  kHIDInvalidPreparsedDataErr - Not open
+ *
+ *	NOTE: This is worked out from the tables, so it answers the same for
+ *		  preparsed data opened from an image.
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDGetDescriptorStatistics(HIDPreparsedDataRef preparsedDataRef, HIDDescriptorStatistics *ptStatistics)
+{
+	HIDPreparsedDataPtr ptPreparsedData = (HIDPreparsedDataPtr) preparsedDataRef;
+	HIDCollection *ptCollection;
+	HIDReportItem *ptReportItem;
+	HIDP_UsageItem *ptUsageItem;
+	uint64_t iUsages = 0;
+	uint64_t iElements;
+	uint64_t iBits;
+	UInt32 iRange;
+	UInt32 iDepth;
+	Boolean bButton;
+	Boolean bCaps;
+	Boolean bArray;
+	UInt32 i;
+	SInt32 j;
+/*
+ *	Disallow Null Pointers
+*/
+	if ((ptPreparsedData == NULL) || (ptStatistics == NULL))
+		return kHIDNullPointerErr;
+	if (ptPreparsedData->hidTypeIfValid != kHIDOSType)
+		return kHIDInvalidPreparsedDataErr;
+
+	ptStatistics->collectionCount = ptPreparsedData->collectionCount;
+	ptStatistics->reportItemCount = ptPreparsedData->reportItemCount;
+	ptStatistics->usageItemCount = ptPreparsedData->usageItemCount;
+	ptStatistics->reportCount = ptPreparsedData->reportCount;
+	ptStatistics->maxCollectionNesting = 0;
+	ptStatistics->maxReportItemBits = 0;
+/*
+ *	Collection depth, parents always come before their children
+*/
+	for (i = 1; i < ptPreparsedData->collectionCount; i++)
+	{
+		iDepth = 0;
+		ptCollection = &ptPreparsedData->collections[i];
+		while ((iDepth < ptPreparsedData->collectionCount) && (ptCollection != ptPreparsedData->collections))
+		{
+			iDepth++;
+			if ((ptCollection->parent < 0) || ((UInt32)ptCollection->parent >= ptPreparsedData->collectionCount))
+				break;
+			ptCollection = &ptPreparsedData->collections[ptCollection->parent];
+		}
+		if (ptStatistics->maxCollectionNesting < iDepth)
+			ptStatistics->maxCollectionNesting = iDepth;
+	}
+/*
+ *	Every collection, and a null and a report handler element per report
+*/
+	iElements = (uint64_t)ptPreparsedData->collectionCount + (2 * (uint64_t)ptPreparsedData->reportCount);
+	for (i = 0; i < ptPreparsedData->reportItemCount; i++)
+	{
+		ptReportItem = &ptPreparsedData->reportItems[i];
+		iBits = (uint64_t)ptReportItem->globals.reportSize * (UInt32)ptReportItem->globals.reportCount;
+		if (iBits > ptStatistics->maxReportItemBits)
+			ptStatistics->maxReportItemBits = (iBits > 0xFFFFFFFF) ? 0xFFFFFFFF : (UInt32)iBits;
+/*
+ *	Elements come only from button and value capabilities, one per usage
+*/
+		bButton = HIDIsButton(ptReportItem, preparsedDataRef);
+		bCaps = bButton || HIDIsVariable(ptReportItem, preparsedDataRef);
+		bArray = bButton && ((ptReportItem->dataModes & kHIDDataArrayBit) == kHIDDataArray);
+		for (j = 0; j < ptReportItem->usageItemCount; j++)
+		{
+			ptUsageItem = &ptPreparsedData->usageItems[ptReportItem->firstUsageItem + j];
+			iRange = 1;
+			if (ptUsageItem->isRange && (ptUsageItem->usageMaximum > ptUsageItem->usageMinimum))
+				iRange = (UInt32)(ptUsageItem->usageMaximum - ptUsageItem->usageMinimum) + 1;
+			iUsages += iRange;
+			if (!bCaps)
+				continue;
+/*
+ *	The element code widens keyboard array ranges to end at usage 0xDF
+*/
+			if (bArray && ptUsageItem->isRange
+			 && (ptUsageItem->usagePage == 0x07) && (ptUsageItem->usageMaximum < 0xDF))
+				iRange = (UInt32)(0xDF - ptUsageItem->usageMinimum) + 1;
+			iElements += iRange;
+		}
+/*
+ *	An array has a report handler, and a duplicate of it per report count
+*/
+		if (bArray)
+		{
+			iElements += 1;
+			if (ptReportItem->globals.reportCount > 1)
+				iElements += (UInt32)ptReportItem->globals.reportCount;
+		}
+	}
+	ptStatistics->usageCount = (iUsages > 0xFFFFFFFF) ? 0xFFFFFFFF : (UInt32)iUsages;
+	ptStatistics->elementCount = (iElements > 0xFFFFFFFF) ? 0xFFFFFFFF : (UInt32)iElements;
+	return kHIDSuccess;
+}
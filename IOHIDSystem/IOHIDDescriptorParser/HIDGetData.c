@@ -90,29 +90,50 @@ OSStatus HIDGetData(void * report, IOByteCount iReportLength,
 	if ((iSize == 0) || (iLastByte >= iReportLength) || (iLastByte < iStartByte))
 		return kHIDBadParameterErr;
 
-	// Pick up the data bytes backwards
-    data = 0;
-    for (iCurrentByte = iLastByte; iCurrentByte >= (int) iStartByte; iCurrentByte--)
-    {
-        data <<= 8;
-
-		iMask = 0xff;	//  1111 1111 initial mask
-		// if this is the 'last byte', then we need to mask off the top part of the byte
-		// to find the mask, we: find the position in this byte (lastBit % 8)
-		// then shift one to the left that many times plus one (to get one bit further)
-		// then subtract 1 to get all ones starting from the lastBit to the least signif bit
-		// ex: if iLastBit is 9, or iLastBit is 15, then we get: 
-		// 					1					7			(x % 8)
-		//			     0000 0100			1 0000 0000		(1 << (x + 1))
-		//				 0000 0011			0 1111 1111		(x - 1)
-		if (iCurrentByte == (int)iLastByte)
-			iMask = ((1 << (((unsigned) iLastBit % 8) + 1)) - 1);
-
-        data |= (unsigned) psReport[iCurrentByte] & iMask;
-	}
+#if HID_REPORT_WORD_ACCESS
+	// Fields of up to 32 bits come out of one 64-bit word. The word starts at
+	// the field's first byte, or is pulled back to end with the report; reports
+	// shorter than a word take the byte loop below.
+	if ((iSize <= kHIDReportWordMaxSize) && (iReportLength >= kHIDReportWordBytes))
+	{
+		unsigned iWordByte = iStartByte;
+		uint64_t word;
+
+		if (iWordByte > iReportLength - kHIDReportWordBytes)
+			iWordByte = (unsigned) (iReportLength - kHIDReportWordBytes);
+		word = HIDReadReportWord(psReport + iWordByte) >> ((iStartByte - iWordByte) * 8);
 
-	// Shift to the right to byte align the least significant bit
-	data >>= startBit;
+		// Mask above the last bit and, like the byte loop, keep the 32 bits
+		// from the start byte on
+		data = (unsigned) (word & ((1ULL << (startBit + iSize)) - 1)) >> startBit;
+	}
+	else
+#endif
+	{
+		// Pick up the data bytes backwards
+		data = 0;
+		for (iCurrentByte = iLastByte; iCurrentByte >= (int) iStartByte; iCurrentByte--)
+		{
+			data <<= 8;
+
+			iMask = 0xff;	//  1111 1111 initial mask
+			// if this is the 'last byte', then we need to mask off the top part of the byte
+			// to find the mask, we: find the position in this byte (lastBit % 8)
+			// then shift one to the left that many times plus one (to get one bit further)
+			// then subtract 1 to get all ones starting from the lastBit to the least signif bit
+			// ex: if iLastBit is 9, or iLastBit is 15, then we get: 
+			// 					1					7			(x % 8)
+			//			     0000 0100			1 0000 0000		(1 << (x + 1))
+			//				 0000 0011			0 1111 1111		(x - 1)
+			if (iCurrentByte == (int)iLastByte)
+				iMask = ((1 << (((unsigned) iLastBit % 8) + 1)) - 1);
+
+			data |= (unsigned) psReport[iCurrentByte] & iMask;
+		}
+
+		// Shift to the right to byte align the least significant bit
+		data >>= startBit;
+	}
 
 	// Sign extend the report item
 	if (bSignExtend)
@@ -0,0 +1,303 @@
+/*
+ * @APPLE_LICENSE_HEADER_START@
+ *
+ * Copyright (c) 2024 Apple Inc.  All Rights Reserved.
+ *
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ *
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ *
+ * @APPLE_LICENSE_HEADER_END@
+ */
+/*
+	File:		HIDGetScaledUsageValues.c
+
+	Contains:	Batch extraction and scaling of the values in a report.
+
+	HIDGetScaledValueEntries resolves, once, everything HIDGetScaledUsageValue
+	looks up per call: where each field of a report's value capabilities
+	sits, its usage, its logical and physical ranges, and a fixed point
+	multiplier standing in for the divide. HIDGetScaledUsageValues then
+	decodes a whole report from those entries in one pass.
+*/
+
+#include "HIDLib.h"
+
+/*
+ *	Bits needed to hold x
+*/
+static UInt32 HIDBitWidth(uint64_t x)
+{
+	UInt32 iBits = 0;
+
+	while (x != 0)
+	{
+		iBits++;
+		x >>= 1;
+	}
+	return iBits;
+}
+
+/*
+ *	Work out how an entry scales, see HIDScaleUsageValueIn
+ *
+ *	  With dL the logical and dP the physical range, a value v in range
+ *	  scales to physicalMin + trunc((v - logicalMin) * dP / dL).  Taking
+ *	  the multiplier as ceil(|dP| * 2^s / dL) with 2^s > dL^2 overshoots
+ *	  (v - logicalMin) * |dP| / dL by less than 1/dL, which is never
+ *	  enough to carry it past the next integer, so the shifted product
+ *	  truncates to the same quotient.
+*/
+static void HIDSetEntryScale(HIDScaledValueEntry *ptEntry)
+{
+	int64_t lDeltaL = (int64_t) ptEntry->logicalMax - ptEntry->logicalMin;
+	int64_t lDeltaP = (int64_t) ptEntry->physicalMax - ptEntry->physicalMin;
+	uint64_t lMagnitudeP = (lDeltaP < 0) ? (uint64_t) -lDeltaP : (uint64_t) lDeltaP;
+	UInt32 iShift;
+
+	ptEntry->multiplier = 0;
+	ptEntry->shift = 0;
+	if ((lDeltaL == 0) || (lDeltaP == 0))
+	{
+		ptEntry->flags |= kHIDScaledValueBadRange;
+		return;
+	}
+/*
+ *	An inverted logical range puts every value out of range
+*/
+	if (lDeltaL < 0)
+		return;
+	iShift = 2 * HIDBitWidth((uint64_t) lDeltaL);
+	if ((iShift + HIDBitWidth(lMagnitudeP)) > 62)
+	{
+		ptEntry->flags |= kHIDScaledValueDivide;
+		return;
+	}
+	ptEntry->multiplier = ((lMagnitudeP << iShift) + (uint64_t) lDeltaL - 1) / (uint64_t) lDeltaL;
+	ptEntry->shift = iShift;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDGetScaledValueEntries - Describe the value fields of a report
+ *
+ *	 Input:
+ *			  reportType		   - HIDP_Input, HIDP_Output, HIDP_Feature
+ *			  reportID				- The report ID, zero if there are none
+ *			  entries				- Entry array, or NULL
+ *			  piEntryCount			- Maximum Entries
+ *			  preparsedDataRef		- Pre-Parsed Data
+ *	 Output:
+ *			  entries				- One entry per field of every
+ *										value capability, in report order
+ *			  piEntryCount			- Entries Populated, or needed
+ *	 Returns:
+ *			  kHIDSuccess			- Success
+ *			  kHIDNullPointerErr	- Argument, Pointer was Null
+ *			  kHIDBufferTooSmallErr - entries is NULL or too small, the
+ *										count needed is returned
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDGetScaledValueEntries(HIDReportType reportType,
+								  UInt32 reportID,
+								  HIDScaledValueEntry *entries,
+								  UInt32 *piEntryCount,
+								  HIDPreparsedDataRef preparsedDataRef)
+{
+	HIDPreparsedDataPtr ptPreparsedData = (HIDPreparsedDataPtr) preparsedDataRef;
+	HIDReportItem *ptReportItem;
+	HIDReportSizes *ptReport;
+	HIDScaledValueEntry tEntry;
+	HIDUsageAndPage tUsageAndPage;
+	UInt32 iMaxEntries;
+	UInt32 iCount = 0;
+	UInt32 iReportItem;
+	SInt32 iBitCount;
+	SInt32 i;
+/*
+ *	Disallow Null Pointers
+*/
+	if ((piEntryCount == NULL) || (ptPreparsedData == NULL))
+		return kHIDNullPointerErr;
+	if (ptPreparsedData->hidTypeIfValid != kHIDOSType)
+		return kHIDInvalidPreparsedDataErr;
+	iMaxEntries = (entries != NULL) ? *piEntryCount : 0;
+
+	for (iReportItem = 0; iReportItem < ptPreparsedData->reportItemCount; iReportItem++)
+	{
+		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
+		if ((ptReportItem->reportType != reportType)
+		 || ((UInt32) ptReportItem->globals.reportID != reportID)
+		 || !HIDIsVariable(ptReportItem, preparsedDataRef))
+			continue;
+/*
+ *		What every field of the report item shares
+*/
+		ptReport = &ptPreparsedData->reports[ptReportItem->globals.reportIndex];
+		switch (reportType)
+		{
+			case kHIDInputReport:
+				iBitCount = ptReport->inputBitCount;
+				break;
+			case kHIDOutputReport:
+				iBitCount = ptReport->outputBitCount;
+				break;
+			default:
+				iBitCount = ptReport->featureBitCount;
+				break;
+		}
+		tEntry.collection = ptReportItem->parent;
+		tEntry.reportID = reportID;
+		tEntry.reportLength = ((UInt32) iBitCount + 7) / 8;
+		tEntry.bitSize = (UInt32) ptReportItem->globals.reportSize;
+		tEntry.flags = 0;
+		tEntry.reserved = 0;
+		tEntry.logicalMin = ptReportItem->globals.logicalMinimum;
+		tEntry.logicalMax = ptReportItem->globals.logicalMaximum;
+		tEntry.physicalMin = ptReportItem->globals.physicalMinimum;
+		tEntry.physicalMax = ptReportItem->globals.physicalMaximum;
+		if ((tEntry.logicalMin < 0) || (tEntry.logicalMax < 0))
+			tEntry.flags |= kHIDScaledValueSigned;
+		if (ptReportItem->flags & kHIDReportItemFlag_Reversed)
+			tEntry.flags |= kHIDScaledValueReversed;
+		if ((ptReportItem->dataModes & kHIDDataNullStateBit) == kHIDDataNullState)
+			tEntry.flags |= kHIDScaledValueNullState;
+		if (ptPreparsedData->reportCount > 1)
+			tEntry.flags |= kHIDScaledValueReportID;
+		HIDSetEntryScale(&tEntry);
+/*
+ *		Then one entry per field
+*/
+		for (i = 0; i < ptReportItem->globals.reportCount; i++, iCount++)
+		{
+			if (iCount >= iMaxEntries)
+				continue;
+			tUsageAndPage.usagePage = 0;
+			tUsageAndPage.usage = 0;
+			HIDUsageAndPageFromIndex(preparsedDataRef, ptReportItem, (UInt32) i, &tUsageAndPage);
+			tEntry.usagePage = tUsageAndPage.usagePage;
+			tEntry.usage = tUsageAndPage.usage;
+			tEntry.startBit = (UInt32) ptReportItem->startBit + (tEntry.bitSize * (UInt32) i);
+			entries[iCount] = tEntry;
+		}
+	}
+	*piEntryCount = iCount;
+	if (iCount > iMaxEntries)
+		return kHIDBufferTooSmallErr;
+	return kHIDSuccess;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDGetScaledUsageValues - Get the scaled value of every field of a report
+ *
+ *	 Input:
+ *			  entries				- From HIDGetScaledValueEntries
+ *			  entryCount			- Number of entries
+ *			  piValues				- User-supplied place to put the values
+ *			  piStatuses			- Where to put each value's status, or NULL
+ *			  psReport				- An HID Report
+ *			  iReportLength			- The length of the Report
+ *	 Output:
+ *			  piValues				- One value per entry, zero where the
+ *										field could not be read
+ *			  piStatuses			- What HIDGetScaledUsageValue would return
+ *										for the value
+ *	 Returns:
+ *			  kHIDSuccess			- Every value scaled
+ *			  kHIDNullPointerErr	- Argument, Pointer was Null
+ *			  kHIDIncompatibleReportErr - The report has another report ID
+ *			  kHIDInvalidReportLengthErr - The report is too short
+ *			  Otherwise the status of the first value that did not scale,
+ *				which like HIDGetScaledUsageValue is left unscaled
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDGetScaledUsageValues(const HIDScaledValueEntry *entries,
+								 UInt32 entryCount,
+								 SInt32 *piValues,
+								 OSStatus *piStatuses,
+								 void *psReport,
+								 IOByteCount iReportLength)
+{
+	const HIDScaledValueEntry *ptEntry;
+	OSStatus iResult = kHIDSuccess;
+	OSStatus iStatus;
+	SInt32 iValue;
+	int64_t lData;
+	int64_t lDeltaL;
+	int64_t lDeltaP;
+	uint64_t lL;
+	uint64_t lP;
+	UInt32 i;
+/*
+ *	Disallow Null Pointers
+*/
+	if ((entries == NULL) || (piValues == NULL) || (psReport == NULL))
+		return kHIDNullPointerErr;
+	if (entryCount == 0)
+		return kHIDSuccess;
+/*
+ *	Every entry comes from the same report, so check it once
+*/
+	if ((entries->flags & kHIDScaledValueReportID)
+	 && (((UInt8 *) psReport)[0] != entries->reportID))
+		return kHIDIncompatibleReportErr;
+	if (entries->reportLength > iReportLength)
+		return kHIDInvalidReportLengthErr;
+
+	for (i = 0, ptEntry = entries; i < entryCount; i++, ptEntry++)
+	{
+		iStatus = HIDGetData(psReport, iReportLength, ptEntry->startBit, ptEntry->bitSize, &iValue,
+							 (ptEntry->flags & kHIDScaledValueSigned) != 0);
+		if (iStatus == kHIDSuccess)
+		{
+			if (ptEntry->flags & kHIDScaledValueReversed)
+				iValue = (SInt32) (((UInt32) ptEntry->logicalMin - (UInt32) iValue) + (UInt32) ptEntry->logicalMax);
+/*
+ *			Range check the logical value, then scale it
+*/
+			lData = iValue;
+			if ((lData < ptEntry->logicalMin) || (lData > ptEntry->logicalMax))
+				iStatus = (ptEntry->flags & kHIDScaledValueNullState) ? kHIDNullStateErr : kHIDValueOutOfRangeErr;
+			else if (ptEntry->flags & kHIDScaledValueBadRange)
+				iStatus = kHIDBadLogPhysValuesErr;
+			else
+			{
+				lDeltaP = (int64_t) ptEntry->physicalMax - ptEntry->physicalMin;
+				lL = (uint64_t) (lData - ptEntry->logicalMin);
+				if (ptEntry->flags & kHIDScaledValueDivide)
+				{
+					lDeltaL = (int64_t) ptEntry->logicalMax - ptEntry->logicalMin;
+					lP = (lL * (uint64_t) ((lDeltaP < 0) ? -lDeltaP : lDeltaP)) / (uint64_t) lDeltaL;
+				}
+				else
+					lP = (lL * ptEntry->multiplier) >> ptEntry->shift;
+				lData = ptEntry->physicalMin + ((lDeltaP < 0) ? -(int64_t) lP : (int64_t) lP);
+				iValue = (SInt32) lData;
+			}
+		}
+		else
+			iValue = 0;
+		piValues[i] = iValue;
+		if (piStatuses != NULL)
+			piStatuses[i] = iStatus;
+		if ((iStatus != kHIDSuccess) && (iResult == kHIDSuccess))
+			iResult = iStatus;
+	}
+	return iResult;
+}
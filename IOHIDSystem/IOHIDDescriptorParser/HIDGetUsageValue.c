@@ -91,10 +91,10 @@ OSStatus HIDGetUsageValue
 	HIDCollection *ptCollection;
 	HIDReportItem *ptReportItem;
 	OSStatus iStatus;
-	int iR;
 	SInt32 iValue;
 	int iStart;
 	int iReportItem;
+	int iEndReportItem;
 	UInt32 iUsageIndex;
 	Boolean bIncompatibleReport = false;
 /*
@@ -117,9 +117,11 @@ OSStatus HIDGetUsageValue
  *	Filter on ReportType and usagePage
 */
 	ptCollection = &ptPreparsedData->collections[iCollection];
-	for (iR=0; iR<ptCollection->reportItemCount; iR++)
+	iEndReportItem = ptCollection->firstReportItem + ptCollection->reportItemCount;
+	for (iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,ptCollection->firstReportItem,iEndReportItem);
+		 iReportItem < iEndReportItem;
+		 iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,iReportItem+1,iEndReportItem))
 	{
-		iReportItem = ptCollection->firstReportItem + iR;
 		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
 		if (HIDIsVariable(ptReportItem, preparsedDataRef)
 		 && HIDHasUsage(preparsedDataRef,ptReportItem,usagePage,usage,&iUsageIndex,NULL))
@@ -194,10 +196,10 @@ OSStatus HIDGetScaledUsageValue(HIDReportType reportType,
 	HIDCollection *ptCollection;
 	HIDReportItem *ptReportItem;
 	OSStatus iStatus;
-	int iR;
 	SInt32 iValue;
 	int iStart;
 	int iReportItem;
+	int iEndReportItem;
 	UInt32 iUsageIndex;
 	Boolean bIncompatibleReport = false;
 /*
@@ -220,9 +222,11 @@ OSStatus HIDGetScaledUsageValue(HIDReportType reportType,
  *	Filter on ReportType and usagePage
 */
 	ptCollection = &ptPreparsedData->collections[iCollection];
-	for (iR=0; iR<ptCollection->reportItemCount; iR++)
+	iEndReportItem = ptCollection->firstReportItem + ptCollection->reportItemCount;
+	for (iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,ptCollection->firstReportItem,iEndReportItem);
+		 iReportItem < iEndReportItem;
+		 iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,iReportItem+1,iEndReportItem))
 	{
-		iReportItem = ptCollection->firstReportItem + iR;
 		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
 		if (HIDIsVariable(ptReportItem, preparsedDataRef)
 		 && HIDHasUsage(preparsedDataRef,ptReportItem,usagePage,usage,&iUsageIndex,NULL))
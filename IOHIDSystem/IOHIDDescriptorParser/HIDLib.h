@@ -90,11 +90,64 @@ struct HIDReportDescriptor
 	Boolean				haveDesigMax;
 	SInt32				desigMinimum;
 	SInt32				desigMaximum;
+	const HIDDescriptorLimits *	limits;
 };
 typedef struct HIDReportDescriptor	HIDReportDescriptor;
 
+/*
+ *	Running totals of the items seen so far in a descriptor.
+ *	  The collection and report counts include the virtual
+ *	  collection and the default report.  Report Size and
+ *	  Report Count are followed through Push and Pop so that
+ *	  every main item can be checked against the limits.
+*/
+struct HIDItemCounts
+{
+	int					collectionCount;
+	int					reportItemCount;
+	int					usages;
+	int					usageRanges;
+	int					strings;
+	int					stringRanges;
+	int					desigs;
+	int					desigRanges;
+	int					reportCount;
+	int					globalsNesting;
+	int					maxGlobalsNesting;
+	int					collectionNesting;
+	int					maxCollectionNesting;
+	UInt32				expandedUsages;
+	Boolean				haveUsageMin;
+	Boolean				haveUsageMax;
+	UInt32				usageMinimum;
+	UInt32				usageMaximum;
+	UInt32				reportSize;
+	UInt32				reportCountGlobal;
+	UInt32				reportSizeStack[kHIDMaxNesting];
+	UInt32				reportCountStack[kHIDMaxNesting];
+	const HIDDescriptorLimits *	limits;
+};
+typedef struct HIDItemCounts	HIDItemCounts;
+
 /* And now our extern procedures that are not external entry points in our shared library */
 
+extern void
+HIDInitItemCounts		   (HIDItemCounts *			counts,
+							const HIDDescriptorLimits *	limits);
+
+extern OSStatus
+HIDCountItem			   (HIDItem *				item,
+							HIDItemCounts *			counts);
+
+extern OSStatus
+HIDCheckItemCounts		   (HIDItemCounts *			counts);
+
+extern void
+HIDBuildUsageIndex		   (HIDPreparsedDataPtr 	preparsedData);
+
+extern void
+HIDFreeUsageIndex		   (HIDPreparsedDataPtr 	preparsedData);
+
 extern OSStatus
 HIDCountDescriptorItems	   (HIDReportDescriptor *	reportDescriptor,
 							HIDPreparsedDataPtr 	preparsedData);
@@ -106,6 +159,10 @@ extern OSStatus
 HIDParseDescriptor		   (HIDReportDescriptor *	reportDescriptor,
 							HIDPreparsedDataPtr 	preparsedData);
 
+extern OSStatus
+HIDParseDescriptorOnePass  (HIDReportDescriptor *	reportDescriptor,
+							HIDPreparsedDataPtr 	preparsedData);
+
 extern OSStatus
 HIDProcessCollection	   (HIDReportDescriptor *	reportDescriptor,
 							HIDPreparsedDataPtr 	preparsedData);
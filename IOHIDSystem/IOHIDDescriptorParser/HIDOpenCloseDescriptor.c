@@ -124,6 +124,7 @@ OSStatus HIDCloseReportDescriptor(HIDPreparsedDataRef preparsedDataRef)
 		IOFreeData(ptPreparsedData->rawMemPtr, (size_t)ptPreparsedData->numBytesAllocated);
 		ptPreparsedData->rawMemPtr = NULL;
 	}
+	HIDFreeUsageIndex(ptPreparsedData);
 /*
  *	Mark closed
 */
@@ -158,6 +159,38 @@ HIDOpenReportDescriptor	   (void *					hidReportDescriptor,
 							IOByteCount 			descriptorLength,
 							HIDPreparsedDataRef *	preparsedDataRef,
 							UInt32					flags)
+{
+	return HIDOpenReportDescriptorWithLimits(hidReportDescriptor, descriptorLength,
+											 preparsedDataRef, flags, NULL);
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDOpenReportDescriptorWithLimits - Initialize the HID Parser, bounding
+ *									   what the descriptor may describe
+ *
+ *	 Input:
+ *			  psHidReportDescriptor - The HID Report Descriptor (String)
+ *			  descriptorLength	   - Length of the Descriptor in bytes
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *			  flags					- Kept in the PreParsedData Structure
+ *			  ptLimits				- The limits, or NULL for the defaults
+ *	 Output:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Returns:
+ *			  kHIDSuccess		   - Success
+ *			  kHIDNullPointerErr	  - Argument, Pointer was Null
+ *			  kHIDInvalidPreparsedDataErr - Malformed, or over a limit
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus
+HIDOpenReportDescriptorWithLimits (void *					hidReportDescriptor,
+								   IOByteCount 				descriptorLength,
+								   HIDPreparsedDataRef *	preparsedDataRef,
+								   UInt32					flags,
+								   const HIDDescriptorLimits *	ptLimits)
 {
 	HIDPreparsedDataPtr ptPreparsedData = NULL;
 	OSStatus iStatus;
@@ -195,30 +228,23 @@ HIDOpenReportDescriptor	   (void *					hidReportDescriptor,
 */
 	tDescriptor.descriptor = hidReportDescriptor;
 	tDescriptor.descriptorLength = descriptorLength;
+	tDescriptor.limits = ptLimits;
 /*
- *	Count various items in the descriptor
- *	  allocate space within the PreparsedData structure
- *	  and initialize the counters there
+ *	Count and parse the descriptor in one pass,
+ *	  filling in the structures in the PreparsedData structure
 */
-	iStatus = HIDCountDescriptorItems(&tDescriptor,ptPreparsedData);
+	iStatus = HIDParseDescriptorOnePass(&tDescriptor,ptPreparsedData);
     
-    /*
-     *	Parse the Descriptor
-     *	  filling in the structures in the PreparsedData structure
-    */
-	if (iStatus == kHIDSuccess)
-    {
-        iStatus = HIDParseDescriptor(&tDescriptor,ptPreparsedData);
     /*
      *	Mark the PreparsedData initialized, maybe
     */
-        if (iStatus == kHIDSuccess && ptPreparsedData->rawMemPtr != NULL)
-        {
-            ptPreparsedData->hidTypeIfValid = kHIDOSType;
-            *preparsedDataRef = (HIDPreparsedDataRef) ptPreparsedData;
-        
-            return kHIDSuccess;
-        }
+    if (iStatus == kHIDSuccess && ptPreparsedData->rawMemPtr != NULL)
+    {
+        HIDBuildUsageIndex(ptPreparsedData);
+        ptPreparsedData->hidTypeIfValid = kHIDOSType;
+        *preparsedDataRef = (HIDPreparsedDataRef) ptPreparsedData;
+    
+        return kHIDSuccess;
     }
     
 	// something failed, deallocate everything, and make sure we return an error
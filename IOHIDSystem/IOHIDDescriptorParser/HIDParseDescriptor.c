@@ -48,37 +48,254 @@
 
 #include "HIDLib.h"
 
+#if !(KERNEL || TARGET_OS_DRIVERKIT)
+
+#include <stdlib.h>
+#include <string.h>
+
+static void * IOMallocZeroData(size_t size) {
+	return calloc(1, size);
+}
+
+static void IOFreeData(void* ptr, size_t __unused size) {
+	free(ptr);
+}
+
+#else
+
+#if TARGET_OS_DRIVERKIT
+#include <DriverKit/IOLib.h>
+#include <string.h>
+
+extern void *
+IOMallocZeroData(size_t length);
+
+extern void IOFreeData(void * address, size_t length);
+
+#else
+#include <IOKit/system.h>
+#include <IOKit/IOLib.h>
+#endif
+
+#endif
+
 //#include <stdio.h>
+
+/*
+ *	Scratch storage for HIDParseDescriptorOnePass.  Every array the parser
+ *	  fills lives in one allocation, split into regions that each grow by
+ *	  doubling.  Only the preparsed data arrays are kept once parsing ends.
+*/
+enum
+{
+	kHIDArenaCollections = 0,
+	kHIDArenaReportItems,
+	kHIDArenaReports,
+	kHIDArenaUsageItems,
+	kHIDArenaStringItems,
+	kHIDArenaDesigItems,
+	kHIDArenaPreparsedRegions,
+	kHIDArenaCollectionStack = kHIDArenaPreparsedRegions,
+	kHIDArenaGlobalsStack,
+	kHIDArenaRegionCount
+};
+
+#define kHIDArenaAlignment			8
+#define kHIDArenaMinimumCapacity	4
+
+#define HIDArenaAlign(size)		(((size) + (kHIDArenaAlignment - 1)) & ~((IOByteCount)kHIDArenaAlignment - 1))
+
+static const IOByteCount gHIDArenaElementSize[kHIDArenaRegionCount] =
+{
+	sizeof(HIDCollection),
+	sizeof(HIDReportItem),
+	sizeof(HIDReportSizes),
+	sizeof(HIDP_UsageItem),
+	sizeof(HIDStringItem),
+	sizeof(HIDDesignatorItem),
+	sizeof(SInt32),
+	sizeof(HIDGlobalItems)
+};
+
+struct HIDParseArena
+{
+	UInt8 *				base;
+	IOByteCount			size;
+	IOByteCount			offset[kHIDArenaRegionCount];
+	UInt32				capacity[kHIDArenaRegionCount];
+};
+typedef struct HIDParseArena HIDParseArena;
+
+/*
+ *	Point the parser at the current location of each region
+*/
+static void HIDArenaBind(HIDParseArena *ptArena, HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
+{
+	UInt8 *base = ptArena->base;
+
+	ptPreparsedData->collections = (HIDCollection *) (base + ptArena->offset[kHIDArenaCollections]);
+	ptPreparsedData->reportItems = (HIDReportItem *) (base + ptArena->offset[kHIDArenaReportItems]);
+	ptPreparsedData->reports = (HIDReportSizes *) (base + ptArena->offset[kHIDArenaReports]);
+	ptPreparsedData->usageItems = (HIDP_UsageItem *) (base + ptArena->offset[kHIDArenaUsageItems]);
+	ptPreparsedData->stringItems = (HIDStringItem *) (base + ptArena->offset[kHIDArenaStringItems]);
+	ptPreparsedData->desigItems = (HIDDesignatorItem *) (base + ptArena->offset[kHIDArenaDesigItems]);
+	ptDescriptor->collectionStack = (SInt32 *) (base + ptArena->offset[kHIDArenaCollectionStack]);
+	ptDescriptor->globalsStack = (HIDGlobalItems *) (base + ptArena->offset[kHIDArenaGlobalsStack]);
+}
+
+/*
+ *	Lay the regions out again with the given capacities, copying over
+ *	  what was already parsed.  New space is zero filled, the same as
+ *	  the single allocation made by HIDCountDescriptorItems.
+*/
+static OSStatus HIDArenaResize(HIDParseArena *ptArena, UInt32 *capacity, HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
+{
+	IOByteCount offset[kHIDArenaRegionCount];
+	IOByteCount size = 0;
+	IOByteCount regionSize;
+	UInt8 *pMem;
+	int i;
+
+	for (i = 0; i < kHIDArenaRegionCount; i++)
+	{
+		offset[i] = size;
+		if (os_mul_overflow(gHIDArenaElementSize[i], capacity[i], &regionSize)) return kHIDInvalidPreparsedDataErr;
+		if (os_add_overflow(size, HIDArenaAlign(regionSize), &size)) return kHIDInvalidPreparsedDataErr;
+	}
+
+	pMem = IOMallocZeroData((size_t)size);
+	if (pMem == NULL)
+		return kHIDNotEnoughMemoryErr;
+
+	if (ptArena->base != NULL)
+	{
+		for (i = 0; i < kHIDArenaRegionCount; i++)
+			memcpy(pMem + offset[i], ptArena->base + ptArena->offset[i], gHIDArenaElementSize[i] * ptArena->capacity[i]);
+		IOFreeData(ptArena->base, (size_t)ptArena->size);
+	}
+
+	ptArena->base = pMem;
+	ptArena->size = size;
+	for (i = 0; i < kHIDArenaRegionCount; i++)
+	{
+		ptArena->offset[i] = offset[i];
+		ptArena->capacity[i] = capacity[i];
+	}
+	HIDArenaBind(ptArena, ptDescriptor, ptPreparsedData);
+	return kHIDSuccess;
+}
+
+/*
+ *	Make sure each region can hold as many entries as the items counted
+ *	  so far could have produced
+*/
+static OSStatus HIDArenaReserve(HIDParseArena *ptArena, HIDItemCounts *ptCounts, HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
+{
+	UInt32 needed[kHIDArenaRegionCount];
+	UInt32 capacity[kHIDArenaRegionCount];
+	Boolean grow = false;
+	int i;
+
+	needed[kHIDArenaCollections] = ptCounts->collectionCount;
+	needed[kHIDArenaReportItems] = ptCounts->reportItemCount;
+	needed[kHIDArenaReports] = ptCounts->reportCount;
+	needed[kHIDArenaUsageItems] = ptCounts->usages + ((ptCounts->usageRanges + 1) / 2);
+	needed[kHIDArenaStringItems] = ptCounts->strings + ((ptCounts->stringRanges + 1) / 2);
+	needed[kHIDArenaDesigItems] = ptCounts->desigs + ((ptCounts->desigRanges + 1) / 2);
+	needed[kHIDArenaCollectionStack] = ptCounts->maxCollectionNesting;
+	needed[kHIDArenaGlobalsStack] = ptCounts->maxGlobalsNesting;
+
+	for (i = 0; i < kHIDArenaRegionCount; i++)
+	{
+		capacity[i] = ptArena->capacity[i];
+		if (needed[i] > capacity[i])
+		{
+			if (os_mul_overflow(capacity[i], 2, &capacity[i]))
+				return kHIDInvalidPreparsedDataErr;
+			if (capacity[i] < needed[i])
+				capacity[i] = needed[i];
+			grow = true;
+		}
+	}
+
+	if (!grow)
+		return kHIDSuccess;
+	return HIDArenaResize(ptArena, capacity, ptDescriptor, ptPreparsedData);
+}
+
+/*
+ *	Copy the preparsed data arrays out of the arena into one block sized
+ *	  to what was actually used, in the same order HIDCountDescriptorItems
+ *	  lays them out
+*/
+static OSStatus HIDArenaCompact(HIDParseArena *ptArena, HIDPreparsedDataPtr ptPreparsedData)
+{
+	UInt32 count[kHIDArenaPreparsedRegions];
+	IOByteCount offset[kHIDArenaPreparsedRegions];
+	IOByteCount size = 0;
+	UInt8 *pMem;
+	int i;
+
+	count[kHIDArenaCollections] = ptPreparsedData->collectionCount;
+	count[kHIDArenaReportItems] = ptPreparsedData->reportItemCount;
+	count[kHIDArenaReports] = ptPreparsedData->reportCount;
+	count[kHIDArenaUsageItems] = ptPreparsedData->usageItemCount;
+	count[kHIDArenaStringItems] = ptPreparsedData->stringItemCount;
+	count[kHIDArenaDesigItems] = ptPreparsedData->desigItemCount;
+
+	// Counts never exceed the arena capacities, so none of this can overflow.
+	// Item regions keep one zeroed spare slot: the caps readers index the
+	// first usage of a collection or report item without checking whether
+	// it has any, which the two-pass layout happened to keep in bounds.
+	for (i = 0; i < kHIDArenaPreparsedRegions; i++)
+	{
+		UInt32 slots = count[i];
+
+		if (i == kHIDArenaUsageItems || i == kHIDArenaStringItems || i == kHIDArenaDesigItems)
+			slots++;
+		offset[i] = size;
+		size += HIDArenaAlign(gHIDArenaElementSize[i] * slots);
+	}
+
+	pMem = IOMallocZeroData((size_t)size);
+	if (pMem == NULL)
+		return kHIDNotEnoughMemoryErr;
+
+	for (i = 0; i < kHIDArenaPreparsedRegions; i++)
+		memcpy(pMem + offset[i], ptArena->base + ptArena->offset[i], gHIDArenaElementSize[i] * count[i]);
+
+	ptPreparsedData->rawMemPtr = pMem;
+	ptPreparsedData->numBytesAllocated = size;
+	ptPreparsedData->collections = (HIDCollection *) (pMem + offset[kHIDArenaCollections]);
+	ptPreparsedData->reportItems = (HIDReportItem *) (pMem + offset[kHIDArenaReportItems]);
+	ptPreparsedData->reports = (HIDReportSizes *) (pMem + offset[kHIDArenaReports]);
+	ptPreparsedData->usageItems = (HIDP_UsageItem *) (pMem + offset[kHIDArenaUsageItems]);
+	ptPreparsedData->stringItems = (HIDStringItem *) (pMem + offset[kHIDArenaStringItems]);
+	ptPreparsedData->desigItems = (HIDDesignatorItem *) (pMem + offset[kHIDArenaDesigItems]);
+	return kHIDSuccess;
+}
+
 /*
  *------------------------------------------------------------------------------
  *
- * HIDParseDescriptor - Fill in the PreparsedData structures
+ * HIDInitParseState - Reset the parser state before the first item
  *
  *	 Input:
  *			  ptDescriptor			- Descriptor Pointer Structure
  *			  ptPreparsedData		- The PreParsedData Structure
  *	 Output:
+ *			  ptDescriptor			- Descriptor Pointer Structure
  *			  ptPreparsedData		- The PreParsedData Structure
- *	 Returns:
- *			  kHIDSuccess		   - Success
- *			  kHIDNullPointerErr	  - Argument, Pointer was Null
  *
- *	NOTE: HIDCountDescriptorItems MUST have been called to set up the
- *		  array pointers in the HIDPreparsedData structure!
+ *	NOTE: Room for the virtual collection and the default report must
+ *		  already have been set up.
  *
  *------------------------------------------------------------------------------
 */
-OSStatus HIDParseDescriptor(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
+static void HIDInitParseState(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
 {
-	OSStatus iStatus;
-	HIDItem *ptItem;
 	HIDCollection *ptCollection;
 	HIDReportSizes *ptReport;
-/*
- *	Disallow NULL Pointers
-*/
-	if ((ptDescriptor == NULL) || (ptPreparsedData == NULL))
-		return kHIDNullPointerErr;
 /*
  *	Initialize Counters
 */
@@ -116,7 +333,6 @@ OSStatus HIDParseDescriptor(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataP
 	ptDescriptor->haveStringMax = false;
 	ptDescriptor->haveDesigMin = false;
 	ptDescriptor->haveDesigMax = false;
-	ptItem = &ptDescriptor->item;
 /*
  *	Initialize the virtual collection
 */
@@ -139,7 +355,39 @@ OSStatus HIDParseDescriptor(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataP
 	ptReport->inputBitCount = 0;
 	ptReport->outputBitCount = 0;
 	ptReport->featureBitCount = 0;
+}
 
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDParseDescriptor - Fill in the PreparsedData structures
+ *
+ *	 Input:
+ *			  ptDescriptor			- Descriptor Pointer Structure
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Output:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Returns:
+ *			  kHIDSuccess		   - Success
+ *			  kHIDNullPointerErr	  - Argument, Pointer was Null
+ *
+ *	NOTE: HIDCountDescriptorItems MUST have been called to set up the
+ *		  array pointers in the HIDPreparsedData structure!
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDParseDescriptor(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
+{
+	OSStatus iStatus;
+	HIDItem *ptItem;
+	HIDCollection *ptCollection;
+/*
+ *	Disallow NULL Pointers
+*/
+	if ((ptDescriptor == NULL) || (ptPreparsedData == NULL))
+		return kHIDNullPointerErr;
+	HIDInitParseState(ptDescriptor,ptPreparsedData);
+	ptItem = &ptDescriptor->item;
 /*
  *	Parse the Descriptor
 */
@@ -172,3 +420,131 @@ OSStatus HIDParseDescriptor(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataP
 */
 	return iStatus;
 }
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDParseDescriptorOnePass - Count and parse the descriptor in a single pass
+ *
+ *	 Input:
+ *			  ptDescriptor			- Descriptor Pointer Structure
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Output:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Returns:
+ *			  kHIDSuccess		   - Success
+ *			  kHIDNullPointerErr	  - Argument, Pointer was Null
+ *
+ *	Produces the same preparsed data and errors as HIDCountDescriptorItems
+ *	  followed by HIDParseDescriptor, decoding each item only once.  The
+ *	  arrays are filled in a growable arena and copied into one block of
+ *	  rawMemPtr at the end.
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDParseDescriptorOnePass(HIDReportDescriptor *ptDescriptor, HIDPreparsedDataPtr ptPreparsedData)
+{
+	OSStatus iStatus;
+	OSStatus iCountStatus;
+	OSStatus iParseStatus = kHIDSuccess;
+	HIDParseArena tArena;
+	HIDItemCounts tCounts;
+	UInt32 capacity[kHIDArenaRegionCount];
+	UInt32 iCapacity;
+	HIDItem *ptItem;
+	int i;
+/*
+ *	Disallow NULL Pointers
+*/
+	if ((ptDescriptor == NULL) || (ptPreparsedData == NULL))
+		return kHIDNullPointerErr;
+/*
+ *	Initialize the memory allocation pointer
+*/
+	ptPreparsedData->rawMemPtr = NULL;
+	ptPreparsedData->numBytesAllocated = 0;
+	memset(&tArena, 0, sizeof(tArena));
+/*
+ *	Size the arena from the descriptor length, every item takes at least
+ *	  one byte so this rarely has to grow for typical descriptors
+*/
+	iCapacity = (UInt32)(ptDescriptor->descriptorLength / 16);
+	if (iCapacity < kHIDArenaMinimumCapacity)
+		iCapacity = kHIDArenaMinimumCapacity;
+	for (i = 0; i < kHIDArenaRegionCount; i++)
+		capacity[i] = (i < kHIDArenaPreparsedRegions) ? iCapacity : kHIDArenaMinimumCapacity;
+	iStatus = HIDArenaResize(&tArena, capacity, ptDescriptor, ptPreparsedData);
+	if (iStatus != kHIDSuccess)
+		return iStatus;
+
+	HIDInitItemCounts(&tCounts, ptDescriptor->limits);
+	HIDInitParseState(ptDescriptor, ptPreparsedData);
+	ptItem = &ptDescriptor->item;
+/*
+ *	Count and parse each item.  Once an item fails to parse, keep counting
+ *	  so that a malformed descriptor is still reported the way the
+ *	  counting pass reports it.
+*/
+	while ((iStatus = HIDNextItem(ptDescriptor)) == kHIDSuccess)
+	{
+		iCountStatus = HIDCountItem(ptItem, &tCounts);
+		if (iCountStatus != kHIDSuccess)
+		{
+			iStatus = iCountStatus;
+			goto exit;
+		}
+		if (iParseStatus != kHIDSuccess)
+			continue;
+
+		iParseStatus = HIDArenaReserve(&tArena, &tCounts, ptDescriptor, ptPreparsedData);
+		if (iParseStatus != kHIDSuccess)
+			continue;
+
+		switch (ptItem->itemType)
+		{
+			case kHIDTypeMain:
+				iParseStatus = HIDProcessMainItem(ptDescriptor,ptPreparsedData);
+				break;
+			case kHIDTypeGlobal:
+				iParseStatus = HIDProcessGlobalItem(ptDescriptor,ptPreparsedData);
+				break;
+			case kHIDTypeLocal:
+				iParseStatus = HIDProcessLocalItem(ptDescriptor,ptPreparsedData);
+				break;
+		}
+	}
+/*
+ *	Disallow malformed descriptors
+*/
+	iCountStatus = HIDCheckItemCounts(&tCounts);
+	if (iCountStatus != kHIDSuccess)
+	{
+		iStatus = iCountStatus;
+		goto exit;
+	}
+	if (iStatus != kHIDEndOfDescriptorErr)
+		goto exit;
+	iStatus = iParseStatus;
+	if (iStatus != kHIDSuccess)
+		goto exit;
+/*
+ *	Update the virtual collection
+*/
+	ptPreparsedData->collections->reportItemCount = ptPreparsedData->reportItemCount;
+/*
+ *	Keep only what was used
+*/
+	iStatus = HIDArenaCompact(&tArena, ptPreparsedData);
+
+exit:
+	IOFreeData(tArena.base, (size_t)tArena.size);
+	ptDescriptor->collectionStack = NULL;
+	ptDescriptor->globalsStack = NULL;
+	if (iStatus != kHIDSuccess)
+	{
+		if (ptPreparsedData->rawMemPtr != NULL)
+			IOFreeData(ptPreparsedData->rawMemPtr, (size_t)ptPreparsedData->numBytesAllocated);
+		ptPreparsedData->rawMemPtr = NULL;
+	}
+	return iStatus;
+}
@@ -0,0 +1,452 @@
+/*
+ * @APPLE_LICENSE_HEADER_START@
+ *
+ * Copyright (c) 2024 Apple Inc.  All Rights Reserved.
+ *
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ *
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ *
+ * @APPLE_LICENSE_HEADER_END@
+ */
+/*
+	File:		HIDPreparsedDataImage.c
+
+	Contains:	Flat, position independent images of preparsed data.
+
+	HIDGetPreparsedDataImage writes an open HIDPreparsedData, usage index
+	included, as a HIDPreparsedDataImageHeader followed by its arrays.
+	HIDOpenPreparsedDataImage checks such an image and opens it in place:
+	the returned HIDPreparsedDataRef points into the image instead of
+	copying it, so one mapped image can back any number of opens without
+	parsing the descriptor again. Nothing writes to the arrays once a
+	descriptor is open, so the image may be mapped read-only.
+*/
+
+#include "HIDLib.h"
+#include <stddef.h>
+
+#if !(KERNEL || TARGET_OS_DRIVERKIT)
+
+#include <stdlib.h>
+#include <string.h>
+
+#define IOMallocType(type)                              \
+	calloc(1, sizeof(type))
+
+#else
+
+#if TARGET_OS_DRIVERKIT
+#include <DriverKit/IOLib.h>
+#include <string.h>
+
+#define IOMallocType(type)                              \
+    IONewZero(type, 1)
+
+#else
+#include <IOKit/system.h>
+#include <IOKit/IOLib.h>
+#endif
+
+#endif
+
+#define kHIDImageAlignment		8
+
+/*
+ *	Entry size of each table, and the zeroed spare entries that follow it.
+ *	The item tables keep the spare the parser leaves after them, since the
+ *	caps readers look at the first usage of a collection without checking
+ *	that it has one.
+*/
+static const UInt32 gHIDImageEntrySize[kHIDImageTableCount] =
+{
+	sizeof(HIDCollection),
+	sizeof(HIDReportItem),
+	sizeof(HIDReportSizes),
+	sizeof(HIDP_UsageItem),
+	sizeof(HIDStringItem),
+	sizeof(HIDDesignatorItem),
+	sizeof(HIDUsageIndexEntry),
+	sizeof(HIDUsageIndexEntry),
+	sizeof(UInt32)
+};
+
+static const UInt32 gHIDImageSpares[kHIDImageTableCount] =
+{
+	0, 0, 0, 1, 1, 1, 0, 0, 0
+};
+
+/*
+ *	Adler-32
+*/
+static UInt32 HIDImageChecksum(const UInt8 *pData, IOByteCount length)
+{
+	UInt32 a = 1;
+	UInt32 b = 0;
+	IOByteCount iChunk;
+
+	while (length > 0)
+	{
+		iChunk = (length < 5552) ? length : 5552;
+		length -= iChunk;
+		while (iChunk-- > 0)
+		{
+			a += *pData++;
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+	return (b << 16) | a;
+}
+
+static UInt32 HIDImageChecksumOf(const UInt8 *pImage, UInt32 imageSize)
+{
+	UInt32 iStart = offsetof(HIDPreparsedDataImageHeader, checksum) + sizeof(UInt32);
+
+	return HIDImageChecksum(pImage + iStart, imageSize - iStart);
+}
+
+/*
+ *	Lay out one table after the ones before it, absent tables take no space
+*/
+static void HIDImageAddTable(HIDPreparsedDataImageHeader *ptHeader, UInt32 iTable,
+							 Boolean bPresent, UInt32 iCount, uint64_t *piSize)
+{
+	HIDPreparsedDataImageTable *ptTable = &ptHeader->tables[iTable];
+
+	ptTable->entrySize = gHIDImageEntrySize[iTable];
+	if (!bPresent)
+		return;
+	ptTable->offset = (UInt32)*piSize;
+	ptTable->count = iCount;
+	*piSize += (uint64_t)ptTable->entrySize * ((uint64_t)iCount + gHIDImageSpares[iTable]);
+	*piSize = (*piSize + (kHIDImageAlignment - 1)) & ~(uint64_t)(kHIDImageAlignment - 1);
+}
+
+/*
+ *	Does [first, first + count) fit in a table of total entries?
+*/
+static Boolean HIDImageRangeValid(SInt32 first, SInt32 count, UInt32 total)
+{
+	return (first >= 0) && (count >= 0)
+		&& ((UInt32)first <= total) && ((UInt32)count <= total - (UInt32)first);
+}
+
+/*
+ *	Are the isRange flags of a table of usage, string or designator items,
+ *	spare included, all true or false?  Read as bytes, since Boolean may be
+ *	a C bool that can hold nothing else.
+*/
+static Boolean HIDImageFlagsValid(const UInt8 *pTable, UInt32 count, UInt32 entrySize, size_t flagOffset)
+{
+	UInt32 i;
+
+	for (i = 0; i <= count; i++)
+		if (pTable[((size_t)i * entrySize) + flagOffset] > 1)
+			return false;
+	return true;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDCheckPreparsedDataImage - Check an image before opening it
+ *
+ *	 Input:
+ *			  pImage				- The image
+ *			  imageLength			- Bytes available at pImage
+ *	 Output:
+ *	 Returns:
+ *			  kHIDSuccess			- Success
+ *			  kHIDInvalidPreparsedDataErr - Not an image this build can open
+ *
+ *	NOTE: Besides the header and checksum, every index the parser functions
+ *		  follow without checking is checked here, so a damaged image can
+ *		  not send them outside the image.
+ *
+ *------------------------------------------------------------------------------
+*/
+static OSStatus HIDCheckPreparsedDataImage(const UInt8 *pImage, IOByteCount imageLength)
+{
+	const HIDPreparsedDataImageHeader *ptHeader = (const HIDPreparsedDataImageHeader *) pImage;
+	const HIDPreparsedDataImageTable *ptTable;
+	const HIDCollection *ptCollection;
+	const HIDReportItem *ptReportItem;
+	const HIDUsageIndexEntry *ptEntry;
+	UInt32 count[kHIDImageTableCount];
+	UInt32 i;
+	UInt32 j;
+/*
+ *	Header
+*/
+	if ((((uintptr_t)pImage) & (kHIDImageAlignment - 1)) != 0)
+		return kHIDInvalidPreparsedDataErr;
+	if (imageLength < sizeof(HIDPreparsedDataImageHeader))
+		return kHIDInvalidPreparsedDataErr;
+	if ((ptHeader->magic != kHIDPreparsedDataImageMagic)
+	 || (ptHeader->version != kHIDPreparsedDataImageVersion)
+	 || (ptHeader->headerSize != sizeof(HIDPreparsedDataImageHeader))
+	 || (ptHeader->imageSize < sizeof(HIDPreparsedDataImageHeader))
+	 || (ptHeader->imageSize > imageLength))
+		return kHIDInvalidPreparsedDataErr;
+	if (ptHeader->checksum != HIDImageChecksumOf(pImage, ptHeader->imageSize))
+		return kHIDInvalidPreparsedDataErr;
+/*
+ *	Tables, only the usage index ones may be absent
+*/
+	for (i = 0; i < kHIDImageTableCount; i++)
+	{
+		ptTable = &ptHeader->tables[i];
+		if (ptTable->entrySize != gHIDImageEntrySize[i])
+			return kHIDInvalidPreparsedDataErr;
+		if (ptTable->offset == 0)
+		{
+			if ((i < kHIDImageUsageIndex) || (ptTable->count != 0))
+				return kHIDInvalidPreparsedDataErr;
+		}
+		else if ((ptTable->offset < sizeof(HIDPreparsedDataImageHeader))
+			  || (ptTable->offset > ptHeader->imageSize)
+			  || ((ptTable->offset & (kHIDImageAlignment - 1)) != 0)
+			  || (ptTable->count > 0x7FFFFFFF)
+			  || (((uint64_t)ptTable->count + gHIDImageSpares[i]) * ptTable->entrySize
+				  > (uint64_t)(ptHeader->imageSize - ptTable->offset)))
+			return kHIDInvalidPreparsedDataErr;
+		count[i] = ptTable->count;
+	}
+	if ((count[kHIDImageCollections] < 2) || (count[kHIDImageReports] < 1))
+		return kHIDInvalidPreparsedDataErr;
+	if ((ptHeader->tables[kHIDImageUsageIndex].offset == 0)
+	 != (ptHeader->tables[kHIDImageUsageRangeIndex].offset == 0))
+		return kHIDInvalidPreparsedDataErr;
+	if ((ptHeader->tables[kHIDImageUsageOffsets].offset != 0)
+	 && (count[kHIDImageUsageOffsets] != count[kHIDImageUsageItems]))
+		return kHIDInvalidPreparsedDataErr;
+/*
+ *	Item flags
+*/
+	if (!HIDImageFlagsValid(pImage + ptHeader->tables[kHIDImageUsageItems].offset, count[kHIDImageUsageItems],
+							sizeof(HIDP_UsageItem), offsetof(HIDP_UsageItem, isRange))
+	 || !HIDImageFlagsValid(pImage + ptHeader->tables[kHIDImageStringItems].offset, count[kHIDImageStringItems],
+							sizeof(HIDStringItem), offsetof(HIDStringItem, isRange))
+	 || !HIDImageFlagsValid(pImage + ptHeader->tables[kHIDImageDesigItems].offset, count[kHIDImageDesigItems],
+							sizeof(HIDDesignatorItem), offsetof(HIDDesignatorItem, isRange)))
+		return kHIDInvalidPreparsedDataErr;
+/*
+ *	Collections
+*/
+	ptCollection = (const HIDCollection *) (pImage + ptHeader->tables[kHIDImageCollections].offset);
+	for (i = 0; i < count[kHIDImageCollections]; i++, ptCollection++)
+	{
+		if (!HIDImageRangeValid(ptCollection->firstUsageItem, ptCollection->usageItemCount, count[kHIDImageUsageItems])
+		 || !HIDImageRangeValid(ptCollection->firstReportItem, ptCollection->reportItemCount, count[kHIDImageReportItems]))
+			return kHIDInvalidPreparsedDataErr;
+	}
+/*
+ *	Report items
+*/
+	ptReportItem = (const HIDReportItem *) (pImage + ptHeader->tables[kHIDImageReportItems].offset);
+	for (i = 0; i < count[kHIDImageReportItems]; i++, ptReportItem++)
+	{
+		if (!HIDImageRangeValid(ptReportItem->firstUsageItem, ptReportItem->usageItemCount, count[kHIDImageUsageItems])
+		 || !HIDImageRangeValid(ptReportItem->firstStringItem, ptReportItem->stringItemCount, count[kHIDImageStringItems])
+		 || !HIDImageRangeValid(ptReportItem->firstDesigItem, ptReportItem->desigItemCount, count[kHIDImageDesigItems])
+		 || (ptReportItem->parent < 0) || ((UInt32)ptReportItem->parent >= count[kHIDImageCollections])
+		 || (ptReportItem->globals.reportIndex < 0)
+		 || ((UInt32)ptReportItem->globals.reportIndex >= count[kHIDImageReports]))
+			return kHIDInvalidPreparsedDataErr;
+	}
+/*
+ *	Usage index
+*/
+	for (i = kHIDImageUsageIndex; i <= kHIDImageUsageRangeIndex; i++)
+	{
+		ptEntry = (const HIDUsageIndexEntry *) (pImage + ptHeader->tables[i].offset);
+		for (j = 0; j < count[i]; j++)
+			if (ptEntry[j].reportItem >= count[kHIDImageReportItems])
+				return kHIDInvalidPreparsedDataErr;
+	}
+	return kHIDSuccess;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDGetPreparsedDataImage - Write preparsed data out as an image
+ *
+ *	 Input:
+ *			  preparsedDataRef		- The PreParsedData Structure
+ *			  image					- Where to write the image, or NULL
+ *			  imageLength			- Bytes available at image
+ *	 Output:
+ *			  image					- The image
+ *			  imageLength			- Bytes the image takes
+ *	 Returns:
+ *			  kHIDSuccess			- Success
+ *			  kHIDNullPointerErr	- Argument, Pointer was Null
+ *			  kHIDBufferTooSmallErr - image is NULL or too small
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDGetPreparsedDataImage(HIDPreparsedDataRef preparsedDataRef, void *image, IOByteCount *imageLength)
+{
+	HIDPreparsedDataPtr ptPreparsedData = (HIDPreparsedDataPtr) preparsedDataRef;
+	HIDPreparsedDataImageHeader tHeader;
+	const void *pSource[kHIDImageTableCount];
+	Boolean bIndexed;
+	uint64_t iSize;
+	UInt8 *pImage = (UInt8 *) image;
+	UInt32 i;
+/*
+ *	Disallow Null Pointers
+*/
+	if ((ptPreparsedData == NULL) || (imageLength == NULL))
+		return kHIDNullPointerErr;
+	if (ptPreparsedData->hidTypeIfValid != kHIDOSType)
+		return kHIDInvalidPreparsedDataErr;
+/*
+ *	Lay out the header and tables
+*/
+	memset(&tHeader, 0, sizeof(tHeader));
+	tHeader.magic = kHIDPreparsedDataImageMagic;
+	tHeader.version = kHIDPreparsedDataImageVersion;
+	tHeader.headerSize = sizeof(HIDPreparsedDataImageHeader);
+	tHeader.flags = ptPreparsedData->flags;
+
+	bIndexed = (ptPreparsedData->usageIndex != NULL);
+	pSource[kHIDImageCollections] = ptPreparsedData->collections;
+	pSource[kHIDImageReportItems] = ptPreparsedData->reportItems;
+	pSource[kHIDImageReports] = ptPreparsedData->reports;
+	pSource[kHIDImageUsageItems] = ptPreparsedData->usageItems;
+	pSource[kHIDImageStringItems] = ptPreparsedData->stringItems;
+	pSource[kHIDImageDesigItems] = ptPreparsedData->desigItems;
+	pSource[kHIDImageUsageIndex] = ptPreparsedData->usageIndex;
+	pSource[kHIDImageUsageRangeIndex] = ptPreparsedData->usageRangeIndex;
+	pSource[kHIDImageUsageOffsets] = ptPreparsedData->usageOffsets;
+
+	iSize = sizeof(HIDPreparsedDataImageHeader);
+	HIDImageAddTable(&tHeader, kHIDImageCollections, true, ptPreparsedData->collectionCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageReportItems, true, ptPreparsedData->reportItemCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageReports, true, ptPreparsedData->reportCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageUsageItems, true, ptPreparsedData->usageItemCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageStringItems, true, ptPreparsedData->stringItemCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageDesigItems, true, ptPreparsedData->desigItemCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageUsageIndex, bIndexed, ptPreparsedData->usageIndexCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageUsageRangeIndex, bIndexed, ptPreparsedData->usageRangeIndexCount, &iSize);
+	HIDImageAddTable(&tHeader, kHIDImageUsageOffsets, (ptPreparsedData->usageOffsets != NULL),
+					 ptPreparsedData->usageItemCount, &iSize);
+	if (iSize > 0xFFFFFFFF)
+		return kHIDInvalidPreparsedDataErr;
+	tHeader.imageSize = (UInt32)iSize;
+/*
+ *	Report the size, and stop here if there's not enough room
+*/
+	if ((pImage == NULL) || (*imageLength < iSize))
+	{
+		*imageLength = (IOByteCount)iSize;
+		return kHIDBufferTooSmallErr;
+	}
+	*imageLength = (IOByteCount)iSize;
+/*
+ *	Copy everything in, spares and padding zeroed, then seal it
+*/
+	memset(pImage, 0, (size_t)iSize);
+	memcpy(pImage, &tHeader, sizeof(tHeader));
+	for (i = 0; i < kHIDImageTableCount; i++)
+	{
+		if ((tHeader.tables[i].offset != 0) && (tHeader.tables[i].count != 0))
+			memcpy(pImage + tHeader.tables[i].offset, pSource[i],
+				   (size_t)tHeader.tables[i].count * tHeader.tables[i].entrySize);
+	}
+	((HIDPreparsedDataImageHeader *) pImage)->checksum = HIDImageChecksumOf(pImage, tHeader.imageSize);
+	return kHIDSuccess;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDOpenPreparsedDataImage - Open preparsed data from an image, in place
+ *
+ *	 Input:
+ *			  image					- The image, 8 byte aligned
+ *			  imageLength			- Bytes available at image
+ *			  preparsedDataRef		- Where to return the PreParsedData
+ *	 Output:
+ *			  preparsedDataRef		- The PreParsedData Structure
+ *	 Returns:
+ *			  kHIDSuccess			- Success
+ *			  kHIDNullPointerErr	- Argument, Pointer was Null
+ *			  kHIDInvalidPreparsedDataErr - Not an image this build can open
+ *			  kHIDNotEnoughMemoryErr - Out of memory
+ *
+ *	NOTE: The image is used, not copied: it has to stay mapped and unchanged
+ *		  until the PreParsedData is closed with HIDCloseReportDescriptor.
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDOpenPreparsedDataImage(const void *image, IOByteCount imageLength, HIDPreparsedDataRef *preparsedDataRef)
+{
+	const UInt8 *pImage = (const UInt8 *) image;
+	const HIDPreparsedDataImageHeader *ptHeader = (const HIDPreparsedDataImageHeader *) image;
+	HIDPreparsedDataPtr ptPreparsedData;
+	void *pTable[kHIDImageTableCount];
+	OSStatus iStatus;
+	UInt32 i;
+/*
+ *	Disallow Null Pointers
+*/
+	if ((pImage == NULL) || (preparsedDataRef == NULL))
+		return kHIDNullPointerErr;
+	*preparsedDataRef = NULL;
+
+	iStatus = HIDCheckPreparsedDataImage(pImage, imageLength);
+	if (iStatus != kHIDSuccess)
+		return iStatus;
+
+	ptPreparsedData = IOMallocType(HIDPreparsedData);
+	if (ptPreparsedData == NULL)
+		return kHIDNotEnoughMemoryErr;
+/*
+ *	Point the arrays into the image; with rawMemPtr and the usage index
+ *	  allocation size left zero, closing frees only the structure
+*/
+	for (i = 0; i < kHIDImageTableCount; i++)
+		pTable[i] = (ptHeader->tables[i].offset != 0) ? (void *) (pImage + ptHeader->tables[i].offset) : NULL;
+
+	ptPreparsedData->flags = ptHeader->flags;
+	ptPreparsedData->collections = (HIDCollection *) pTable[kHIDImageCollections];
+	ptPreparsedData->collectionCount = ptHeader->tables[kHIDImageCollections].count;
+	ptPreparsedData->reportItems = (HIDReportItem *) pTable[kHIDImageReportItems];
+	ptPreparsedData->reportItemCount = ptHeader->tables[kHIDImageReportItems].count;
+	ptPreparsedData->reports = (HIDReportSizes *) pTable[kHIDImageReports];
+	ptPreparsedData->reportCount = ptHeader->tables[kHIDImageReports].count;
+	ptPreparsedData->usageItems = (HIDP_UsageItem *) pTable[kHIDImageUsageItems];
+	ptPreparsedData->usageItemCount = ptHeader->tables[kHIDImageUsageItems].count;
+	ptPreparsedData->stringItems = (HIDStringItem *) pTable[kHIDImageStringItems];
+	ptPreparsedData->stringItemCount = ptHeader->tables[kHIDImageStringItems].count;
+	ptPreparsedData->desigItems = (HIDDesignatorItem *) pTable[kHIDImageDesigItems];
+	ptPreparsedData->desigItemCount = ptHeader->tables[kHIDImageDesigItems].count;
+	ptPreparsedData->usageIndex = (HIDUsageIndexEntry *) pTable[kHIDImageUsageIndex];
+	ptPreparsedData->usageIndexCount = ptHeader->tables[kHIDImageUsageIndex].count;
+	ptPreparsedData->usageRangeIndex = (HIDUsageIndexEntry *) pTable[kHIDImageUsageRangeIndex];
+	ptPreparsedData->usageRangeIndexCount = ptHeader->tables[kHIDImageUsageRangeIndex].count;
+	ptPreparsedData->usageOffsets = (UInt32 *) pTable[kHIDImageUsageOffsets];
+	ptPreparsedData->rawMemPtr = NULL;
+	ptPreparsedData->numBytesAllocated = 0;
+	ptPreparsedData->usageIndexBytesAllocated = 0;
+
+	ptPreparsedData->hidTypeIfValid = kHIDOSType;
+	*preparsedDataRef = (HIDPreparsedDataRef) ptPreparsedData;
+	return kHIDSuccess;
+}
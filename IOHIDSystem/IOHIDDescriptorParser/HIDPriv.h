@@ -69,6 +69,33 @@
 #error unsupported compiler
 #endif
 
+/*
+ *	Little endian hosts move report fields of up to 32 bits with one unaligned
+ *	64-bit load or store, see HIDGetData and HIDPutData
+*/
+#if defined(__LITTLE_ENDIAN__) || (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define HID_REPORT_WORD_ACCESS	1
+#else
+#define HID_REPORT_WORD_ACCESS	0
+#endif
+
+#define kHIDReportWordBytes		8
+#define kHIDReportWordMaxSize	32
+
+#if HID_REPORT_WORD_ACCESS
+static inline uint64_t HIDReadReportWord(const UInt8 *psReport)
+{
+	uint64_t word;
+	__builtin_memcpy(&word, psReport, sizeof(word));
+	return word;
+}
+
+static inline void HIDWriteReportWord(UInt8 *psReport, uint64_t word)
+{
+	__builtin_memcpy(psReport, &word, sizeof(word));
+}
+#endif
+
 /*------------------------------------------------------------------------------*/
 /*																				*/
 /* HIDLibrary private defs														*/
@@ -112,6 +139,22 @@ HIDHasUsage				   (HIDPreparsedDataRef		preparsedDataRef,
 							UInt32 *				usageIndex,
 							UInt32 *				count);
 
+extern
+SInt32
+HIDFindUsageReportItem	   (HIDPreparsedDataRef		preparsedDataRef,
+							HIDUsage				usagePage,
+							HIDUsage				usage,
+							SInt32					firstReportItem,
+							SInt32					endReportItem);
+
+extern
+Boolean
+HIDFindUsageItemForIndex   (HIDPreparsedDataRef		preparsedDataRef,
+							HIDReportItem *			reportItem,
+							UInt32 					index,
+							SInt32 *				usageItem,
+							UInt32 *				offset);
+
 extern
 Boolean
 HIDIsButton				   (HIDReportItem *			reportItem,
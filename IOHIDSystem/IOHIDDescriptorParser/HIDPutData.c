@@ -103,6 +103,37 @@ HIDPutData				   (void *					report,
 */
 	if ((size == 0) || (iLastByte >= reportLength))
 		return kHIDBadParameterErr;
+#if HID_REPORT_WORD_ACCESS
+/*
+ *	If the data spans bytes, is no more than 32 bits and the report holds
+ *	a whole word then
+ *	  Merge it into one 64-bit word, starting at the start byte or pulled
+ *	  back to end with the report
+ *	  Past its 32 bits the shifted value is sign extended, as the byte
+ *	  path's arithmetic shifts do
+ *	Data in one byte, and reports shorter than a word, go byte-wise below
+*/
+	iStartByte = start/8;
+	if ((size <= kHIDReportWordMaxSize) && (iStartByte < iLastByte)
+	 && (reportLength >= kHIDReportWordBytes))
+	{
+		UInt32 iWordByte = iStartByte;
+		UInt32 iByteShift;
+		uint64_t word;
+		uint64_t fieldMask;
+		uint64_t fieldData;
+
+		if (iWordByte > reportLength - kHIDReportWordBytes)
+			iWordByte = (UInt32) (reportLength - kHIDReportWordBytes);
+		iByteShift = (iStartByte - iWordByte) * 8;
+		fieldMask = ((1ULL << size) - 1) << (iByteShift + (start & 7));
+		fieldData = (uint64_t) (int64_t) (SInt32) ((UInt32) value << (start & 7));
+		word = HIDReadReportWord(psReport + iWordByte);
+		word = (word & ~fieldMask) | ((fieldData << iByteShift) & fieldMask);
+		HIDWriteReportWord(psReport + iWordByte, word);
+		return kHIDSuccess;
+	}
+#endif
 	iLastBit = (start + size - 1)&7;
 	iLastMask = ~((1<<(iLastBit+1)) - 1);
 	iStartByte = start/8;
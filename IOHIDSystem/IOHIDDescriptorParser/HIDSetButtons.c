@@ -86,10 +86,11 @@ OSStatus HIDSetButton  (HIDReportType 			reportType,
 	HIDCollection *ptCollection;
 	HIDReportItem *ptReportItem;
 	OSStatus iStatus;
-	int iR, iX;
+	int iX;
 	SInt32 data;
 	int iStart;
 	int iReportItem;
+	int iEndReportItem;
 	UInt32 iUsageIndex;
 	Boolean bIncompatibleReport = false;
 	Boolean butNotReally = false;
@@ -112,9 +113,11 @@ OSStatus HIDSetButton  (HIDReportType 			reportType,
  *	Filter on ReportType and usagePage
 */
 	ptCollection = &ptPreparsedData->collections[collection];
-	for (iR=0; iR<ptCollection->reportItemCount; iR++)
+	iEndReportItem = ptCollection->firstReportItem + ptCollection->reportItemCount;
+	for (iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,ptCollection->firstReportItem,iEndReportItem);
+		 iReportItem < iEndReportItem;
+		 iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,iReportItem+1,iEndReportItem))
 	{
-		iReportItem = ptCollection->firstReportItem + iR;
 		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
 		if (HIDIsButton(ptReportItem, preparsedDataRef)
 		 && HIDHasUsage(preparsedDataRef,ptReportItem,usagePage,usage,&iUsageIndex,NULL))
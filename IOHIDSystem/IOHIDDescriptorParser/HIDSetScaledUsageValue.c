@@ -90,10 +90,10 @@ OSStatus HIDSetScaledUsageValue(HIDReportType reportType,
 	HIDCollection *ptCollection;
 	HIDReportItem *ptReportItem;
 	OSStatus iStatus;
-	int iR;
 	SInt32 data;
 	int iStart;
 	int iReportItem;
+	int iEndReportItem;
 	UInt32 iUsageIndex;
 	Boolean bIncompatibleReport = false;
 /*
@@ -115,9 +115,11 @@ OSStatus HIDSetScaledUsageValue(HIDReportType reportType,
  *	Filter on ReportType and usagePage
 */
 	ptCollection = &ptPreparsedData->collections[iCollection];
-	for (iR=0; iR<ptCollection->reportItemCount; iR++)
+	iEndReportItem = ptCollection->firstReportItem + ptCollection->reportItemCount;
+	for (iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,ptCollection->firstReportItem,iEndReportItem);
+		 iReportItem < iEndReportItem;
+		 iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,iReportItem+1,iEndReportItem))
 	{
-		iReportItem = ptCollection->firstReportItem + iR;
 		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
 		if ((ptReportItem->reportType == reportType)
 		 && HIDIsVariable(ptReportItem, preparsedDataRef)
@@ -90,9 +90,9 @@ OSStatus HIDSetUsageValue(HIDReportType reportType,
 	HIDCollection *ptCollection;
 	HIDReportItem *ptReportItem;
 	OSStatus iStatus;
-	int iR;
 	int iStart;
 	int iReportItem;
+	int iEndReportItem;
 	UInt32 iUsageIndex;
 	Boolean bIncompatibleReport = false;
 /*
@@ -114,9 +114,11 @@ OSStatus HIDSetUsageValue(HIDReportType reportType,
  *	Filter on ReportType and usagePage
 */
 	ptCollection = &ptPreparsedData->collections[iCollection];
-	for (iR=0; iR<ptCollection->reportItemCount; iR++)
+	iEndReportItem = ptCollection->firstReportItem + ptCollection->reportItemCount;
+	for (iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,ptCollection->firstReportItem,iEndReportItem);
+		 iReportItem < iEndReportItem;
+		 iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,iReportItem+1,iEndReportItem))
 	{
-		iReportItem = ptCollection->firstReportItem + iR;
 		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
 		if (HIDIsVariable(ptReportItem, preparsedDataRef)
 		 && HIDHasUsage(preparsedDataRef,ptReportItem,usagePage,usage,&iUsageIndex,NULL))
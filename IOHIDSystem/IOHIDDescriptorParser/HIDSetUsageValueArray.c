@@ -93,10 +93,10 @@ OSStatus HIDSetUsageValueArray(HIDReportType reportType,
 	HIDReportItem *ptReportItem;
 	OSStatus iStatus;
 	int i;
-	int iR;
 	SInt32 iValue;
 	int iStart;
 	int iReportItem;
+	int iEndReportItem;
 	UInt32 iUsageIndex;
 	UInt32 iCount;
 	int byteCount;
@@ -121,9 +121,11 @@ OSStatus HIDSetUsageValueArray(HIDReportType reportType,
  *	Filter on ReportType and usagePage
 */
 	ptCollection = &ptPreparsedData->collections[iCollection];
-	for (iR=0; iR<ptCollection->reportItemCount; iR++)
+	iEndReportItem = ptCollection->firstReportItem + ptCollection->reportItemCount;
+	for (iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,ptCollection->firstReportItem,iEndReportItem);
+		 iReportItem < iEndReportItem;
+		 iReportItem = HIDFindUsageReportItem(preparsedDataRef,usagePage,usage,iReportItem+1,iEndReportItem))
 	{
-		iReportItem = ptCollection->firstReportItem + iR;
 		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
 		if (HIDIsVariable(ptReportItem, preparsedDataRef)
 		 && HIDHasUsage(preparsedDataRef,ptReportItem,usagePage,usage,&iUsageIndex,&iCount))
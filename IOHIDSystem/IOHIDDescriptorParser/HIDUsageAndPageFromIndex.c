@@ -74,6 +74,8 @@ void HIDUsageAndPageFromIndex (HIDPreparsedDataRef preparsedDataRef,
 	int iUsageItem;
 	int iUsages;
 	int i;
+	SInt32 iIndexedItem;
+	UInt32 iOffset;
 
 /*
  *	Disallow NULL Pointers
@@ -87,7 +89,21 @@ void HIDUsageAndPageFromIndex (HIDPreparsedDataRef preparsedDataRef,
         ptUsageAndPage->usagePage = 0;
 		return;	// kHIDNullPointerErr;
 	}
-    
+
+/*
+ *	Use the usage offsets built at open time when they cover the index
+*/
+	if (HIDFindUsageItemForIndex(preparsedDataRef, ptReportItem, index, &iIndexedItem, &iOffset))
+	{
+		ptUsageItem = &ptPreparsedData->usageItems[iIndexedItem];
+		ptUsageAndPage->usagePage = ptUsageItem->usagePage;
+		if (ptUsageItem->isRange)
+			ptUsageAndPage->usage = ptUsageItem->usageMinimum + iOffset;
+		else
+			ptUsageAndPage->usage = ptUsageItem->usage;
+		return;
+	}
+
 /*
  *	Index through the usage Items for this ReportItem
 */
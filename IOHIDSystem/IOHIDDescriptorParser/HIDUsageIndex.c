@@ -0,0 +1,400 @@
+/*
+ * @APPLE_LICENSE_HEADER_START@
+ *
+ * Copyright (c) 2024 Apple Inc.  All Rights Reserved.
+ *
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ *
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ *
+ * @APPLE_LICENSE_HEADER_END@
+ */
+/*
+	File:		HIDUsageIndex.c
+
+	Contains:	Usage lookup tables built when a descriptor is opened.
+
+	The usage index maps a usage to the report items that declare it, so
+	the HIDHasUsage based lookups only visit report items that can match.
+	The usage offsets map a report index within a report item back to the
+	usage item that covers it, for HIDUsageAndPageFromIndex. Both only
+	narrow the search: the existing per report item checks still decide
+	the result, and everything falls back to a linear scan when the
+	tables are missing.
+*/
+
+#include "HIDLib.h"
+
+#if !(KERNEL || TARGET_OS_DRIVERKIT)
+
+#include <stdlib.h>
+
+static void * IOMallocZeroData(size_t size) {
+	return calloc(1, size);
+}
+
+static void IOFreeData(void* ptr, size_t __unused size) {
+	free(ptr);
+}
+
+#else
+
+#if TARGET_OS_DRIVERKIT
+#include <DriverKit/IOLib.h>
+
+extern void *
+IOMallocZeroData(size_t length);
+
+extern void IOFreeData(void * address, size_t length);
+
+#else
+#include <IOKit/system.h>
+#include <IOKit/IOLib.h>
+#endif
+
+#endif
+
+/*
+ *	Number of report indexes a usage item covers, as HIDUsageAndPageFromIndex
+ *	counts them
+*/
+static int64_t HIDUsageItemSpan(HIDP_UsageItem *ptUsageItem)
+{
+	int64_t iUsages;
+
+	if (!ptUsageItem->isRange)
+		return 1;
+	iUsages = (int64_t)ptUsageItem->usageMaximum - ptUsageItem->usageMinimum;
+	if (iUsages < 0)
+		iUsages = -iUsages;
+	return iUsages + 1;
+}
+
+static Boolean HIDUsageIndexLess(HIDUsageIndexEntry *ptA, HIDUsageIndexEntry *ptB)
+{
+	if (ptA->usageMinimum != ptB->usageMinimum)
+		return ptA->usageMinimum < ptB->usageMinimum;
+	return ptA->reportItem < ptB->reportItem;
+}
+
+static void HIDUsageIndexSiftDown(HIDUsageIndexEntry *ptEntries, UInt32 iRoot, UInt32 iCount)
+{
+	HIDUsageIndexEntry tEntry;
+	UInt32 iChild;
+
+	while ((iChild = (2 * iRoot) + 1) < iCount)
+	{
+		if (((iChild + 1) < iCount) && HIDUsageIndexLess(&ptEntries[iChild], &ptEntries[iChild + 1]))
+			iChild++;
+		if (!HIDUsageIndexLess(&ptEntries[iRoot], &ptEntries[iChild]))
+			return;
+		tEntry = ptEntries[iRoot];
+		ptEntries[iRoot] = ptEntries[iChild];
+		ptEntries[iChild] = tEntry;
+		iRoot = iChild;
+	}
+}
+
+/*
+ *	Heap sort, so this has no library dependency in any of the builds
+*/
+static void HIDUsageIndexSort(HIDUsageIndexEntry *ptEntries, UInt32 iCount)
+{
+	HIDUsageIndexEntry tEntry;
+	UInt32 i;
+
+	for (i = iCount / 2; i > 0; i--)
+		HIDUsageIndexSiftDown(ptEntries, i - 1, iCount);
+	for (i = iCount; i > 1; i--)
+	{
+		tEntry = ptEntries[0];
+		ptEntries[0] = ptEntries[i - 1];
+		ptEntries[i - 1] = tEntry;
+		HIDUsageIndexSiftDown(ptEntries, 0, i - 1);
+	}
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDBuildUsageIndex - Build the usage lookup tables
+ *
+ *	 Input:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Output:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Returns:
+ *
+ *	NOTE: If memory is short the tables are left empty and lookups
+ *		  scan the report items as before.
+ *
+ *------------------------------------------------------------------------------
+*/
+void HIDBuildUsageIndex(HIDPreparsedDataPtr ptPreparsedData)
+{
+	HIDReportItem *ptReportItem;
+	HIDP_UsageItem *ptUsageItem;
+	HIDUsageIndexEntry *ptUsage;
+	HIDUsageIndexEntry *ptRange;
+	UInt32 iUsageCount = 0;
+	UInt32 iRangeCount = 0;
+	UInt32 iReportItem;
+	IOByteCount size;
+	UInt8 *pMem;
+	int64_t iOffset;
+	Boolean bOffsetsValid = true;
+	int i;
+
+	for (iReportItem = 0; iReportItem < ptPreparsedData->reportItemCount; iReportItem++)
+	{
+		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
+		for (i = 0; i < ptReportItem->usageItemCount; i++)
+		{
+			if (ptPreparsedData->usageItems[ptReportItem->firstUsageItem + i].isRange)
+				iRangeCount++;
+			else
+				iUsageCount++;
+		}
+	}
+	if ((iUsageCount + iRangeCount) == 0)
+		return;
+
+	size = ((IOByteCount)(iUsageCount + iRangeCount) * sizeof(HIDUsageIndexEntry))
+		 + ((IOByteCount)ptPreparsedData->usageItemCount * sizeof(UInt32));
+	pMem = IOMallocZeroData((size_t)size);
+	if (pMem == NULL)
+		return;
+
+	ptPreparsedData->usageIndex = (HIDUsageIndexEntry *) pMem;
+	ptPreparsedData->usageIndexCount = iUsageCount;
+	ptPreparsedData->usageRangeIndex = ptPreparsedData->usageIndex + iUsageCount;
+	ptPreparsedData->usageRangeIndexCount = iRangeCount;
+	ptPreparsedData->usageOffsets = (UInt32 *) (ptPreparsedData->usageRangeIndex + iRangeCount);
+	ptPreparsedData->usageIndexBytesAllocated = size;
+/*
+ *	Fill the tables in report item order, so ranges come out sorted
+*/
+	ptUsage = ptPreparsedData->usageIndex;
+	ptRange = ptPreparsedData->usageRangeIndex;
+	for (iReportItem = 0; iReportItem < ptPreparsedData->reportItemCount; iReportItem++)
+	{
+		ptReportItem = &ptPreparsedData->reportItems[iReportItem];
+		iOffset = 0;
+		for (i = 0; i < ptReportItem->usageItemCount; i++)
+		{
+			ptUsageItem = &ptPreparsedData->usageItems[ptReportItem->firstUsageItem + i];
+			if (ptUsageItem->isRange)
+			{
+				ptRange->usagePage = ptUsageItem->usagePage;
+				ptRange->usageMinimum = (HIDUsage)ptUsageItem->usageMinimum;
+				ptRange->usageMaximum = (HIDUsage)ptUsageItem->usageMaximum;
+				ptRange->reportItem = iReportItem;
+				ptRange++;
+			}
+			else
+			{
+				ptUsage->usagePage = ptUsageItem->usagePage;
+				ptUsage->usageMinimum = ptUsageItem->usage;
+				ptUsage->usageMaximum = ptUsageItem->usage;
+				ptUsage->reportItem = iReportItem;
+				ptUsage++;
+			}
+/*
+ *			The offsets only stand in for the linear walk while every
+ *			running count fits the int arithmetic that walk uses
+*/
+			ptPreparsedData->usageOffsets[ptReportItem->firstUsageItem + i] = (UInt32)iOffset;
+			iOffset += HIDUsageItemSpan(ptUsageItem);
+			if (iOffset > 0x7FFFFFFF)
+				bOffsetsValid = false;
+		}
+	}
+	HIDUsageIndexSort(ptPreparsedData->usageIndex, iUsageCount);
+
+	if (!bOffsetsValid)
+		ptPreparsedData->usageOffsets = NULL;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDFreeUsageIndex - Release the usage lookup tables
+ *
+ *	 Input:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Output:
+ *			  ptPreparsedData		- The PreParsedData Structure
+ *	 Returns:
+ *
+ *------------------------------------------------------------------------------
+*/
+void HIDFreeUsageIndex(HIDPreparsedDataPtr ptPreparsedData)
+{
+/*
+ *	Tables opened from an image belong to the image
+*/
+	if ((ptPreparsedData->usageIndex != NULL) && (ptPreparsedData->usageIndexBytesAllocated != 0))
+		IOFreeData(ptPreparsedData->usageIndex, (size_t)ptPreparsedData->usageIndexBytesAllocated);
+	ptPreparsedData->usageIndex = NULL;
+	ptPreparsedData->usageIndexCount = 0;
+	ptPreparsedData->usageRangeIndex = NULL;
+	ptPreparsedData->usageRangeIndexCount = 0;
+	ptPreparsedData->usageOffsets = NULL;
+	ptPreparsedData->usageIndexBytesAllocated = 0;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDFindUsageReportItem - Find the next ReportItem that may have a usage
+ *
+ *	 Input:
+ *			  preparsedDataRef		- The PreParsedData Structure
+ *			  usagePage			   - The usage Page to find, or zero
+ *			  usage				   - The usage to find
+ *			  iFirstReportItem		- First ReportItem to consider
+ *			  iEndReportItem		- One past the last ReportItem to consider
+ *	 Output:
+ *	 Returns:
+ *			  The first ReportItem in [iFirstReportItem, iEndReportItem) for
+ *			  which HIDHasUsage may succeed, or iEndReportItem if there is none.
+ *			  ReportItems for which HIDHasUsage succeeds are never skipped.
+ *
+ *------------------------------------------------------------------------------
+*/
+SInt32 HIDFindUsageReportItem(HIDPreparsedDataRef preparsedDataRef,
+							  HIDUsage usagePage, HIDUsage usage,
+							  SInt32 iFirstReportItem, SInt32 iEndReportItem)
+{
+	HIDPreparsedDataPtr ptPreparsedData = (HIDPreparsedDataPtr) preparsedDataRef;
+	HIDUsageIndexEntry *ptEntry;
+	SInt32 iFound = iEndReportItem;
+	UInt32 iLow;
+	UInt32 iHigh;
+	UInt32 iMid;
+
+	if (iFirstReportItem >= iEndReportItem)
+		return iEndReportItem;
+	if ((ptPreparsedData->usageIndex == NULL) || (iFirstReportItem < 0))
+		return iFirstReportItem;
+/*
+ *	Single usages: the first entry for this usage at or after
+ *	iFirstReportItem that is on the page
+*/
+	iLow = 0;
+	iHigh = ptPreparsedData->usageIndexCount;
+	while (iLow < iHigh)
+	{
+		iMid = iLow + ((iHigh - iLow) / 2);
+		ptEntry = &ptPreparsedData->usageIndex[iMid];
+		if ((ptEntry->usageMinimum < usage)
+		 || ((ptEntry->usageMinimum == usage) && (ptEntry->reportItem < (UInt32)iFirstReportItem)))
+			iLow = iMid + 1;
+		else
+			iHigh = iMid;
+	}
+	for (; iLow < ptPreparsedData->usageIndexCount; iLow++)
+	{
+		ptEntry = &ptPreparsedData->usageIndex[iLow];
+		if ((ptEntry->usageMinimum != usage) || (ptEntry->reportItem >= (UInt32)iEndReportItem))
+			break;
+		if ((usagePage == 0) || (usagePage == ptEntry->usagePage))
+		{
+			iFound = (SInt32)ptEntry->reportItem;
+			break;
+		}
+	}
+/*
+ *	Usage ranges: scanned in ReportItem order, up to the best so far
+*/
+	iLow = 0;
+	iHigh = ptPreparsedData->usageRangeIndexCount;
+	while (iLow < iHigh)
+	{
+		iMid = iLow + ((iHigh - iLow) / 2);
+		if (ptPreparsedData->usageRangeIndex[iMid].reportItem < (UInt32)iFirstReportItem)
+			iLow = iMid + 1;
+		else
+			iHigh = iMid;
+	}
+	for (; iLow < ptPreparsedData->usageRangeIndexCount; iLow++)
+	{
+		ptEntry = &ptPreparsedData->usageRangeIndex[iLow];
+		if (ptEntry->reportItem >= (UInt32)iFound)
+			break;
+		if ((usage >= ptEntry->usageMinimum) && (usage <= ptEntry->usageMaximum)
+		 && ((usagePage == 0) || (usagePage == ptEntry->usagePage)))
+		{
+			iFound = (SInt32)ptEntry->reportItem;
+			break;
+		}
+	}
+	return iFound;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDFindUsageItemForIndex - Find the usage item covering a report index
+ *
+ *	 Input:
+ *			  preparsedDataRef		- The PreParsedData Structure
+ *			  ptReportItem			- The Report Item
+ *			  index					- The report index within the Report Item
+ *			  piUsageItem			- The usage Item pointer
+ *			  piOffset				- The offset within the usage Item pointer
+ *	 Output:
+ *			  piUsageItem			- The usage Item covering the index
+ *			  piOffset				- How far into that usage Item the index is
+ *	 Returns:
+ *			  false if the caller has to walk the usage Items itself
+ *
+ *------------------------------------------------------------------------------
+*/
+Boolean HIDFindUsageItemForIndex(HIDPreparsedDataRef preparsedDataRef,
+								 HIDReportItem *ptReportItem, UInt32 index,
+								 SInt32 *piUsageItem, UInt32 *piOffset)
+{
+	HIDPreparsedDataPtr ptPreparsedData = (HIDPreparsedDataPtr) preparsedDataRef;
+	UInt32 *piOffsets = ptPreparsedData->usageOffsets;
+	SInt32 iFirst = ptReportItem->firstUsageItem;
+	SInt32 iLast = iFirst + ptReportItem->usageItemCount - 1;
+	SInt32 iMid;
+
+	if ((piOffsets == NULL)
+	 || (ptReportItem->usageItemCount <= 0)
+	 || (iFirst < 0)
+	 || ((UInt32)iLast >= ptPreparsedData->usageItemCount)
+	 || (index > 0x7FFFFFFF))
+		return false;
+/*
+ *	Past the end, the walk falls through to the last usage Item
+*/
+	if ((int64_t)index >= (piOffsets[iLast] + HIDUsageItemSpan(&ptPreparsedData->usageItems[iLast])))
+		return false;
+/*
+ *	The last usage Item whose offset is not past the index
+*/
+	while (iFirst < iLast)
+	{
+		iMid = iFirst + ((iLast - iFirst + 1) / 2);
+		if (piOffsets[iMid] <= index)
+			iFirst = iMid;
+		else
+			iLast = iMid - 1;
+	}
+	*piUsageItem = iFirst;
+	*piOffset = index - piOffsets[iFirst];
+	return true;
+}
@@ -48,6 +48,59 @@
 
 #include "HIDLib.h"
 
+#if !(KERNEL || TARGET_OS_DRIVERKIT)
+
+#include <stdlib.h>
+#include <string.h>
+
+static void * IOMallocZeroData(size_t size) {
+	return calloc(1, size);
+}
+
+static void IOFreeData(void* ptr, size_t __unused size) {
+	free(ptr);
+}
+
+#else
+
+#if TARGET_OS_DRIVERKIT
+#include <DriverKit/IOLib.h>
+#include <string.h>
+
+extern void *
+IOMallocZeroData(size_t length);
+
+extern void IOFreeData(void * address, size_t length);
+
+#else
+#include <IOKit/system.h>
+#include <IOKit/IOLib.h>
+#endif
+
+#endif
+
+/*
+ *	Lists up to this long are compared directly; the sorted path only
+ *	pays for its allocation and sort on longer lists
+*/
+#define kHIDUsageListShortLength	32
+
+/*
+ *	Cap on the sorted path's scratch, see HIDUsageListScratchSize
+*/
+#define kHIDUsageListMaxSortedLength	0x01000000
+
+/*
+ *	One 256 entry radix count table per byte of a usage
+*/
+#define kHIDUsageListRadixCounts		(sizeof(HIDUsage) * 256)
+
+/*
+ *	Radix counts, two sort orders and a temp order, break and make flags
+*/
+#define HIDUsageListScratchSize(length)	\
+	((kHIDUsageListRadixCounts * sizeof(UInt32)) + ((size_t)(length) * ((3 * sizeof(UInt32)) + 2)))
+
 /*
  *------------------------------------------------------------------------------
  *
@@ -76,7 +129,7 @@ static Boolean IsUsageInUsageList(HIDUsage *piUsageList, UInt32 iUsageListLength
 /*
  *------------------------------------------------------------------------------
  *
- * HIDUsageListDifference - Return adds and drops given present and past
+ * HIDUsageListDifferenceDirect - Make and break lists for short usage Lists
  *
  *	 Input:
  *			  piPreviouUL			- Previous usage List
@@ -88,10 +141,14 @@ static Boolean IsUsageInUsageList(HIDUsage *piUsageList, UInt32 iUsageListLength
  *			  piBreakUL				- Break usage List
  *			  piMakeUL				- Make usage List
  *	 Returns:
+ *			  Length of the break and make usage Lists
  *
  *------------------------------------------------------------------------------
 */
-OSStatus HIDUsageListDifference(HIDUsage *piPreviousUL, HIDUsage *piCurrentUL, HIDUsage *piBreakUL, HIDUsage *piMakeUL, UInt32 iUsageListLength)
+static void HIDUsageListDifferenceDirect(HIDUsage *piPreviousUL, HIDUsage *piCurrentUL,
+										 HIDUsage *piBreakUL, HIDUsage *piMakeUL,
+										 UInt32 iUsageListLength,
+										 UInt32 *piBreakLength, UInt32 *piMakeLength)
 {
 	int i;
 	HIDUsage usage;
@@ -114,12 +171,204 @@ OSStatus HIDUsageListDifference(HIDUsage *piPreviousUL, HIDUsage *piCurrentUL, H
 						  && (!IsUsageInUsageList(piBreakUL,iBreakLength,usage)))
 			piBreakUL[iBreakLength++] = usage;
 	}
+	*piBreakLength = iBreakLength;
+	*piMakeLength = iMakeLength;
+}
+
+/*
+ *	Stable byte-wise radix sort of a usage List's indices, so equal usages
+ *	stay in list order.  Passes where every usage has the same byte are
+ *	skipped, which leaves one or two passes for real usage values.
+*/
+static UInt32 *HIDSortUsageOrder(HIDUsage *piUsageList, UInt32 iUsageListLength,
+								 UInt32 *piOrder, UInt32 *piTemp, UInt32 *piCounts)
+{
+	UInt32 *piFrom = piOrder;
+	UInt32 *piTo = piTemp;
+	UInt32 *piSwap;
+	UInt32 iByte;
+	UInt32 iTotal;
+	UInt32 iCount;
+	UInt32 i;
+
+	memset(piCounts, 0, kHIDUsageListRadixCounts * sizeof(UInt32));
+	for (i = 0; i < iUsageListLength; i++)
+	{
+		piOrder[i] = i;
+		for (iByte = 0; iByte < sizeof(HIDUsage); iByte++)
+			piCounts[(iByte * 256) + ((piUsageList[i] >> (iByte * 8)) & 0xFF)]++;
+	}
+	for (iByte = 0; iByte < sizeof(HIDUsage); iByte++)
+	{
+		UInt32 *piByteCounts = piCounts + (iByte * 256);
+		if (piByteCounts[(piUsageList[0] >> (iByte * 8)) & 0xFF] == iUsageListLength)
+			continue;
+		for (i = 0, iTotal = 0; i < 256; i++)
+		{
+			iCount = piByteCounts[i];
+			piByteCounts[i] = iTotal;
+			iTotal += iCount;
+		}
+		for (i = 0; i < iUsageListLength; i++)
+			piTo[piByteCounts[(piUsageList[piFrom[i]] >> (iByte * 8)) & 0xFF]++] = piFrom[i];
+		piSwap = piFrom;
+		piFrom = piTo;
+		piTo = piSwap;
+	}
+	return piFrom;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDUsageListDifferenceSorted - Make and break lists for long usage Lists
+ *
+ *	 Input:
+ *			  piPreviouUL			- Previous usage List
+ *			  piCurrentUL			- Current usage List
+ *			  piBreakUL				- Break usage List
+ *			  piMakeUL				- Make usage List
+ *			  iUsageListLength		- Max entries in usage Lists
+ *			  pScratch				- HIDUsageListScratchSize zeroed bytes
+ *	 Output:
+ *			  piBreakUL				- Break usage List
+ *			  piMakeUL				- Make usage List
+ *	 Returns:
+ *			  Length of the break and make usage Lists
+ *
+ *	NOTE: Produces the same lists, in the same order, as the direct
+ *		  comparison.  One merge of the two sorted orders flags the first
+ *		  entry of each usage found in only one of the lists, then the
+ *		  flagged entries are copied out in list order.
+ *
+ *------------------------------------------------------------------------------
+*/
+static void HIDUsageListDifferenceSorted(HIDUsage *piPreviousUL, HIDUsage *piCurrentUL,
+										 HIDUsage *piBreakUL, HIDUsage *piMakeUL,
+										 UInt32 iUsageListLength, UInt8 *pScratch,
+										 UInt32 *piBreakLength, UInt32 *piMakeLength)
+{
+	UInt32 *piCounts = (UInt32 *) pScratch;
+	UInt32 *piPreviousOrder = piCounts + kHIDUsageListRadixCounts;
+	UInt32 *piCurrentOrder = piPreviousOrder + iUsageListLength;
+	UInt32 *piTemp = piCurrentOrder + iUsageListLength;
+	UInt8 *pbBroken = (UInt8 *) (piTemp + iUsageListLength);
+	UInt8 *pbMade = pbBroken + iUsageListLength;
+	UInt32 *piOrder;
+	HIDUsage previous;
+	HIDUsage current;
+	UInt32 iBreakLength = 0;
+	UInt32 iMakeLength = 0;
+	UInt32 i;
+	UInt32 j;
+
+	piOrder = HIDSortUsageOrder(piPreviousUL, iUsageListLength, piPreviousOrder, piTemp, piCounts);
+	if (piOrder != piPreviousOrder)
+	{
+		piTemp = piPreviousOrder;
+		piPreviousOrder = piOrder;
+	}
+	piOrder = HIDSortUsageOrder(piCurrentUL, iUsageListLength, piCurrentOrder, piTemp, piCounts);
+	if (piOrder != piCurrentOrder)
+		piCurrentOrder = piOrder;
+/*
+ *	Walk both sorted orders a run of equal usages at a time
+*/
+	i = 0;
+	j = 0;
+	while ((i < iUsageListLength) || (j < iUsageListLength))
+	{
+		previous = (i < iUsageListLength) ? piPreviousUL[piPreviousOrder[i]] : 0;
+		current = (j < iUsageListLength) ? piCurrentUL[piCurrentOrder[j]] : 0;
+		if ((j == iUsageListLength) || ((i < iUsageListLength) && (previous < current)))
+		{
+/*
+ *			In Previous but not Current then it's a Break
+*/
+			if (previous != 0)
+				pbBroken[piPreviousOrder[i]] = true;
+			while ((i < iUsageListLength) && (piPreviousUL[piPreviousOrder[i]] == previous))
+				i++;
+		}
+		else if ((i == iUsageListLength) || (current < previous))
+		{
+/*
+ *			In Current but not Previous then it's a Make
+*/
+			if (current != 0)
+				pbMade[piCurrentOrder[j]] = true;
+			while ((j < iUsageListLength) && (piCurrentUL[piCurrentOrder[j]] == current))
+				j++;
+		}
+		else
+		{
+			while ((i < iUsageListLength) && (piPreviousUL[piPreviousOrder[i]] == previous))
+				i++;
+			while ((j < iUsageListLength) && (piCurrentUL[piCurrentOrder[j]] == current))
+				j++;
+		}
+	}
+	for (i = 0; i < iUsageListLength; i++)
+	{
+		if (pbMade[i])
+			piMakeUL[iMakeLength++] = piCurrentUL[i];
+		if (pbBroken[i])
+			piBreakUL[iBreakLength++] = piPreviousUL[i];
+	}
+	*piBreakLength = iBreakLength;
+	*piMakeLength = iMakeLength;
+}
+
+/*
+ *------------------------------------------------------------------------------
+ *
+ * HIDUsageListDifference - Return adds and drops given present and past
+ *
+ *	 Input:
+ *			  piPreviouUL			- Previous usage List
+ *			  piCurrentUL			- Current usage List
+ *			  piBreakUL				- Break usage List
+ *			  piMakeUL				- Make usage List
+ *			  iUsageListLength		- Max entries in usage Lists
+ *	 Output:
+ *			  piBreakUL				- Break usage List
+ *			  piMakeUL				- Make usage List
+ *	 Returns:
+ *
+ *------------------------------------------------------------------------------
+*/
+OSStatus HIDUsageListDifference(HIDUsage *piPreviousUL, HIDUsage *piCurrentUL, HIDUsage *piBreakUL, HIDUsage *piMakeUL, UInt32 iUsageListLength)
+{
+	UInt32 iBreakLength;
+	UInt32 iMakeLength;
+	UInt8 *pScratch = NULL;
+	size_t scratchSize = 0;
+/*
+ *	Long lists go through sorted copies, if there is memory for them
+*/
+	if ((iUsageListLength > kHIDUsageListShortLength)
+	 && (iUsageListLength <= kHIDUsageListMaxSortedLength))
+	{
+		scratchSize = HIDUsageListScratchSize(iUsageListLength);
+		pScratch = IOMallocZeroData(scratchSize);
+	}
+	if (pScratch != NULL)
+	{
+		HIDUsageListDifferenceSorted(piPreviousUL, piCurrentUL, piBreakUL, piMakeUL,
+									 iUsageListLength, pScratch, &iBreakLength, &iMakeLength);
+		IOFreeData(pScratch, scratchSize);
+	}
+	else
+	{
+		HIDUsageListDifferenceDirect(piPreviousUL, piCurrentUL, piBreakUL, piMakeUL,
+									 iUsageListLength, &iBreakLength, &iMakeLength);
+	}
 /*
  *	Clear the rest of the usage Lists
 */
-	while (iMakeLength < (int)iUsageListLength)
+	while (iMakeLength < iUsageListLength)
 		piMakeUL[iMakeLength++] = 0;
-	while (iBreakLength < (int)iUsageListLength)
+	while (iBreakLength < iUsageListLength)
 		piBreakUL[iBreakLength++] = 0;
 	return kHIDSuccess;
 }
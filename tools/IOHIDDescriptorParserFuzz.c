@@ -0,0 +1,859 @@
+/*
+ * Copyright (c) 2024 Apple Inc. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ *
+ * The contents of this file constitute Original Code as defined in and
+ * are subject to the Apple Public Source License Version 1.1 (the
+ * "License").  You may not use this file except in compliance with the
+ * License.  Please obtain a copy of the License at
+ * http://www.apple.com/publicsource and read it before using this file.
+ *
+ * This Original Code and all software distributed under the License are
+ * distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE OR NON-INFRINGEMENT.  Please see the
+ * License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+/*
+ * hidParserFuzz drives the IOHIDDescriptorParser sources on the host, either
+ * as a libFuzzer target or as a standalone corpus runner and benchmark.
+ *
+ * Input format:
+ *
+ *     <descriptor length, 2 bytes little endian> <descriptor> <report data>
+ *
+ * The report data is cut into reports of the parsed input/output/feature
+ * report length (the last one may be short) and every button and value cap
+ * is read back with HIDGetButtons/HIDGetUsageValue and written with
+ * HIDSetUsageValue, and HIDGetScaledUsageValues is checked field by field
+ * against HIDGetData and HIDScaleUsageValueIn. The parsed descriptor is also
+ * written out as a preparsed data image and opened again from it, which has to
+ * give the same caps.
+ * Inputs shorter than the length prefix are parsed as a bare descriptor.
+ * Seeds live in tools/IOHIDDescriptorParserCorpus.
+ *
+ * libFuzzer build:
+ *
+ *     clang -g -O1 -fsanitize=fuzzer,address -DHID_PARSER_FUZZ_LIBFUZZER=1 \
+ *         -DRTKIT=1 '-D__unused=__attribute__((unused))' \
+ *         -IIOHIDSystem/IOHIDDescriptorParser -IIOHIDFamily -IIOHIDSystem \
+ *         -IIOHIDSystem/IOKit/hidsystem \
+ *         tools/IOHIDDescriptorParserFuzz.c IOHIDSystem/IOHIDDescriptorParser/HID*.c \
+ *         -o hidParserFuzz
+ *     ./hidParserFuzz tools/IOHIDDescriptorParserCorpus
+ *
+ * Without HID_PARSER_FUZZ_LIBFUZZER the same command (minus -fsanitize=fuzzer)
+ * builds a runner that feeds each file given on the command line through the
+ * target once, and with --bench reports descriptors/s, images/s, reports/s and the
+ * HIDUsageListDifference rate for 6, 64 and 512 entry usage lists.
+ *
+ * --check-fields compares HIDGetData and HIDPutData against the byte-wise
+ * versions they replaced, kept below as a reference, for every start bit up to
+ * one byte past the report, every size up to 32 bits, signed and unsigned, and
+ * report lengths 1-20. Reports are allocated at their exact length so ASan
+ * catches any read or write past the end. It exits non-zero on any difference.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include <IOKit/hidsystem/IOHIDDescriptorParser.h>
+#include "IOHIDDescriptorParserPrivate.h"
+#include "HIDLib.h"
+
+#ifndef HID_PARSER_FUZZ_LIBFUZZER
+#define HID_PARSER_FUZZ_LIBFUZZER 0
+#endif
+
+#define kFuzzMaxCaps            1024
+#define kFuzzMaxUsages          4096
+#define kFuzzPrefixLength       2
+
+static const HIDReportType gReportTypes[] = { kHIDInputReport, kHIDOutputReport, kHIDFeatureReport };
+
+typedef struct {
+    HIDPreparsedDataRef ref;
+    HIDCaps             caps;
+    HIDButtonCaps       buttonCaps[3][kFuzzMaxCaps];
+    UInt32              buttonCapsCount[3];
+    HIDValueCaps        valueCaps[3][kFuzzMaxCaps];
+    UInt32              valueCapsCount[3];
+} FuzzDevice;
+
+static HIDUsageAndPage gUsageList[kFuzzMaxUsages];
+static HIDScaledValueEntry gScaledEntries[kFuzzMaxUsages];
+static SInt32 gScaledValues[kFuzzMaxUsages];
+static OSStatus gScaledStatuses[kFuzzMaxUsages];
+
+// Splits an input into its descriptor and trailing report data
+static void splitInput(const uint8_t *data, size_t size, const uint8_t **descriptor, size_t *descriptorLength, size_t *reportsLength)
+{
+    *descriptor = data;
+    *descriptorLength = size;
+    *reportsLength = 0;
+
+    if (size >= kFuzzPrefixLength) {
+        size_t length = data[0] | (data[1] << 8);
+
+        if (length > size - kFuzzPrefixLength) {
+            length = size - kFuzzPrefixLength;
+        }
+        *descriptor = data + kFuzzPrefixLength;
+        *descriptorLength = length;
+        *reportsLength = size - kFuzzPrefixLength - length;
+    }
+}
+
+static bool openDevice(FuzzDevice *device, const uint8_t *descriptor, size_t length)
+{
+    memset(device, 0, sizeof(*device));
+
+    // The parser never writes through the descriptor pointer
+    if (HIDOpenReportDescriptor((void *)descriptor, length, &device->ref, 0) != kHIDSuccess) {
+        return false;
+    }
+
+    HIDGetCaps(device->ref, &device->caps);
+
+    for (int i = 0; i < 3; i++) {
+        device->buttonCapsCount[i] = kFuzzMaxCaps;
+        if (HIDGetButtonCaps(gReportTypes[i], device->buttonCaps[i], &device->buttonCapsCount[i], device->ref) != kHIDSuccess) {
+            device->buttonCapsCount[i] = 0;
+        }
+
+        device->valueCapsCount[i] = kFuzzMaxCaps;
+        if (HIDGetValueCaps(gReportTypes[i], device->valueCaps[i], &device->valueCapsCount[i], device->ref) != kHIDSuccess) {
+            device->valueCapsCount[i] = 0;
+        }
+    }
+
+    return true;
+}
+
+static void closeDevice(FuzzDevice *device)
+{
+    HIDCloseReportDescriptor(device->ref);
+    device->ref = NULL;
+}
+
+static IOByteCount reportLength(const FuzzDevice *device, int type)
+{
+    switch (gReportTypes[type]) {
+        case kHIDInputReport:   return device->caps.inputReportByteLength;
+        case kHIDOutputReport:  return device->caps.outputReportByteLength;
+        default:                return device->caps.featureReportByteLength;
+    }
+}
+
+// Returns the number of reports decoded
+static size_t decodeReports(FuzzDevice *device, int type, uint8_t *data, size_t length, bool write)
+{
+    HIDReportType   reportType  = gReportTypes[type];
+    IOByteCount     maxLength   = reportLength(device, type);
+    size_t          count       = 0;
+
+    if (!maxLength) {
+        return 0;
+    }
+
+    for (size_t offset = 0; offset < length; offset += maxLength, count++) {
+        uint8_t *   report          = data + offset;
+        IOByteCount thisLength      = (length - offset) < maxLength ? (length - offset) : maxLength;
+
+        if (device->buttonCapsCount[type]) {
+            UInt32 usageCount = kFuzzMaxUsages;
+            HIDGetButtons(reportType, 0, gUsageList, &usageCount, device->ref, report, thisLength);
+        }
+
+        for (UInt32 i = 0; i < device->valueCapsCount[type]; i++) {
+            HIDValueCaps *  cap     = &device->valueCaps[type][i];
+            HIDUsage        usage   = cap->isRange ? cap->u.range.usageMin : cap->u.notRange.usage;
+            SInt32          value   = 0;
+
+            if (HIDGetUsageValue(reportType, cap->usagePage, cap->collection, usage, &value, device->ref, report, thisLength) != kHIDSuccess) {
+                continue;
+            }
+
+            if (write) {
+                HIDSetUsageValue(reportType, cap->usagePage, cap->collection, usage, ~value, device->ref, report, thisLength);
+            }
+        }
+    }
+
+    return count;
+}
+
+// Returns the scaled value entries for the report, or 0 if there are none
+static UInt32 getScaledEntries(const FuzzDevice *device, HIDReportType reportType, const uint8_t *report)
+{
+    UInt32 count = kFuzzMaxUsages;
+
+    // Reports without an ID hold report 0's fields from their first byte
+    if (HIDGetScaledValueEntries(reportType, report[0], gScaledEntries, &count, device->ref) != kHIDSuccess || !count) {
+        count = kFuzzMaxUsages;
+        if (HIDGetScaledValueEntries(reportType, 0, gScaledEntries, &count, device->ref) != kHIDSuccess) {
+            count = 0;
+        }
+    }
+    return count;
+}
+
+// Scales one field the way HIDGetScaledUsageValue does once it has found it.
+// Returns false where the batch scaling differs by design: HIDScaleUsageValueIn
+// takes the value as unsigned, so with 64 bit longs a negative value is out of
+// range, and it works the physical range out in 32 bits.
+static bool scaleField(HIDReportItem *reportItem, SInt32 field, void *report, IOByteCount length, SInt32 *value, OSStatus *status)
+{
+    int64_t deltaP  = (int64_t)reportItem->globals.physicalMaximum - reportItem->globals.physicalMinimum;
+    bool    isSigned = reportItem->globals.logicalMinimum < 0 || reportItem->globals.logicalMaximum < 0;
+
+    *value = 0;
+    *status = HIDGetData(report, length, reportItem->startBit + reportItem->globals.reportSize * field,
+                         reportItem->globals.reportSize, value, isSigned);
+    if (*status == kHIDSuccess) {
+        *status = HIDPostProcessRIValue(reportItem, value);
+    }
+    if (*status != kHIDSuccess) {
+        *value = 0;
+        return true;
+    }
+    if (*value < 0 || deltaP != (SInt32)deltaP) {
+        return false;
+    }
+    *status = HIDScaleUsageValueIn(reportItem, *value, value);
+    return true;
+}
+
+// Checks every batch scaled value against the same field scaled on its own.
+// The entries follow the report items, one per field.
+static void checkScaledValues(const FuzzDevice *device, int type, uint8_t *data, size_t length)
+{
+    HIDPreparsedDataPtr preparsedData = (HIDPreparsedDataPtr)device->ref;
+    HIDReportType       reportType  = gReportTypes[type];
+    IOByteCount         maxLength   = reportLength(device, type);
+
+    if (!maxLength) {
+        return;
+    }
+
+    for (size_t offset = 0; offset < length; offset += maxLength) {
+        uint8_t *   report      = data + offset;
+        IOByteCount thisLength  = (length - offset) < maxLength ? (length - offset) : maxLength;
+        UInt32      count       = getScaledEntries(device, reportType, report);
+        UInt32      entry       = 0;
+        OSStatus    status;
+
+        status = HIDGetScaledUsageValues(gScaledEntries, count, gScaledValues, gScaledStatuses, report, thisLength);
+        if (!count || status == kHIDIncompatibleReportErr || status == kHIDInvalidReportLengthErr) {
+            continue;
+        }
+
+        for (UInt32 i = 0; i < preparsedData->reportItemCount; i++) {
+            HIDReportItem * reportItem = &preparsedData->reportItems[i];
+
+            if (reportItem->reportType != reportType
+                || (UInt32)reportItem->globals.reportID != gScaledEntries[0].reportID
+                || !HIDIsVariable(reportItem, device->ref)) {
+                continue;
+            }
+
+            for (SInt32 field = 0; field < reportItem->globals.reportCount; field++, entry++) {
+                SInt32 value;
+
+                if (entry >= count || !scaleField(reportItem, field, report, thisLength, &value, &status)) {
+                    continue;
+                }
+                if (status != gScaledStatuses[entry] || value != gScaledValues[entry]) {
+                    fprintf(stderr, "scaled value %u: %d (%d), expected %d (%d)\n",
+                            (unsigned)entry, (int)gScaledValues[entry], (int)gScaledStatuses[entry], (int)value, (int)status);
+                    abort();
+                }
+            }
+        }
+
+        if (entry != count) {
+            fprintf(stderr, "%u scaled value entries for %u fields\n", (unsigned)count, (unsigned)entry);
+            abort();
+        }
+    }
+}
+
+// Writes the device out as an image, or returns NULL
+static void *copyImage(const FuzzDevice *device, IOByteCount *length)
+{
+    void *image;
+
+    *length = 0;
+    if (HIDGetPreparsedDataImage(device->ref, NULL, length) != kHIDBufferTooSmallErr) {
+        return NULL;
+    }
+
+    image = malloc(*length);
+    if (image && HIDGetPreparsedDataImage(device->ref, image, length) != kHIDSuccess) {
+        free(image);
+        image = NULL;
+    }
+    return image;
+}
+
+static void checkImage(const FuzzDevice *device)
+{
+    HIDPreparsedDataRef ref     = NULL;
+    HIDCaps             caps;
+    HIDDescriptorStatistics stats;
+    HIDDescriptorStatistics imageStats;
+    IOByteCount         length;
+    void *              image   = copyImage(device, &length);
+
+    if (!image) {
+        return;
+    }
+
+    if (HIDOpenPreparsedDataImage(image, length, &ref) != kHIDSuccess) {
+        abort();
+    }
+
+    memset(&caps, 0, sizeof(caps));
+    HIDGetCaps(ref, &caps);
+    if (memcmp(&caps, &device->caps, sizeof(caps))) {
+        abort();
+    }
+
+    // Statistics come from the tables, so they have to survive the round trip
+    if (HIDGetDescriptorStatistics(device->ref, &stats) != kHIDSuccess ||
+        HIDGetDescriptorStatistics(ref, &imageStats) != kHIDSuccess ||
+        memcmp(&stats, &imageStats, sizeof(stats))) {
+        abort();
+    }
+
+    HIDCloseReportDescriptor(ref);
+    free(image);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    static FuzzDevice   device;
+    const uint8_t *     descriptor;
+    size_t              length;
+    uint8_t *           reports     = NULL;
+    size_t              reportsSize;
+
+    splitInput(data, size, &descriptor, &length, &reportsSize);
+
+    if (!openDevice(&device, descriptor, length)) {
+        return 0;
+    }
+
+    // HIDSetUsageValue writes into the report, so work on a copy
+    if (reportsSize) {
+        reports = malloc(reportsSize);
+    }
+
+    if (reports) {
+        for (int type = 0; type < 3; type++) {
+            memcpy(reports, descriptor + length, reportsSize);
+            checkScaledValues(&device, type, reports, reportsSize);
+            decodeReports(&device, type, reports, reportsSize, true);
+        }
+        free(reports);
+    }
+
+    checkImage(&device);
+
+    closeDevice(&device);
+    return 0;
+}
+
+#if !HID_PARSER_FUZZ_LIBFUZZER
+
+typedef struct {
+    uint8_t *   bytes;
+    size_t      length;
+} FuzzInput;
+
+static uint64_t nowNS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool loadInput(const char *path, FuzzInput *input)
+{
+    FILE *  file    = fopen(path, "rb");
+    long    length;
+    bool    result  = false;
+
+    if (!file) {
+        fprintf(stderr, "%s: unable to open\n", path);
+        return false;
+    }
+
+    if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        goto exit;
+    }
+
+    input->length = (size_t)length;
+    input->bytes = malloc(input->length ? input->length : 1);
+    if (!input->bytes) {
+        goto exit;
+    }
+
+    result = fread(input->bytes, 1, input->length, file) == input->length;
+    if (!result) {
+        free(input->bytes);
+        input->bytes = NULL;
+    }
+
+exit:
+    fclose(file);
+    return result;
+}
+
+static void benchImages(FuzzInput *inputs, int count, uint64_t budget)
+{
+    static FuzzDevice   device;
+    void **             images  = calloc(count, sizeof(void *));
+    IOByteCount *       lengths = calloc(count, sizeof(IOByteCount));
+    uint64_t            start;
+    uint64_t            elapsed;
+    uint64_t            opens   = 0;
+
+    if (!images || !lengths) {
+        goto exit;
+    }
+
+    for (int i = 0; i < count; i++) {
+        const uint8_t * bytes;
+        size_t          length;
+        size_t          unused;
+
+        splitInput(inputs[i].bytes, inputs[i].length, &bytes, &length, &unused);
+        if (openDevice(&device, bytes, length)) {
+            images[i] = copyImage(&device, &lengths[i]);
+            closeDevice(&device);
+        }
+    }
+
+    start = nowNS();
+    do {
+        for (int i = 0; i < count; i++) {
+            HIDPreparsedDataRef ref;
+
+            if (images[i] && HIDOpenPreparsedDataImage(images[i], lengths[i], &ref) == kHIDSuccess) {
+                HIDCloseReportDescriptor(ref);
+            }
+            opens++;
+        }
+        elapsed = nowNS() - start;
+    } while (elapsed < budget);
+
+    printf("images: %llu in %.3fs, %.0f images/s\n",
+           (unsigned long long)opens, elapsed / 1e9, opens / (elapsed / 1e9));
+
+exit:
+    for (int i = 0; images && i < count; i++) {
+        free(images[i]);
+    }
+    free(images);
+    free(lengths);
+}
+
+// Scaled input values, one HIDGetScaledUsageValue per value against one
+// HIDGetScaledUsageValues per report, with the entries built up front
+static void benchScaledValues(const FuzzDevice *device, uint8_t *data, size_t length,
+                              uint64_t budget, uint64_t *scalar, uint64_t *batch)
+{
+    IOByteCount maxLength   = device->caps.inputReportByteLength;
+    UInt32      count       = getScaledEntries(device, kHIDInputReport, data);
+    uint64_t    start;
+
+    if (!count || !maxLength) {
+        return;
+    }
+
+    // Every report carries the ID the entries are for
+    if (gScaledEntries[0].flags & kHIDScaledValueReportID) {
+        for (size_t offset = 0; offset < length; offset += maxLength) {
+            data[offset] = gScaledEntries[0].reportID;
+        }
+    }
+
+    start = nowNS();
+    do {
+        for (size_t offset = 0; offset + maxLength <= length; offset += maxLength) {
+            for (UInt32 i = 0; i < count; i++) {
+                HIDGetScaledUsageValue(kHIDInputReport, gScaledEntries[i].usagePage, gScaledEntries[i].collection,
+                                       gScaledEntries[i].usage, &gScaledValues[i], device->ref, data + offset, maxLength);
+            }
+            *scalar += count;
+        }
+    } while (nowNS() - start < budget / 2);
+
+    start = nowNS();
+    do {
+        for (size_t offset = 0; offset + maxLength <= length; offset += maxLength) {
+            HIDGetScaledUsageValues(gScaledEntries, count, gScaledValues, NULL, data + offset, maxLength);
+            *batch += count;
+        }
+    } while (nowNS() - start < budget / 2);
+}
+
+static void benchDescriptors(FuzzInput *inputs, int count, double seconds)
+{
+    static FuzzDevice   device;
+    uint64_t            budget      = (uint64_t)(seconds * 1e9);
+    uint64_t            start;
+    uint64_t            elapsed;
+    uint64_t            descriptors = 0;
+    uint64_t            reports     = 0;
+    uint64_t            scalar      = 0;
+    uint64_t            batch       = 0;
+    uint8_t *           reportData  = NULL;
+    size_t              reportSize  = 0;
+
+    // Open/close only, using the descriptor part of every input
+    start = nowNS();
+    do {
+        for (int i = 0; i < count; i++) {
+            const uint8_t * bytes;
+            size_t          length;
+            size_t          unused;
+
+            splitInput(inputs[i].bytes, inputs[i].length, &bytes, &length, &unused);
+            if (openDevice(&device, bytes, length)) {
+                closeDevice(&device);
+            }
+            descriptors++;
+        }
+        elapsed = nowNS() - start;
+    } while (elapsed < budget);
+
+    printf("descriptors: %llu in %.3fs, %.0f descriptors/s\n",
+           (unsigned long long)descriptors, elapsed / 1e9, descriptors / (elapsed / 1e9));
+
+    // Open/close only, from an image of every descriptor that parses
+    benchImages(inputs, count, budget);
+
+    // Decode only, against a fixed pseudo-random report stream per device
+    elapsed = 0;
+    for (int i = 0; i < count && elapsed < budget; i++) {
+        const uint8_t * bytes;
+        size_t          length;
+        size_t          unused;
+        size_t          needed;
+
+        splitInput(inputs[i].bytes, inputs[i].length, &bytes, &length, &unused);
+
+        if (!openDevice(&device, bytes, length)) {
+            continue;
+        }
+
+        needed = device.caps.inputReportByteLength * 64;
+        if (needed > reportSize) {
+            uint8_t *grown = realloc(reportData, needed);
+            if (!grown) {
+                closeDevice(&device);
+                break;
+            }
+            reportData = grown;
+            reportSize = needed;
+        }
+
+        for (size_t j = 0; j < needed; j++) {
+            reportData[j] = (uint8_t)(j * 2654435761U >> 13);
+        }
+
+        start = nowNS();
+        do {
+            reports += decodeReports(&device, 0, reportData, needed, false);
+        } while (nowNS() - start < budget / count);
+        elapsed += nowNS() - start;
+
+        benchScaledValues(&device, reportData, needed, budget / count, &scalar, &batch);
+
+        closeDevice(&device);
+    }
+
+    if (elapsed) {
+        printf("reports: %llu in %.3fs, %.0f reports/s\n",
+               (unsigned long long)reports, elapsed / 1e9, reports / (elapsed / 1e9));
+        printf("scaled values: %llu scalar, %llu batch in the same time (%.2fx)\n",
+               (unsigned long long)scalar, (unsigned long long)batch, scalar ? (double)batch / scalar : 0.0);
+    }
+
+    free(reportData);
+}
+
+static void benchUsageListDifference(double seconds)
+{
+    static const UInt32 lengths[] = { 6, 64, 512 };
+    static HIDUsage     previous[512];
+    static HIDUsage     current[512];
+    static HIDUsage     breaks[512];
+    static HIDUsage     makes[512];
+    uint64_t            budget = (uint64_t)(seconds * 1e9 / (sizeof(lengths) / sizeof(lengths[0])));
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        UInt32      length  = lengths[i];
+        uint64_t    calls   = 0;
+        uint64_t    start;
+        uint64_t    elapsed;
+
+        // Two held states a quarter apart, in scrambled order, with some empty slots
+        for (UInt32 j = 0; j < length; j++) {
+            previous[j] = (j % 8 == 7) ? 0 : 4 + ((j * 2654435761U) % (length * 2));
+            current[j]  = (j % 8 == 3) ? 0 : 4 + (((j + length / 4) * 2654435761U) % (length * 2));
+        }
+
+        start = nowNS();
+        do {
+            for (int k = 0; k < 64; k++) {
+                HIDUsageListDifference(previous, current, breaks, makes, length);
+            }
+            calls += 64;
+            elapsed = nowNS() - start;
+        } while (elapsed < budget);
+
+        printf("usage list difference (%u usages): %.0f calls/s\n",
+               (unsigned)length, calls / (elapsed / 1e9));
+    }
+}
+
+// HIDGetData as it was before the word path. Only sizes up to 32 bits are
+// compared, where all of its shifts are defined.
+static OSStatus referenceGetData(const uint8_t *report, IOByteCount reportLength,
+                                 UInt32 start, UInt32 size, SInt32 *value, bool signExtend)
+{
+    unsigned    data        = 0;
+    unsigned    startByte   = start / 8;
+    unsigned    startBit    = start & 7;
+    unsigned    lastBit     = start + size - 1;
+    unsigned    lastByte    = lastBit / 8;
+
+    if ((size == 0) || (lastByte >= reportLength) || (lastByte < startByte)) {
+        return kHIDBadParameterErr;
+    }
+
+    for (int byte = (int)lastByte; byte >= (int)startByte; byte--) {
+        unsigned mask = (byte == (int)lastByte) ? ((1U << ((lastBit % 8) + 1)) - 1) : 0xff;
+
+        data <<= 8;
+        data |= report[byte] & mask;
+    }
+    data >>= startBit;
+
+    if (signExtend) {
+        unsigned signBit    = 1U << (size - 1);
+        unsigned extendMask = (signBit << 1) - 1;
+
+        data = (data & signBit) ? (data | ~extendMask) : (data & extendMask);
+    }
+
+    *value = (SInt32)data;
+    return kHIDSuccess;
+}
+
+// HIDPutData as it was before the word path. The left shift of the value goes
+// through unsigned, which gives the same bits without the signed overflow.
+static OSStatus referencePutData(uint8_t *report, IOByteCount reportLength,
+                                 UInt32 start, UInt32 size, SInt32 value)
+{
+    SInt32  data;
+    SInt32  shiftedData;
+    UInt32  startByte   = start / 8;
+    UInt32  startBit    = start & 7;
+    UInt32  lastByte    = (start + size - 1) / 8;
+    UInt32  startMask;
+    UInt32  lastMask;
+    UInt32  dataMask;
+
+    if ((size == 0) || (lastByte >= reportLength)) {
+        return kHIDBadParameterErr;
+    }
+
+    lastMask    = ~((1U << (((start + size - 1) & 7) + 1)) - 1);
+    startMask   = (1U << startBit) - 1;
+    shiftedData = (SInt32)((UInt32)value << startBit);
+
+    if (startByte == lastByte) {
+        dataMask = startMask | lastMask;
+        data = (report[startByte] & dataMask) | (shiftedData & ~dataMask);
+    } else {
+        data = (report[startByte] & startMask) | shiftedData;
+        report[startByte] = (uint8_t)data;
+        shiftedData >>= 8;
+
+        while (++startByte < lastByte) {
+            report[startByte] = (uint8_t)shiftedData;
+            shiftedData >>= 8;
+        }
+
+        data = (report[lastByte] & lastMask) | (shiftedData & ~lastMask);
+    }
+
+    report[startByte] = (uint8_t)data;
+    return kHIDSuccess;
+}
+
+#define kCheckFieldsMaxLength   20
+#define kCheckFieldsMaxSize     32
+#define kCheckFieldsMaxReports  10
+
+static bool checkFields(void)
+{
+    static const SInt32 values[] = { 0, 1, -1, 0x12345678, 0x5a5a5a5a, (SInt32)0xa5a5a5a5, INT32_MAX, INT32_MIN };
+    uint8_t             patterns[3][kCheckFieldsMaxLength];
+    uint8_t             expected[kCheckFieldsMaxLength];
+    uint64_t            cases       = 0;
+    uint64_t            mismatches  = 0;
+    uint32_t            seed        = 1;
+
+    memset(patterns[0], 0x00, sizeof(patterns[0]));
+    memset(patterns[1], 0xff, sizeof(patterns[1]));
+    for (size_t i = 0; i < sizeof(patterns[2]); i++) {
+        seed = seed * 1103515245 + 12345;
+        patterns[2][i] = (uint8_t)(seed >> 16);
+    }
+
+    for (IOByteCount length = 1; length <= kCheckFieldsMaxLength; length++) {
+        for (UInt32 start = 0; start < length * 8 + 8; start++) {
+            for (UInt32 size = 0; size <= kCheckFieldsMaxSize; size++) {
+                for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+                    uint8_t *   report = malloc(length);
+                    OSStatus    status;
+                    OSStatus    expectedStatus;
+
+                    if (!report) {
+                        return false;
+                    }
+
+                    for (int signExtend = 0; signExtend <= 1; signExtend++) {
+                        SInt32 value            = 0x3c3c3c3c;
+                        SInt32 expectedValue    = 0x3c3c3c3c;
+
+                        memcpy(report, patterns[p], length);
+                        status = HIDGetData(report, length, start, size, &value, signExtend);
+                        expectedStatus = referenceGetData(report, length, start, size, &expectedValue, signExtend);
+
+                        cases++;
+                        if (status != expectedStatus || value != expectedValue) {
+                            if (mismatches++ < kCheckFieldsMaxReports) {
+                                printf("HIDGetData length %u start %u size %u sign %d: %d/%#x, expected %d/%#x\n",
+                                       (unsigned)length, (unsigned)start, (unsigned)size, signExtend,
+                                       (int)status, (unsigned)value, (int)expectedStatus, (unsigned)expectedValue);
+                            }
+                        }
+                    }
+
+                    for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+                        memcpy(report, patterns[p], length);
+                        memcpy(expected, patterns[p], length);
+                        status = HIDPutData(report, length, start, size, values[v]);
+                        expectedStatus = referencePutData(expected, length, start, size, values[v]);
+
+                        cases++;
+                        if (status != expectedStatus || memcmp(report, expected, length)) {
+                            if (mismatches++ < kCheckFieldsMaxReports) {
+                                printf("HIDPutData length %u start %u size %u value %#x: status %d, expected %d\n",
+                                       (unsigned)length, (unsigned)start, (unsigned)size, (unsigned)values[v],
+                                       (int)status, (int)expectedStatus);
+                            }
+                        }
+                    }
+
+                    free(report);
+                }
+            }
+        }
+    }
+
+    printf("checked %llu field cases, %llu mismatches\n",
+           (unsigned long long)cases, (unsigned long long)mismatches);
+
+    return mismatches == 0;
+}
+
+static void usage(void)
+{
+    printf("Usage:\n");
+    printf("  hidParserFuzz [--bench <seconds>] <input> ...\n");
+    printf("  hidParserFuzz --check-fields [<input> ...]\n\n");
+    printf("Runs every input through the fuzz target once. With --bench, also\n");
+    printf("reports descriptor parse, image open, input report decode, scaled\n");
+    printf("value and usage list difference throughput. With --check-fields,\n");
+    printf("compares HIDGetData and HIDPutData against the byte-wise reference.\n");
+}
+
+int main(int argc, const char *argv[])
+{
+    FuzzInput * inputs  = NULL;
+    int         count   = 0;
+    double      bench   = 0;
+    bool        fields  = false;
+    int         result  = EXIT_FAILURE;
+
+    inputs = calloc(argc, sizeof(FuzzInput));
+    if (!inputs) {
+        return EXIT_FAILURE;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--bench") && i + 1 < argc) {
+            bench = strtod(argv[++i], NULL);
+        } else if (!strcmp(argv[i], "--check-fields")) {
+            fields = true;
+        } else if (argv[i][0] == '-') {
+            usage();
+            goto exit;
+        } else if (loadInput(argv[i], &inputs[count])) {
+            count++;
+        } else {
+            goto exit;
+        }
+    }
+
+    if (!count && !fields) {
+        usage();
+        goto exit;
+    }
+
+    if (fields && !checkFields()) {
+        goto exit;
+    }
+
+    if (count) {
+        for (int i = 0; i < count; i++) {
+            LLVMFuzzerTestOneInput(inputs[i].bytes, inputs[i].length);
+        }
+        printf("ran %d inputs\n", count);
+    }
+
+    if (bench > 0) {
+        benchDescriptors(inputs, count, bench);
+        benchUsageListDifference(bench);
+    }
+
+    result = EXIT_SUCCESS;
+
+exit:
+    for (int i = 0; i < count; i++) {
+        free(inputs[i].bytes);
+    }
+    free(inputs);
+    return result;
+}
+
+#endif /* !HID_PARSER_FUZZ_LIBFUZZER */
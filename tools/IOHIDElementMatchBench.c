@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2024 Apple Inc. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ *
+ * The contents of this file constitute Original Code as defined in and
+ * are subject to the Apple Public Source License Version 1.1 (the
+ * "License").  You may not use this file except in compliance with the
+ * License.  Please obtain a copy of the License at
+ * http://www.apple.com/publicsource and read it before using this file.
+ *
+ * This Original Code and all software distributed under the License are
+ * distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE OR NON-INFRINGEMENT.  Please see the
+ * License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+/*
+ * hidElementMatchBench creates a virtual HID device with 2,000 vendor elements
+ * and times copyMatchingElements through the IOHIDLib device interface, once
+ * with the element indexes and once with kHIDCopyMatchingElementsNoIndex,
+ * which filters with predicates only. Each matching dictionary has to give
+ * the same elements, in the same order, on both paths; the tool exits non-zero
+ * if they differ.
+ *
+ * Build:
+ *
+ *     clang -O2 -framework IOKit -framework CoreFoundation \
+ *         tools/IOHIDElementMatchBench.c -o hidElementMatchBench
+ *     ./hidElementMatchBench [seconds per case]
+ *
+ * Creating the virtual device needs the IOHIDUserDevice entitlement, see
+ * IOHIDUserDeviceTest-Entitlements.plist.
+ */
+
+#include <CoreFoundation/CoreFoundation.h>
+#include <IOKit/IOKitLib.h>
+#include <IOKit/IOCFPlugIn.h>
+#include <IOKit/hid/IOHIDDevicePlugIn.h>
+#include <IOKit/hid/IOHIDElement.h>
+#include <IOKit/hid/IOHIDUserDevice.h>
+#include <IOKit/hid/IOHIDKeys.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <AssertMacros.h>
+
+// Must match kHIDCopyMatchingElementsNoIndex in IOHIDLib/IOHIDDeviceClass.h
+#define kBenchNoIndexOption     0x2
+
+#define kBenchElementCount      2000
+#define kBenchUsagePage         0xFF00
+#define kBenchMatchTimeoutUS    (5 * 1000000)
+
+static uint8_t gDescriptor[] = {
+    0x06, 0x00, 0xFF,                         // Usage Page (Vendor Defined 0xFF00)
+    0x09, 0x01,                               // Usage (1)
+    0xA1, 0x01,                               // Collection (Application)
+    0x1A, 0x01, 0x00,                         //   Usage Minimum........... (1)
+    0x2A, kBenchElementCount & 0xFF,          //   Usage Maximum........... (2000)
+          kBenchElementCount >> 8,
+    0x15, 0x00,                               //   Logical Minimum......... (0)
+    0x25, 0x01,                               //   Logical Maximum......... (1)
+    0x75, 0x01,                               //   Report Size............. (1)
+    0x96, kBenchElementCount & 0xFF,          //   Report Count............ (2000)
+          kBenchElementCount >> 8,
+    0x81, 0x02,                               //   Input...................(Data, Variable, Absolute)
+    0xC0,                                     // End Collection
+};
+
+static uint64_t nowNS(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void setMatchingValue(CFMutableDictionaryRef matching, const char * key, uint32_t value)
+{
+    CFStringRef keyString   = CFStringCreateWithCString(kCFAllocatorDefault, key, kCFStringEncodingUTF8);
+    CFNumberRef number      = CFNumberCreate(kCFAllocatorDefault, kCFNumberSInt32Type, &value);
+
+    if (keyString && number) {
+        CFDictionarySetValue(matching, keyString, number);
+    }
+
+    if (keyString) {
+        CFRelease(keyString);
+    }
+    if (number) {
+        CFRelease(number);
+    }
+}
+
+static CFDictionaryRef createMatching(const char * key1, uint32_t value1,
+                                      const char * key2, uint32_t value2)
+{
+    CFMutableDictionaryRef matching;
+
+    matching = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+    if (!matching) {
+        return NULL;
+    }
+
+    setMatchingValue(matching, key1, value1);
+    if (key2) {
+        setMatchingValue(matching, key2, value2);
+    }
+
+    return matching;
+}
+
+static double benchMatching(IOHIDDeviceDeviceInterface ** device,
+                            CFDictionaryRef matching,
+                            IOOptionBits options,
+                            uint64_t budget)
+{
+    uint64_t    start   = nowNS();
+    uint64_t    elapsed = 0;
+    uint64_t    calls   = 0;
+
+    do {
+        CFArrayRef elements = NULL;
+
+        (*device)->copyMatchingElements(device, matching, &elements, options);
+        if (elements) {
+            CFRelease(elements);
+        }
+        calls++;
+        elapsed = nowNS() - start;
+    } while (elapsed < budget);
+
+    return (double)elapsed / calls;
+}
+
+static bool runCase(IOHIDDeviceDeviceInterface ** device,
+                    const char * name,
+                    CFDictionaryRef matching,
+                    uint64_t budget)
+{
+    CFArrayRef  indexed     = NULL;
+    CFArrayRef  predicate   = NULL;
+    double      indexedNS;
+    double      predicateNS;
+    bool        result      = false;
+
+    require(matching, exit);
+
+    (*device)->copyMatchingElements(device, matching, &indexed, 0);
+    (*device)->copyMatchingElements(device, matching, &predicate, kBenchNoIndexOption);
+
+    // Both paths return the device's own element refs, so the arrays compare directly
+    if (!(indexed == predicate || (indexed && predicate && CFEqual(indexed, predicate)))) {
+        fprintf(stderr, "%s: indexed path returned %ld elements, predicate path %ld\n",
+                name,
+                indexed ? CFArrayGetCount(indexed) : 0,
+                predicate ? CFArrayGetCount(predicate) : 0);
+        goto exit;
+    }
+
+    indexedNS = benchMatching(device, matching, 0, budget);
+    predicateNS = benchMatching(device, matching, kBenchNoIndexOption, budget);
+
+    printf("%-24s %5ld elements  indexed %10.0f ns  predicate %10.0f ns  %6.1fx\n",
+           name,
+           indexed ? CFArrayGetCount(indexed) : 0,
+           indexedNS,
+           predicateNS,
+           predicateNS / indexedNS);
+
+    result = true;
+
+exit:
+    if (indexed) {
+        CFRelease(indexed);
+    }
+    if (predicate) {
+        CFRelease(predicate);
+    }
+    if (matching) {
+        CFRelease(matching);
+    }
+    return result;
+}
+
+static io_service_t copyDeviceService(CFStringRef serial)
+{
+    uint64_t start = nowNS();
+
+    // The user device registers asynchronously, so poll until it shows up
+    do {
+        CFMutableDictionaryRef  matching    = IOServiceMatching(kIOHIDDeviceKey);
+        CFMutableDictionaryRef  properties  = NULL;
+        io_service_t            service;
+
+        if (!matching) {
+            return IO_OBJECT_NULL;
+        }
+
+        properties = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+        if (!properties) {
+            CFRelease(matching);
+            return IO_OBJECT_NULL;
+        }
+
+        CFDictionarySetValue(properties, CFSTR(kIOHIDSerialNumberKey), serial);
+        CFDictionarySetValue(matching, CFSTR(kIOPropertyMatchKey), properties);
+        CFRelease(properties);
+
+        service = IOServiceGetMatchingService(kIOMainPortDefault, matching);
+        if (service) {
+            return service;
+        }
+
+        usleep(10000);
+    } while (nowNS() - start < kBenchMatchTimeoutUS * 1000ull);
+
+    return IO_OBJECT_NULL;
+}
+
+int main(int argc, const char * argv[])
+{
+    CFMutableDictionaryRef          properties  = NULL;
+    CFDataRef                       descriptor  = NULL;
+    CFStringRef                     serial      = NULL;
+    IOHIDUserDeviceRef              userDevice  = NULL;
+    io_service_t                    service     = IO_OBJECT_NULL;
+    IOCFPlugInInterface **          plugin      = NULL;
+    IOHIDDeviceDeviceInterface **   device      = NULL;
+    CFArrayRef                      elements    = NULL;
+    uint32_t                        cookie;
+    SInt32                          score;
+    uint64_t                        budget;
+    bool                            ok          = true;
+    int                             result      = 1;
+
+    budget = (uint64_t)((argc > 1 ? atof(argv[1]) : 1.0) * 1000000000.0);
+
+    properties = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+    require(properties, exit);
+
+    descriptor = CFDataCreate(kCFAllocatorDefault, gDescriptor, sizeof(gDescriptor));
+    require(descriptor, exit);
+
+    // A serial number unique to this process finds only our device
+    serial = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("hidElementMatchBench-%d"), getpid());
+    require(serial, exit);
+
+    CFDictionarySetValue(properties, CFSTR(kIOHIDReportDescriptorKey), descriptor);
+    CFDictionarySetValue(properties, CFSTR(kIOHIDSerialNumberKey), serial);
+
+    userDevice = IOHIDUserDeviceCreate(kCFAllocatorDefault, properties);
+    require_action(userDevice, exit, fprintf(stderr, "Unable to create user device\n"));
+
+    service = copyDeviceService(serial);
+    require_action(service, exit, fprintf(stderr, "Virtual device never matched\n"));
+
+    require_noerr_action(IOCreatePlugInInterfaceForService(service, kIOHIDDeviceTypeID, kIOCFPlugInInterfaceID, &plugin, &score),
+                         exit,
+                         fprintf(stderr, "Unable to create plugin\n"));
+
+    require_noerr_action((*plugin)->QueryInterface(plugin, CFUUIDGetUUIDBytes(kIOHIDDeviceDeviceInterfaceID), (LPVOID *)&device),
+                         exit,
+                         fprintf(stderr, "Unable to get device interface\n"));
+
+    (*device)->copyMatchingElements(device, NULL, &elements, 0);
+    require_action(elements && CFArrayGetCount(elements), exit, fprintf(stderr, "Device has no elements\n"));
+
+    // Pick an element in the middle so the predicate path can't stop early
+    cookie = (uint32_t)IOHIDElementGetCookie((IOHIDElementRef)CFArrayGetValueAtIndex(elements, CFArrayGetCount(elements) / 2));
+
+    printf("%ld elements, %.2fs per case\n", CFArrayGetCount(elements), budget / 1e9);
+
+    ok &= runCase(device, "cookie",
+                  createMatching(kIOHIDElementCookieKey, cookie, NULL, 0),
+                  budget);
+    ok &= runCase(device, "usage page + usage",
+                  createMatching(kIOHIDElementUsagePageKey, kBenchUsagePage, kIOHIDElementUsageKey, kBenchElementCount / 2),
+                  budget);
+    ok &= runCase(device, "cookie range",
+                  createMatching(kIOHIDElementCookieMinKey, cookie, kIOHIDElementCookieMaxKey, cookie + 15),
+                  budget);
+    ok &= runCase(device, "usage page",
+                  createMatching(kIOHIDElementUsagePageKey, kBenchUsagePage, NULL, 0),
+                  budget);
+
+    result = ok ? 0 : 1;
+
+exit:
+    if (elements) {
+        CFRelease(elements);
+    }
+    if (device) {
+        (*device)->Release(device);
+    }
+    if (plugin) {
+        IODestroyPlugInInterface(plugin);
+    }
+    if (service) {
+        IOObjectRelease(service);
+    }
+    if (userDevice) {
+        CFRelease(userDevice);
+    }
+    if (serial) {
+        CFRelease(serial);
+    }
+    if (descriptor) {
+        CFRelease(descriptor);
+    }
+    if (properties) {
+        CFRelease(properties);
+    }
+    return result;
+}
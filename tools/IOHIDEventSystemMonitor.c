@@ -23,6 +23,7 @@
 //#include <IOKit/hid/AppleHIDUsageTables.h>
 #include "AppleHIDUsageTables.h"
 #include "IOHIDNXEventDescription.h"
+#include "IOHIDUsageNames.h"
 #include <os/variant_private.h>
 
 static const char kAdded[]      = "ADDED";
@@ -130,6 +131,48 @@ void printNXEvents (IOHIDEventRef event) {
   }
 }
 
+static bool getUsageName(uint32_t usagePage, uint32_t usage, char * name, size_t length)
+{
+    const char * pageName   = IOHIDUsagePageName(usagePage);
+    const char * usageName  = IOHIDUsageName(usagePage, usage);
+    const char * prefix     = IOHIDUsageNameGeneratedPrefix(usagePage, usage);
+
+    if ( !pageName )
+        return false;
+
+    if ( usageName )
+        snprintf(name, length, "%s: %s", pageName, usageName);
+    else if ( prefix )
+        snprintf(name, length, "%s: %s %u", pageName, prefix, usage);
+    else
+        snprintf(name, length, "%s", pageName);
+
+    return true;
+}
+
+static void printEventUsageName(IOHIDEventRef event)
+{
+    uint32_t    usagePage;
+    uint32_t    usage;
+    char        name[256];
+
+    switch ( IOHIDEventGetType(event) ) {
+        case kIOHIDEventTypeKeyboard:
+            usagePage   = (uint32_t)IOHIDEventGetIntegerValue(event, kIOHIDEventFieldKeyboardUsagePage);
+            usage       = (uint32_t)IOHIDEventGetIntegerValue(event, kIOHIDEventFieldKeyboardUsage);
+            break;
+        case kIOHIDEventTypeVendorDefined:
+            usagePage   = (uint32_t)IOHIDEventGetIntegerValue(event, kIOHIDEventFieldVendorDefinedUsagePage);
+            usage       = (uint32_t)IOHIDEventGetIntegerValue(event, kIOHIDEventFieldVendorDefinedUsage);
+            break;
+        default:
+            return;
+    }
+
+    if ( getUsageName(usagePage, usage, name, sizeof(name)) )
+        printf("UsageName:               %s\n", name);
+}
+
 IOHIDEventBlock eventBlock = ^(void * target __unused, void * refcon, void * sender __unused, IOHIDEventRef event)
 {
     IOHIDEventType  type        = IOHIDEventGetType(event);
@@ -175,6 +218,7 @@ IOHIDEventBlock eventBlock = ^(void * target __unused, void * refcon, void * sen
                 printf("<filter>\n");
             printf("*** %lld us since last %s event ***\n", interval, IOHIDEventGetTypeString(IOHIDEventGetType(event)));
             printf("%s", CFStringGetCStringPtr(outputString, kCFStringEncodingMacRoman));
+            printEventUsageName(event);
             if (refcon)
                 printf("</filter>\n");
 
@@ -573,6 +617,24 @@ static void printDictionaryValue(CFStringRef key, CFDictionaryRef dictionary, CF
     }
 }
 
+static void printServiceUsageName(CFDictionaryRef serviceRecord)
+{
+    CFNumberRef usagePageNumber = (CFNumberRef)CFDictionaryGetValue(serviceRecord, CFSTR(kIOHIDServicePrimaryUsagePageKey));
+    CFNumberRef usageNumber     = (CFNumberRef)CFDictionaryGetValue(serviceRecord, CFSTR(kIOHIDServicePrimaryUsageKey));
+    uint32_t    usagePage       = 0;
+    uint32_t    usage           = 0;
+    char        name[256];
+
+    if ( !usagePageNumber || !usageNumber || CFGetTypeID(usagePageNumber) != CFNumberGetTypeID() || CFGetTypeID(usageNumber) != CFNumberGetTypeID() )
+        return;
+
+    CFNumberGetValue(usagePageNumber, kCFNumberSInt32Type, &usagePage);
+    CFNumberGetValue(usageNumber, kCFNumberSInt32Type, &usage);
+
+    if ( getUsageName(usagePage, usage, name, sizeof(name)) )
+        printf("(%s) ", name);
+}
+
 static void listServices(CFArrayRef services, CFIndex indentationLevel)
 {
     static CFStringRef sServiceKeys[] = {CFSTR(kIOHIDServiceRegistryIDKey), CFSTR(kIOHIDServiceRegistryNameKey), CFSTR(kIOHIDBuiltInKey), CFSTR(kIOHIDDisplayIntegratedKey), CFSTR(kIOHIDServicePrimaryUsagePageKey), CFSTR(kIOHIDServicePrimaryUsageKey), CFSTR(kIOHIDServiceReportIntervalKey), CFSTR(kIOHIDServiceSampleIntervalKey), CFSTR(kIOHIDServiceNextEventTimeStampDeltaKey), CFSTR(kIOHIDCategoryKey), CFSTR(kIOHIDServiceTransportKey), CFSTR(kIOHIDServiceBatchIntervalKey)};
@@ -603,6 +665,9 @@ static void listServices(CFArrayRef services, CFIndex indentationLevel)
                 printNumberValue(key, (CFNumberRef)value, indentationLevel, false);
             else if ( CFGetTypeID(value) == CFBooleanGetTypeID() )
                 printBooleanValue(key, (CFBooleanRef)value, indentationLevel, false);
+
+            if ( CFEqual(key, CFSTR(kIOHIDServicePrimaryUsageKey)) )
+                printServiceUsageName(serviceRecord);
         }
     }
 }
@@ -791,7 +856,12 @@ static void runClient()
                         CFDictionaryAddValue(matching, CFSTR(kIOHIDBuiltInKey), kCFBooleanTrue);
                     }
                     
-                    printf("Matching on UsagePage=%#x Usage=%#x Built-in=%#x\n", __matching[index].usagePage, __matching[index].usage, __matching[index].builtin);
+                    char name[256];
+
+                    printf("Matching on UsagePage=%#x Usage=%#x Built-in=%#x", __matching[index].usagePage, __matching[index].usage, __matching[index].builtin);
+                    if ( getUsageName(__matching[index].usagePage, __matching[index].usage, name, sizeof(name)) )
+                        printf(" (%s)", name);
+                    printf("\n");
                     
                     CFArrayAppendValue(multiple, matching);
                     CFRelease(matching);
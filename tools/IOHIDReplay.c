@@ -0,0 +1,741 @@
+/*
+ * Copyright (c) 2024 Apple Inc. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ *
+ * The contents of this file constitute Original Code as defined in and
+ * are subject to the Apple Public Source License Version 1.1 (the
+ * "License").  You may not use this file except in compliance with the
+ * License.  Please obtain a copy of the License at
+ * http://www.apple.com/publicsource and read it before using this file.
+ *
+ * This Original Code and all software distributed under the License are
+ * distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE OR NON-INFRINGEMENT.  Please see the
+ * License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+/*
+ * hidReplay replays a recorded report capture through a virtual HID device and
+ * reports end-to-end delivery latency and drops, as seen by an IOHIDManager
+ * client in the same process.
+ *
+ * Capture format (text, one entry per line):
+ *
+ *     # comment
+ *     descriptor 05 01 09 02 a1 01 ...
+ *     <timestamp in us> <report bytes in hex>
+ *
+ * Report timestamps are relative; only the spacing between them is replayed,
+ * scaled by --speed. Building with HID_REPLAY_MOCK_TRANSPORT (the default
+ * off Apple platforms) replaces IOHIDUserDevice/IOHIDManager with a mock
+ * transport that feeds every report through the descriptor parser, so the
+ * capture handling and element/report core can run on any host.
+ */
+
+#if !defined(__APPLE__) && !defined(HID_REPLAY_MOCK_TRANSPORT)
+#define HID_REPLAY_MOCK_TRANSPORT 1
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#if HID_REPLAY_MOCK_TRANSPORT
+#include <IOKit/hidsystem/IOHIDDescriptorParser.h>
+#else
+#include <CoreFoundation/CoreFoundation.h>
+#include <IOKit/hid/IOHIDUserDevice.h>
+#include <IOKit/hid/IOHIDManager.h>
+#include <IOKit/hid/IOHIDKeys.h>
+#include <AssertMacros.h>
+#include <os/variant_private.h>
+#endif
+
+#ifndef __unused
+#define __unused __attribute__((unused))
+#endif
+
+#define kReplayMatchWindow      64
+#define kReplayDrainTimeoutNS   1000000000ULL
+#define kReplayMatchTimeoutNS   5000000000ULL
+
+typedef struct {
+    uint64_t    timestamp;      // capture time, us
+    uint32_t    length;
+    uint8_t *   bytes;
+} ReplayReport;
+
+typedef struct {
+    uint8_t *       descriptor;
+    uint32_t        descriptorLength;
+    ReplayReport *  reports;
+    uint32_t        reportCount;
+    uint32_t        reportCapacity;
+} ReplayCapture;
+
+typedef struct {
+    pthread_mutex_t lock;
+    uint64_t *      sendTimes;      // ns, one per sent report
+    uint32_t *      sendReports;    // capture index, one per sent report
+    uint64_t *      latencies;      // ns, one per matched report
+    uint32_t        matched;
+    uint32_t        sent;
+    uint32_t        failed;         // transport refused the report
+    uint32_t        unmatched;      // received but never sent
+    uint32_t        cursor;         // next report expected by the receiver
+} ReplayStats;
+
+static ReplayCapture    gCapture        = {};
+static ReplayStats      gStats          = { .lock = PTHREAD_MUTEX_INITIALIZER };
+static double           gSpeed          = 1.0;
+static uint32_t         gLoops          = 1;
+static bool             gVerbose        = false;
+
+static uint64_t nowNS(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void sleepUntilNS(uint64_t deadline)
+{
+    uint64_t now;
+
+    while ((now = nowNS()) < deadline) {
+        uint64_t delta = deadline - now;
+        struct timespec ts = {
+            .tv_sec = (time_t)(delta / 1000000000ULL),
+            .tv_nsec = (long)(delta % 1000000000ULL)
+        };
+
+        nanosleep(&ts, NULL);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Capture parsing
+//------------------------------------------------------------------------------
+
+static uint32_t parseHexBytes(const char * str, uint8_t ** pBytes)
+{
+    size_t      capacity    = strlen(str) / 2 + 1;
+    uint8_t *   bytes       = malloc(capacity);
+    uint32_t    length      = 0;
+
+    while (bytes && *str) {
+        char * end;
+        unsigned long value;
+
+        while (*str && isspace((unsigned char)*str)) {
+            str++;
+        }
+        if (!*str) {
+            break;
+        }
+
+        value = strtoul(str, &end, 16);
+        if (end == str || value > 0xff || length >= capacity) {
+            break;
+        }
+
+        bytes[length++] = (uint8_t)value;
+        str = end;
+    }
+
+    *pBytes = bytes;
+    return length;
+}
+
+static bool loadCapture(const char * path, ReplayCapture * capture)
+{
+    FILE *      file    = fopen(path, "r");
+    char *      line    = NULL;
+    size_t      lineCap = 0;
+    uint32_t    lineNum = 0;
+    bool        result  = false;
+
+    if (!file) {
+        fprintf(stderr, "Unable to open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    while (getline(&line, &lineCap, file) > 0) {
+        char * str = line;
+
+        lineNum++;
+
+        while (*str && isspace((unsigned char)*str)) {
+            str++;
+        }
+
+        if (!*str || *str == '#') {
+            continue;
+        }
+
+        if (!strncmp(str, "descriptor", strlen("descriptor"))) {
+            free(capture->descriptor);
+            capture->descriptorLength = parseHexBytes(str + strlen("descriptor"), &capture->descriptor);
+            continue;
+        }
+
+        if (capture->reportCount == capture->reportCapacity) {
+            uint32_t capacity = capture->reportCapacity ? capture->reportCapacity * 2 : 256;
+            ReplayReport * reports = realloc(capture->reports, capacity * sizeof(ReplayReport));
+
+            if (!reports) {
+                fprintf(stderr, "Out of memory at line %u\n", lineNum);
+                goto exit;
+            }
+
+            capture->reports = reports;
+            capture->reportCapacity = capacity;
+        }
+
+        ReplayReport * report = &capture->reports[capture->reportCount];
+        char * end;
+
+        memset(report, 0, sizeof(*report));
+        report->timestamp = strtoull(str, &end, 10);
+        if (end == str) {
+            fprintf(stderr, "Malformed report at line %u\n", lineNum);
+            goto exit;
+        }
+
+        report->length = parseHexBytes(end, &report->bytes);
+        if (!report->length) {
+            fprintf(stderr, "Empty report at line %u\n", lineNum);
+            free(report->bytes);
+            goto exit;
+        }
+
+        capture->reportCount++;
+    }
+
+    if (!capture->descriptorLength) {
+        fprintf(stderr, "%s has no descriptor line\n", path);
+        goto exit;
+    }
+
+    if (!capture->reportCount) {
+        fprintf(stderr, "%s has no reports\n", path);
+        goto exit;
+    }
+
+    result = true;
+
+exit:
+    free(line);
+    fclose(file);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Delivery accounting
+//------------------------------------------------------------------------------
+
+static uint32_t findSentReport(uint32_t start, uint32_t limit, const uint8_t * report, uint32_t length)
+{
+    uint32_t index;
+
+    for (index = start; index < limit; index++) {
+        ReplayReport * sent = &gCapture.reports[gStats.sendReports[index]];
+
+        if (sent->length == length && !memcmp(sent->bytes, report, length)) {
+            break;
+        }
+    }
+
+    return index;
+}
+
+static void reportReceived(const uint8_t * report, uint32_t length)
+{
+    uint64_t now = nowNS();
+    uint32_t limit;
+    uint32_t index;
+
+    pthread_mutex_lock(&gStats.lock);
+
+    // Reports are delivered in order, so search forward from the last match.
+    // Anything skipped over was dropped.
+    limit = gStats.cursor + kReplayMatchWindow;
+    if (limit > gStats.sent) {
+        limit = gStats.sent;
+    }
+
+    index = findSentReport(gStats.cursor, limit, report, length);
+
+    // More than a window's worth of reports were dropped in a row. Look past
+    // the window for the oldest matching send and resync the cursor there,
+    // otherwise every report from here on would count as unmatched.
+    if (index == limit && limit < gStats.sent) {
+        limit = gStats.sent;
+        index = findSentReport(index, limit, report, length);
+    }
+
+    if (index < limit) {
+        gStats.latencies[gStats.matched++] = now - gStats.sendTimes[index];
+        gStats.cursor = index + 1;
+    } else {
+        gStats.unmatched++;
+    }
+
+    pthread_mutex_unlock(&gStats.lock);
+
+    if (gVerbose) {
+        printf("Received report: reportLength=%u: ", length);
+        for (uint32_t i = 0; i < length; i++) {
+            printf("%02x ", report[i]);
+        }
+        printf("\n");
+    }
+}
+
+static int compareLatency(const void * a, const void * b)
+{
+    uint64_t lhs = *(const uint64_t *)a;
+    uint64_t rhs = *(const uint64_t *)b;
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static uint64_t percentile(const uint64_t * sorted, uint32_t count, double pct)
+{
+    uint32_t index;
+
+    if (!count) {
+        return 0;
+    }
+
+    index = (uint32_t)((pct / 100.0) * (count - 1) + 0.5);
+    return sorted[index < count ? index : count - 1];
+}
+
+static void printStats(uint64_t elapsed)
+{
+    uint32_t matched;
+
+    pthread_mutex_lock(&gStats.lock);
+    matched = gStats.matched;
+    qsort(gStats.latencies, matched, sizeof(uint64_t), compareLatency);
+
+    printf("\n");
+    printf("Reports sent      : %u\n", gStats.sent);
+    printf("Reports delivered : %u\n", matched);
+    printf("Reports dropped   : %u\n", gStats.sent - matched);
+    printf("Send failures     : %u\n", gStats.failed);
+    printf("Unmatched reports : %u\n", gStats.unmatched);
+    printf("Replay time       : %.3f ms\n", elapsed / 1000000.0);
+    if (matched) {
+        printf("Latency (us)      : min %.1f p50 %.1f p90 %.1f p99 %.1f p99.9 %.1f max %.1f\n",
+               gStats.latencies[0] / 1000.0,
+               percentile(gStats.latencies, matched, 50) / 1000.0,
+               percentile(gStats.latencies, matched, 90) / 1000.0,
+               percentile(gStats.latencies, matched, 99) / 1000.0,
+               percentile(gStats.latencies, matched, 99.9) / 1000.0,
+               gStats.latencies[matched - 1] / 1000.0);
+    }
+    pthread_mutex_unlock(&gStats.lock);
+}
+
+//------------------------------------------------------------------------------
+// Transports
+//------------------------------------------------------------------------------
+
+#if HID_REPLAY_MOCK_TRANSPORT
+
+static HIDPreparsedDataRef  gPreparsedData  = NULL;
+static HIDValueCaps *       gValueCaps      = NULL;
+static UInt32               gValueCapsCount = 0;
+static HIDUsageAndPage *    gButtons        = NULL;
+static UInt32               gButtonsCount   = 0;
+
+static bool transportOpen(void)
+{
+    HIDCapabilities caps;
+
+    if (HIDOpenReportDescriptor(gCapture.descriptor, gCapture.descriptorLength, &gPreparsedData, 0) != kHIDSuccess) {
+        fprintf(stderr, "Unable to parse descriptor\n");
+        return false;
+    }
+
+    if (HIDGetCapabilities(gPreparsedData, &caps) != kHIDSuccess) {
+        return false;
+    }
+
+    gValueCapsCount = caps.numberInputValueCaps;
+    gValueCaps = calloc(gValueCapsCount + 1, sizeof(HIDValueCaps));
+    if (!gValueCaps || HIDGetValueCaps(kHIDInputReport, gValueCaps, &gValueCapsCount, gPreparsedData) != kHIDSuccess) {
+        gValueCapsCount = 0;
+    }
+
+    gButtonsCount = HIDMaxUsageListLength(kHIDInputReport, 0, gPreparsedData);
+    gButtons = calloc(gButtonsCount + 1, sizeof(HIDUsageAndPage));
+
+    return gButtons != NULL;
+}
+
+static void transportClose(void)
+{
+    if (gPreparsedData) {
+        HIDCloseReportDescriptor(gPreparsedData);
+    }
+    free(gValueCaps);
+    free(gButtons);
+}
+
+static bool transportSend(const uint8_t * report, uint32_t length)
+{
+    UInt32 buttonCount = gButtonsCount;
+
+    // Decode the report the same way an element consumer would, then hand
+    // it to the receiver as if it had come back through the stack.
+    for (UInt32 i = 0; i < gValueCapsCount; i++) {
+        SInt32 value;
+
+        if (gValueCaps[i].isRange) {
+            continue;
+        }
+
+        HIDGetUsageValue(kHIDInputReport,
+                         gValueCaps[i].usagePage,
+                         0,
+                         gValueCaps[i].u.notRange.usage,
+                         &value,
+                         gPreparsedData,
+                         (void *)report,
+                         length);
+    }
+
+    HIDGetButtons(kHIDInputReport, 0, gButtons, &buttonCount, gPreparsedData, (void *)report, length);
+
+    reportReceived(report, length);
+    return true;
+}
+
+static void transportRun(void * (*sender)(void *))
+{
+    sender(NULL);
+}
+
+static void transportStop(void)
+{
+}
+
+#else
+
+static IOHIDUserDeviceRef   gDevice         = NULL;
+static IOHIDManagerRef      gManager        = NULL;
+static CFRunLoopRef         gRunLoop        = NULL;
+static pthread_mutex_t      gMatchLock      = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t       gMatchCond      = PTHREAD_COND_INITIALIZER;
+static bool                 gMatched        = false;
+
+static void inputReportCallback(void * context __unused,
+                                IOReturn result __unused,
+                                void * sender __unused,
+                                IOHIDReportType type __unused,
+                                uint32_t reportID __unused,
+                                uint8_t * report,
+                                CFIndex reportLength)
+{
+    reportReceived(report, (uint32_t)reportLength);
+}
+
+static void deviceMatchingCallback(void * context __unused,
+                                   IOReturn result __unused,
+                                   void * sender __unused,
+                                   IOHIDDeviceRef device __unused)
+{
+    pthread_mutex_lock(&gMatchLock);
+    gMatched = true;
+    pthread_cond_signal(&gMatchCond);
+    pthread_mutex_unlock(&gMatchLock);
+}
+
+static bool transportOpen(void)
+{
+    CFMutableDictionaryRef  properties  = NULL;
+    CFMutableDictionaryRef  matching    = NULL;
+    CFDataRef               descriptor  = NULL;
+    CFStringRef             serial      = NULL;
+    IOReturn                ret;
+    bool                    result      = false;
+
+    gRunLoop = CFRunLoopGetCurrent();
+
+    properties = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+    require(properties, exit);
+
+    matching = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+    require(matching, exit);
+
+    descriptor = CFDataCreate(kCFAllocatorDefault, gCapture.descriptor, gCapture.descriptorLength);
+    require(descriptor, exit);
+
+    // A serial number unique to this process lets the manager find only our device
+    serial = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("hidReplay-%d"), getpid());
+    require(serial, exit);
+
+    CFDictionarySetValue(properties, CFSTR(kIOHIDReportDescriptorKey), descriptor);
+    CFDictionarySetValue(properties, CFSTR(kIOHIDSerialNumberKey), serial);
+    CFDictionarySetValue(matching, CFSTR(kIOHIDSerialNumberKey), serial);
+
+    gManager = IOHIDManagerCreate(kCFAllocatorDefault, kIOHIDManagerOptionNone);
+    require(gManager, exit);
+
+    IOHIDManagerSetDeviceMatching(gManager, matching);
+    IOHIDManagerRegisterDeviceMatchingCallback(gManager, deviceMatchingCallback, NULL);
+    IOHIDManagerRegisterInputReportCallback(gManager, inputReportCallback, NULL);
+    IOHIDManagerScheduleWithRunLoop(gManager, gRunLoop, kCFRunLoopDefaultMode);
+
+    ret = IOHIDManagerOpen(gManager, kIOHIDOptionsTypeNone);
+    require_action(ret == kIOReturnSuccess, exit, fprintf(stderr, "Unable to open manager: 0x%x\n", ret));
+
+    gDevice = IOHIDUserDeviceCreate(kCFAllocatorDefault, properties);
+    require_action(gDevice, exit, fprintf(stderr, "Unable to create user device\n"));
+
+    IOHIDUserDeviceScheduleWithRunLoop(gDevice, gRunLoop, kCFRunLoopDefaultMode);
+
+    result = true;
+
+exit:
+    if (properties) {
+        CFRelease(properties);
+    }
+    if (matching) {
+        CFRelease(matching);
+    }
+    if (descriptor) {
+        CFRelease(descriptor);
+    }
+    if (serial) {
+        CFRelease(serial);
+    }
+    return result;
+}
+
+static void transportClose(void)
+{
+    if (gDevice) {
+        IOHIDUserDeviceUnscheduleFromRunLoop(gDevice, gRunLoop, kCFRunLoopDefaultMode);
+        CFRelease(gDevice);
+    }
+
+    if (gManager) {
+        IOHIDManagerUnscheduleFromRunLoop(gManager, gRunLoop, kCFRunLoopDefaultMode);
+        IOHIDManagerClose(gManager, kIOHIDOptionsTypeNone);
+        CFRelease(gManager);
+    }
+}
+
+static bool transportSend(const uint8_t * report, uint32_t length)
+{
+    return IOHIDUserDeviceHandleReport(gDevice, (uint8_t *)report, length) == kIOReturnSuccess;
+}
+
+static void * transportSender(void * arg)
+{
+    void * (*sender)(void *) = (void * (*)(void *))arg;
+    struct timespec deadline;
+    bool matched;
+
+    // Don't start replaying until the manager has seen the device
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += kReplayMatchTimeoutNS / 1000000000ULL;
+
+    pthread_mutex_lock(&gMatchLock);
+    while (!gMatched) {
+        if (pthread_cond_timedwait(&gMatchCond, &gMatchLock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    matched = gMatched;
+    pthread_mutex_unlock(&gMatchLock);
+
+    if (matched) {
+        sender(NULL);
+    } else {
+        fprintf(stderr, "Timed out waiting for the device to match\n");
+    }
+
+    CFRunLoopStop(gRunLoop);
+    CFRunLoopWakeUp(gRunLoop);
+    return NULL;
+}
+
+static void transportRun(void * (*sender)(void *))
+{
+    pthread_t tid;
+
+    if (pthread_create(&tid, NULL, transportSender, (void *)sender)) {
+        return;
+    }
+
+    CFRunLoopRun();
+    pthread_join(tid, NULL);
+}
+
+static void transportStop(void)
+{
+    // Give in-flight reports a chance to arrive before the stats are taken
+    CFRunLoopRunInMode(kCFRunLoopDefaultMode, kReplayDrainTimeoutNS / 1000000000.0, false);
+}
+
+#endif /* HID_REPLAY_MOCK_TRANSPORT */
+
+//------------------------------------------------------------------------------
+// Replay
+//------------------------------------------------------------------------------
+
+static void * replayReports(void * arg __unused)
+{
+    uint64_t start = nowNS();
+    uint64_t loopOffset = 0;
+
+    for (uint32_t loop = 0; loop < gLoops; loop++) {
+        uint64_t firstTimestamp = gCapture.reports[0].timestamp;
+        uint64_t lastOffset = 0;
+
+        for (uint32_t i = 0; i < gCapture.reportCount; i++) {
+            ReplayReport * report = &gCapture.reports[i];
+            uint64_t offset = report->timestamp > firstTimestamp ? (report->timestamp - firstTimestamp) * 1000ULL : 0;
+
+            // A speed of 0 replays back to back
+            if (gSpeed > 0) {
+                sleepUntilNS(start + loopOffset + (uint64_t)(offset / gSpeed));
+            }
+            lastOffset = offset;
+
+            // Recorded before sending, since the receiver can run before
+            // transportSend returns
+            pthread_mutex_lock(&gStats.lock);
+            gStats.sendReports[gStats.sent] = i;
+            gStats.sendTimes[gStats.sent++] = nowNS();
+            pthread_mutex_unlock(&gStats.lock);
+
+            if (!transportSend(report->bytes, report->length)) {
+                // Never delivered, so take it back out of the sent reports
+                // rather than have it show up as a drop. Only this thread
+                // adds sends, so it is still the last one.
+                pthread_mutex_lock(&gStats.lock);
+                if (gStats.cursor < gStats.sent) {
+                    gStats.sent--;
+                }
+                gStats.failed++;
+                pthread_mutex_unlock(&gStats.lock);
+
+                if (gVerbose) {
+                    printf("Failed to send report %u\n", i);
+                }
+            }
+        }
+
+        if (gSpeed > 0) {
+            loopOffset += (uint64_t)(lastOffset / gSpeed);
+        }
+    }
+
+    return NULL;
+}
+
+static void printHelp(void)
+{
+    printf("\n");
+    printf("hidReplay usage:\n\n");
+    printf("\thidReplay [options] <capture file>\n\n");
+    printf("\t--speed <factor>\t: replay speed, 2 is twice as fast, 0 is back to back (default 1)\n");
+    printf("\t--loop  <count>\t\t: number of times to replay the capture (default 1)\n");
+    printf("\t-v\t\t\t: print every received report\n");
+#if HID_REPLAY_MOCK_TRANSPORT
+    printf("\n\tBuilt with the mock transport: reports are decoded by the descriptor parser in process.\n");
+#endif
+    printf("\n");
+}
+
+int main(int argc, const char * argv[])
+{
+    const char *    path    = NULL;
+    uint64_t        start;
+    uint64_t        elapsed;
+
+#if !HID_REPLAY_MOCK_TRANSPORT
+    if (!os_variant_allows_internal_security_policies(NULL)) {
+        return 0;
+    }
+#endif
+
+    for (int argi = 1; argi < argc; argi++) {
+        if (!strcmp("--speed", argv[argi]) && (argi + 1) < argc) {
+            gSpeed = strtod(argv[++argi], NULL);
+        } else if (!strcmp("--loop", argv[argi]) && (argi + 1) < argc) {
+            gLoops = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (!strcmp("-v", argv[argi])) {
+            gVerbose = true;
+        } else if (argv[argi][0] != '-') {
+            path = argv[argi];
+        } else {
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (!path || gSpeed < 0 || !gLoops) {
+        printHelp();
+        return 1;
+    }
+
+    if (!loadCapture(path, &gCapture)) {
+        return 1;
+    }
+
+    gStats.sendTimes = calloc((size_t)gCapture.reportCount * gLoops, sizeof(uint64_t));
+    gStats.sendReports = calloc((size_t)gCapture.reportCount * gLoops, sizeof(uint32_t));
+    gStats.latencies = calloc((size_t)gCapture.reportCount * gLoops, sizeof(uint64_t));
+    if (!gStats.sendTimes || !gStats.sendReports || !gStats.latencies) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    printf("Replaying %u reports x %u from %s at %.2fx\n", gCapture.reportCount, gLoops, path, gSpeed);
+
+    if (!transportOpen()) {
+        transportClose();
+        return 1;
+    }
+
+    start = nowNS();
+    transportRun(replayReports);
+    transportStop();
+    elapsed = nowNS() - start;
+
+    printStats(elapsed);
+
+    transportClose();
+
+    for (uint32_t i = 0; i < gCapture.reportCount; i++) {
+        free(gCapture.reports[i].bytes);
+    }
+    free(gCapture.reports);
+    free(gCapture.descriptor);
+    free(gStats.sendTimes);
+    free(gStats.sendReports);
+    free(gStats.latencies);
+
+    return gStats.matched == gStats.sent ? 0 : 2;
+}
@@ -4,19 +4,31 @@
 //
 //  Created by Rob Yepez on 2/23/13.
 //
+//  PrintHIDDescriptorJSON describes a descriptor as one line of JSON, for auditing
+//  descriptors in bulk. With IOHID_REPORT_DESCRIPTOR_PARSER_MAIN this file also builds
+//  a standalone batch tool, which needs nothing but a C compiler, on Linux as well:
+//
+//      cc -O2 -DIOHID_REPORT_DESCRIPTOR_PARSER_MAIN=1 -IIOHIDFamily
+//          tools/IOHIDReportDescriptorParser.c -o hidReportDescriptorParser
+//      hidReportDescriptorParser --json descriptors.txt
 //
 
 #include <string.h>
 #include <limits.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include <sys/types.h>
-#include <sys/sysctl.h>
+#if __has_include(<IOKit/hid/IOHIDUsageTables.h>)
 #include <IOKit/hid/IOHIDUsageTables.h>
+#else
+#include "IOHIDUsageTables.h"
+#endif
 #include "IOHIDReportDescriptorParser.h"
+#include "IOHIDUsageNames.h"
 
 #define    UnpackReportSize(packedByte)    ((packedByte) & 0x03)
 #define    UnpackReportType(packedByte)    (((packedByte) & 0x0C) >> 2)
@@ -125,6 +137,8 @@ void PrintHIDDescriptor(const uint8_t *reportDesc, uint32_t length)
     const uint8_t *         end = reportDesc + length;
     uint8_t                 size, type, tag;
     uint32_t                usagePage = 0;
+    uint32_t                namePage, nameUsage;
+    const char *            name;
     uint32_t                value=0;
     int32_t                 svalue=0;
     static unsigned char    buf[350], tempbuf[350], bufvalue[350], tempbufvalue[350];
@@ -316,36 +330,13 @@ void PrintHIDDescriptor(const uint8_t *reportDesc, uint32_t length)
                     strcat((char *)buf, "Usage Page ");
                     usagePage = value;
                     strcat((char *)bufvalue, (char *)"(");
-                    switch (usagePage)
-                    {
-                        case kHIDPage_GenericDesktop: sprintf((char *)tempbufvalue, "Generic Desktop"); break;
-                        case kHIDPage_Simulation: sprintf((char *)tempbufvalue, "Simulation Controls"); break;
-                        case kHIDPage_VR: sprintf((char *)tempbufvalue, "VR Controls"); break;
-                        case kHIDPage_Sport: sprintf((char *)tempbufvalue, "Sports Controls"); break;
-                        case kHIDPage_Game: sprintf((char *)tempbufvalue, "Game Controls"); break;
-                        case kHIDPage_KeyboardOrKeypad: sprintf((char *)tempbufvalue, "Keyboard/Keypad"); break;
-                        case kHIDPage_LEDs: sprintf((char *)tempbufvalue, "LED"); break;
-                        case kHIDPage_Button: sprintf((char *)tempbufvalue, "Button"); break;
-                        case kHIDPage_Ordinal: sprintf((char *)tempbufvalue, "Ordinal"); break;
-                        case kHIDPage_Telephony: sprintf((char *)tempbufvalue, "Telephony Device"); break;
-                        case kHIDPage_Consumer: sprintf((char *)tempbufvalue, "Consumer"); break;
-                        case kHIDPage_Digitizer: sprintf((char *)tempbufvalue, "Digitizer"); break;
-                        case kHIDPage_PID: sprintf((char *)tempbufvalue, "PID"); break;
-                        case kHIDPage_Unicode: sprintf((char *)tempbufvalue, "Unicode"); break;
-                        case kHIDPage_AlphanumericDisplay: sprintf((char *)tempbufvalue, "Alphanumeric Display"); break;
-                        case kHIDPage_Sensor: sprintf((char *)tempbufvalue, "Sensor"); break;
-                        case kHIDPage_Monitor: sprintf((char *)tempbufvalue, "Monitor"); break;
-                        case kHIDPage_MonitorEnumerated: sprintf((char *)tempbufvalue, "Monitor Enumerated Values"); break;
-                        case kHIDPage_MonitorVirtual: sprintf((char *)tempbufvalue, "VESA Virtual Controls"); break;
-                        case kHIDPage_MonitorReserved: sprintf((char *)tempbufvalue, "Monitor Class reserved"); break;
-                        case kHIDPage_PowerDevice: sprintf((char *)tempbufvalue, "Power Device"); break;
-                        case kHIDPage_BatterySystem: sprintf((char *)tempbufvalue, "Battery System"); break;
-                        case kHIDPage_PowerReserved: sprintf((char *)tempbufvalue, "Power Class reserved"); break;
-                        case kHIDPage_PowerReserved2: sprintf((char *)tempbufvalue, "Power Class reserved"); break;
-                        case 0xff: sprintf((char *)tempbufvalue, "Vendor Defined"); break;
-                            
-                        default: sprintf((char *)tempbufvalue, "%u", usagePage); break;
-                    }
+                    name = IOHIDUsagePageName(usagePage);
+                    if (name)
+                        sprintf((char *)tempbufvalue, "%s", name);
+                    else if (usagePage >= kHIDPage_VendorDefinedStart)
+                        sprintf((char *)tempbufvalue, "Vendor Defined");
+                    else
+                        sprintf((char *)tempbufvalue, "%u", usagePage);
                     
                     //strcat((char *)buf, (char *)tempbuf);
                     strcat((char *)bufvalue, (char *)tempbufvalue);
@@ -375,325 +366,17 @@ void PrintHIDDescriptor(const uint8_t *reportDesc, uint32_t length)
                 case kReport_TagUsage:
                     sprintf((char *)tempbuf, "Usage ");
                     strcat((char *)buf, (char *)tempbuf);
-                    if (usagePage == kHIDPage_GenericDesktop)
-                    {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case kHIDUsage_GD_Pointer: sprintf((char *)tempbuf, "Pointer"); break;
-                            case kHIDUsage_GD_Mouse: sprintf((char *)tempbuf, "Mouse"); break;
-                            case kHIDUsage_GD_Joystick: sprintf((char *)tempbuf, "Joystick"); break;
-                            case kHIDUsage_GD_GamePad: sprintf((char *)tempbuf, "GamePad"); break;
-                            case kHIDUsage_GD_Keyboard: sprintf((char *)tempbuf, "Keyboard"); break;
-                            case kHIDUsage_GD_Keypad: sprintf((char *)tempbuf, "Keypad"); break;
-                            case kHIDUsage_GD_MultiAxisController:  sprintf((char *)tempbuf, "MultiAxisController"); break;
-                                
-                            case kHIDUsage_GD_X: sprintf((char *)tempbuf, "X"); break;
-                            case kHIDUsage_GD_Y: sprintf((char *)tempbuf, "Y"); break;
-                            case kHIDUsage_GD_Z: sprintf((char *)tempbuf, "Z"); break;
-                            case kHIDUsage_GD_Rx: sprintf((char *)tempbuf, "Rx"); break;
-                            case kHIDUsage_GD_Ry: sprintf((char *)tempbuf, "Ry"); break;
-                            case kHIDUsage_GD_Rz: sprintf((char *)tempbuf, "Rz"); break;
-                            case kHIDUsage_GD_Slider: sprintf((char *)tempbuf, "Slider"); break;
-                            case kHIDUsage_GD_Dial: sprintf((char *)tempbuf, "Dial"); break;
-                            case kHIDUsage_GD_Wheel: sprintf((char *)tempbuf, "Wheel"); break;
-                            case kHIDUsage_GD_Hatswitch: sprintf((char *)tempbuf, "Hat Switch"); break;
-                            case kHIDUsage_GD_CountedBuffer: sprintf((char *)tempbuf, "Counted Buffer"); break;
-                            case kHIDUsage_GD_ByteCount: sprintf((char *)tempbuf, "Byte Count"); break;
-                            case kHIDUsage_GD_MotionWakeup: sprintf((char *)tempbuf, "Motion Wakeup"); break;
-                            case kHIDUsage_GD_Start: sprintf((char *)tempbuf, "Start"); break;
-                            case kHIDUsage_GD_Select: sprintf((char *)tempbuf, "Select"); break;
-                                
-                            case kHIDUsage_GD_Vx: sprintf((char *)tempbuf, "Vx"); break;
-                            case kHIDUsage_GD_Vy: sprintf((char *)tempbuf, "Vy"); break;
-                            case kHIDUsage_GD_Vz: sprintf((char *)tempbuf, "Vz"); break;
-                            case kHIDUsage_GD_Vbrx: sprintf((char *)tempbuf, "Vbrx"); break;
-                            case kHIDUsage_GD_Vbry: sprintf((char *)tempbuf, "Vbry"); break;
-                            case kHIDUsage_GD_Vbrz: sprintf((char *)tempbuf, "Vbrz"); break;
-                            case kHIDUsage_GD_Vno: sprintf((char *)tempbuf, "Vno"); break;
-                                
-                            case kHIDUsage_GD_SystemControl: sprintf((char *)tempbuf, "System Control"); break;
-                            case kHIDUsage_GD_SystemPowerDown: sprintf((char *)tempbuf, "System Power Down"); break;
-                            case kHIDUsage_GD_SystemSleep: sprintf((char *)tempbuf, "System Sleep"); break;
-                            case kHIDUsage_GD_SystemWakeUp: sprintf((char *)tempbuf, "System Wakeup"); break;
-                            case kHIDUsage_GD_SystemContextMenu: sprintf((char *)tempbuf, "System Context Menu"); break;
-                            case kHIDUsage_GD_SystemMainMenu: sprintf((char *)tempbuf, "System Main Menu"); break;
-                            case kHIDUsage_GD_SystemAppMenu: sprintf((char *)tempbuf, "System App Menu"); break;
-                            case kHIDUsage_GD_SystemMenuHelp: sprintf((char *)tempbuf, "System Menu Help"); break;
-                            case kHIDUsage_GD_SystemMenuExit: sprintf((char *)tempbuf, "System Menu Exit"); break;
-                            case kHIDUsage_GD_SystemMenuSelect: sprintf((char *)tempbuf, "System Menu Select"); break;
-                            case kHIDUsage_GD_SystemMenuRight: sprintf((char *)tempbuf, "System Menu Right"); break;
-                            case kHIDUsage_GD_SystemMenuLeft: sprintf((char *)tempbuf, "System Menu Left"); break;
-                            case kHIDUsage_GD_SystemMenuUp: sprintf((char *)tempbuf, "System Menu Up"); break;
-                            case kHIDUsage_GD_SystemMenuDown: sprintf((char *)tempbuf, "System Menu Down"); break;
-                                
-                            case kHIDUsage_GD_DPadUp: sprintf((char *)tempbuf, "D-Pad Up"); break;
-                            case kHIDUsage_GD_DPadDown: sprintf((char *)tempbuf, "D-Pad Down"); break;
-                            case kHIDUsage_GD_DPadRight: sprintf((char *)tempbuf, "D-Pad Right"); break;
-                            case kHIDUsage_GD_DPadLeft: sprintf((char *)tempbuf, "D-Pad Left"); break;
-                            case kHIDUsage_GD_IndexTrigger: sprintf((char *)tempbuf, "Index Trigger"); break;
-                            case kHIDUsage_GD_PalmTrigger: sprintf((char *)tempbuf, "Palm Trigger"); break;
-                            case kHIDUsage_GD_Thumbstick: sprintf((char *)tempbuf, "Thumbstick"); break;
-                            
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
-                    }
-                    else if (usagePage == kHIDPage_Telephony)
-                    {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case kHIDUsage_Tfon_Phone: sprintf((char *)tempbuf, "Phone"); break;
-                            case kHIDUsage_Tfon_Headset: sprintf((char *)tempbuf, "Headset"); break;
-                            case kHIDUsage_Tfon_HookSwitch: sprintf((char *)tempbuf, "Hook Switch"); break;
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
-                    }
-                    else if (usagePage == kHIDPage_Consumer)
-                    {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case kHIDUsage_Csmr_ConsumerControl: sprintf((char *)tempbuf, "Consumer Control"); break;
-                            case kHIDUsage_Csmr_Menu: sprintf((char *)tempbuf, "Menu"); break;
-                            case kHIDUsage_Csmr_Play: sprintf((char *)tempbuf, "Play"); break;
-                            case kHIDUsage_Csmr_Pause: sprintf((char *)tempbuf, "Pause"); break;
-                            case kHIDUsage_Csmr_FastForward: sprintf((char *)tempbuf, "Fast Forward"); break;
-                            case kHIDUsage_Csmr_Rewind: sprintf((char *)tempbuf, "Rewind"); break;
-                            case kHIDUsage_Csmr_ScanNextTrack: sprintf((char *)tempbuf, "Scan Next Track"); break;
-                            case kHIDUsage_Csmr_ScanPreviousTrack: sprintf((char *)tempbuf, "Scan Previous Track"); break;
-                            case kHIDUsage_Csmr_Stop: sprintf((char *)tempbuf, "Stop"); break;
-                            case kHIDUsage_Csmr_Eject: sprintf((char *)tempbuf, "Eject"); break;
-                            case kHIDUsage_Csmr_PlayOrPause: sprintf((char *)tempbuf, "Play or Pause"); break;
-                            case kHIDUsage_Csmr_Mute: sprintf((char *)tempbuf, "Mute"); break;
-                            case kHIDUsage_Csmr_VolumeIncrement: sprintf((char *)tempbuf, "Volume Increment"); break;
-                            case kHIDUsage_Csmr_VolumeDecrement: sprintf((char *)tempbuf, "Volume Decrement"); break;
-                            case kHIDUsage_Csmr_ACHome: sprintf((char *)tempbuf, "AC Home"); break;
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
-                    }
-                    else if (usagePage == kHIDPage_Digitizer)
+                    // 4 byte usages carry their own usage page
+                    namePage = (size == 4) ? (value >> 16) : usagePage;
+                    nameUsage = (size == 4) ? (value & 0xFFFF) : value;
+                    
+                    if ((name = IOHIDUsageName(namePage, nameUsage)))
                     {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case kHIDUsage_Dig_Digitizer: sprintf((char *)tempbuf, "Digitizer"); break;
-                            case kHIDUsage_Dig_Pen: sprintf((char *)tempbuf, "Pen"); break;
-                            case kHIDUsage_Dig_LightPen: sprintf((char *)tempbuf, "Light Pen"); break;
-                            case kHIDUsage_Dig_TouchScreen: sprintf((char *)tempbuf, "Touch Screen"); break;
-                            case kHIDUsage_Dig_TouchPad: sprintf((char *)tempbuf, "Touch Pad"); break;
-                            case kHIDUsage_Dig_WhiteBoard: sprintf((char *)tempbuf, "White Board"); break;
-                            case kHIDUsage_Dig_CoordinateMeasuringMachine: sprintf((char *)tempbuf, "Coordinate Measuring Machine"); break;
-                            case kHIDUsage_Dig_3DDigitizer: sprintf((char *)tempbuf, "3D Digitizer"); break;
-                            case kHIDUsage_Dig_StereoPlotter: sprintf((char *)tempbuf, "Stereo Plotter"); break;
-                            case kHIDUsage_Dig_ArticulatedArm: sprintf((char *)tempbuf, "Articulated Arm"); break;
-                            case kHIDUsage_Dig_Armature: sprintf((char *)tempbuf, "Armature"); break;
-                            case kHIDUsage_Dig_MultiplePointDigitizer: sprintf((char *)tempbuf, "Multi Point Digitizer"); break;
-                            case kHIDUsage_Dig_FreeSpaceWand: sprintf((char *)tempbuf, "Free Space Wand"); break;
-                            case kHIDUsage_Dig_DeviceConfiguration: sprintf((char *)tempbuf, "Device Configuration"); break;
-                            case kHIDUsage_Dig_Stylus: sprintf((char *)tempbuf, "Stylus"); break;
-                            case kHIDUsage_Dig_Puck: sprintf((char *)tempbuf, "Puck"); break;
-                            case kHIDUsage_Dig_Finger: sprintf((char *)tempbuf, "Finger"); break;
-                            case kHIDUsage_Dig_DeviceSettings: sprintf((char *)tempbuf, "Device Settings"); break;
-                            case kHIDUsage_Dig_GestureCharacter: sprintf((char *)tempbuf, "Gesture Character"); break;
-                            case kHIDUsage_Dig_TipPressure: sprintf((char *)tempbuf, "Tip Pressure"); break;
-                            case kHIDUsage_Dig_BarrelPressure: sprintf((char *)tempbuf, "Barrel Pressure"); break;
-                            case kHIDUsage_Dig_InRange: sprintf((char *)tempbuf, "In Range"); break;
-                            case kHIDUsage_Dig_Touch: sprintf((char *)tempbuf, "Touch"); break;
-                            case kHIDUsage_Dig_Untouch: sprintf((char *)tempbuf, "Untouch"); break;
-                            case kHIDUsage_Dig_Tap: sprintf((char *)tempbuf, "Tap"); break;
-                            case kHIDUsage_Dig_Quality: sprintf((char *)tempbuf, "Quality"); break;
-                            case kHIDUsage_Dig_DataValid: sprintf((char *)tempbuf, "Data Valid"); break;
-                            case kHIDUsage_Dig_TransducerIndex: sprintf((char *)tempbuf, "Transducer Index"); break;
-                            case kHIDUsage_Dig_TabletFunctionKeys: sprintf((char *)tempbuf, "Tablet Function Keys"); break;
-                            case kHIDUsage_Dig_ProgramChangeKeys: sprintf((char *)tempbuf, "Program Change Buttons"); break;
-                            case kHIDUsage_Dig_BatteryStrength: sprintf((char *)tempbuf, "Battery Strength"); break;
-                            case kHIDUsage_Dig_Invert: sprintf((char *)tempbuf, "Invert"); break;
-                            case kHIDUsage_Dig_XTilt: sprintf((char *)tempbuf, "X Tilt"); break;
-                            case kHIDUsage_Dig_YTilt: sprintf((char *)tempbuf, "Y Tilt"); break;
-                            case kHIDUsage_Dig_Azimuth: sprintf((char *)tempbuf, "Azimuth"); break;
-                            case kHIDUsage_Dig_Altitude: sprintf((char *)tempbuf, "Altitude"); break;
-                            case kHIDUsage_Dig_Twist: sprintf((char *)tempbuf, "Twist"); break;
-                            case kHIDUsage_Dig_TipSwitch: sprintf((char *)tempbuf, "Tip Switch"); break;
-                            case kHIDUsage_Dig_SecondaryTipSwitch: sprintf((char *)tempbuf, "Secondary Tip Switch"); break;
-                            case kHIDUsage_Dig_BarrelSwitch: sprintf((char *)tempbuf, "Barrel Switch"); break;
-                            case kHIDUsage_Dig_Eraser: sprintf((char *)tempbuf, "Eraser"); break;
-                            case kHIDUsage_Dig_TabletPick: sprintf((char *)tempbuf, "Tablet Pick"); break;
-                            case kHIDUsage_Dig_TouchValid: sprintf((char *)tempbuf, "Touch Valid"); break;
-                            case kHIDUsage_Dig_Width: sprintf((char *)tempbuf, "Width"); break;
-                            case kHIDUsage_Dig_Height: sprintf((char *)tempbuf, "Height"); break;
-                            case kHIDUsage_Dig_GestureCharacterEnable: sprintf((char *)tempbuf, "Gesture Character Enable"); break;
-                            case kHIDUsage_Dig_GestureCharacterQuality: sprintf((char *)tempbuf, "Gesture Character Quality"); break;
-                            case kHIDUsage_Dig_GestureCharacterDataLength: sprintf((char *)tempbuf, "Gesture Character Data Length"); break;
-                            case kHIDUsage_Dig_GestureCharacterData: sprintf((char *)tempbuf, "Gesture Character Data"); break;
-                            case kHIDUsage_Dig_GestureCharacterEncoding: sprintf((char *)tempbuf, "Gesture Character Encoding"); break;
-                            case kHIDUsage_Dig_GestureCharacterEncodingUTF8: sprintf((char *)tempbuf, "Gesture Character Encoding UTF8"); break;
-                            case kHIDUsage_Dig_GestureCharacterEncodingUTF16LE: sprintf((char *)tempbuf, "Gesture Character Encoding UTF16 Little Endian"); break;
-                            case kHIDUsage_Dig_GestureCharacterEncodingUTF16BE: sprintf((char *)tempbuf, "Gesture Character Encoding UTF16 Big Endian"); break;
-                            case kHIDUsage_Dig_GestureCharacterEncodingUTF32LE: sprintf((char *)tempbuf, "Gesture Character Encoding UTF32 Little Endian"); break;
-                            case kHIDUsage_Dig_GestureCharacterEncodingUTF32BE: sprintf((char *)tempbuf, "Gesture Character Encoding UTF32 Big Endian"); break;
-
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
+                        sprintf((char *)tempbuf, "(%s)", name);
                     }
-                    else if (usagePage == kHIDPage_LEDs)
+                    else if ((name = IOHIDUsageNameGeneratedPrefix(namePage, nameUsage)))
                     {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case 0x01: sprintf((char *)tempbuf, "Num Lock"); break;
-                            case 0x02: sprintf((char *)tempbuf, "Caps Lock"); break;
-                            case 0x03: sprintf((char *)tempbuf, "Scroll Lock"); break;
-                            case 0x4E: sprintf((char *)tempbuf, "Player Indicator"); break;
-                            case 0x4F: sprintf((char *)tempbuf, "Player 1"); break;
-                            case 0x50: sprintf((char *)tempbuf, "Player 2"); break;
-                            case 0x51: sprintf((char *)tempbuf, "Player 3"); break;
-                            case 0x52: sprintf((char *)tempbuf, "Player 4"); break;
-                            case 0x53: sprintf((char *)tempbuf, "Player 5"); break;
-                            case 0x54: sprintf((char *)tempbuf, "Player 6"); break;
-                            case 0x55: sprintf((char *)tempbuf, "Player 7"); break;
-                            case 0x56: sprintf((char *)tempbuf, "Player 8"); break;
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
-                    }
-                    else if (usagePage == kHIDPage_PID)
-                    {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case 1: sprintf((char *)tempbuf, "Physical Interface Device"); break;
-                            case 0x20: sprintf((char *)tempbuf, "Normal"); break;
-                            case 0x21: sprintf((char *)tempbuf, "Set Effect Report"); break;
-                            case 0x22: sprintf((char *)tempbuf, "Effect Block Index"); break;
-                            case 0x23: sprintf((char *)tempbuf, "Parameter Block Offset"); break;
-                            case 0x24: sprintf((char *)tempbuf, "ROM Flag"); break;
-                            case 0x25: sprintf((char *)tempbuf, "Effect Type"); break;
-                            case 0x26: sprintf((char *)tempbuf, "ET Constant Force"); break;
-                            case 0x27: sprintf((char *)tempbuf, "ET Ramp"); break;
-                            case 0x28: sprintf((char *)tempbuf, "ET Custom Force Data"); break;
-                            case 0x30: sprintf((char *)tempbuf, "ET Square"); break;
-                            case 0x31: sprintf((char *)tempbuf, "ET Sine"); break;
-                            case 0x32: sprintf((char *)tempbuf, "ET Triangle"); break;
-                            case 0x33: sprintf((char *)tempbuf, "ET Sawtooth Up"); break;
-                            case 0x34: sprintf((char *)tempbuf, "ET Sawtooth Down"); break;
-                            case 0x40: sprintf((char *)tempbuf, "ET Spring"); break;
-                            case 0x41: sprintf((char *)tempbuf, "ET Damper"); break;
-                            case 0x42: sprintf((char *)tempbuf, "ET Inertia"); break;
-                            case 0x43: sprintf((char *)tempbuf, "ET Friction"); break;
-                            case 0x50: sprintf((char *)tempbuf, "Duration"); break;
-                            case 0x51: sprintf((char *)tempbuf, "Sample Period"); break;
-                            case 0x52: sprintf((char *)tempbuf, "Gain"); break;
-                            case 0x53: sprintf((char *)tempbuf, "Trigger Button"); break;
-                            case 0x54: sprintf((char *)tempbuf, "Trigger Repeat Interval"); break;
-                            case 0x55: sprintf((char *)tempbuf, "Axes Enable"); break;
-                            case 0x56: sprintf((char *)tempbuf, "Direction Enable"); break;
-                            case 0x57: sprintf((char *)tempbuf, "Direction"); break;
-                            case 0x58: sprintf((char *)tempbuf, "Type Specific Block Offset"); break;
-                            case 0x59: sprintf((char *)tempbuf, "Block Type"); break;
-                            case 0x5a: sprintf((char *)tempbuf, "Set Envelope Report"); break;
-                            case 0x5b: sprintf((char *)tempbuf, "Attack Level"); break;
-                            case 0x5c: sprintf((char *)tempbuf, "Attack Time"); break;
-                            case 0x5d: sprintf((char *)tempbuf, "Fade Level"); break;
-                            case 0x5e: sprintf((char *)tempbuf, "Fade Time"); break;
-                            case 0x5f: sprintf((char *)tempbuf, "Set Condition Report"); break;
-                            case 0x60: sprintf((char *)tempbuf, "CP Offset"); break;
-                            case 0x61: sprintf((char *)tempbuf, "Positive Coefficient"); break;
-                            case 0x62: sprintf((char *)tempbuf, "Negative Coefficient"); break;
-                            case 0x63: sprintf((char *)tempbuf, "Positive Saturation"); break;
-                            case 0x64: sprintf((char *)tempbuf, "Negative Saturation"); break;
-                            case 0x65: sprintf((char *)tempbuf, "Dead Band"); break;
-                            case 0x66: sprintf((char *)tempbuf, "Download Force Data Report"); break;
-                            case 0x67: sprintf((char *)tempbuf, "Isoch Custom Force Enable"); break;
-                            case 0x68: sprintf((char *)tempbuf, "Custom Force Data Report"); break;
-                            case 0x69: sprintf((char *)tempbuf, "Custom Force Data"); break;
-                            case 0x6a: sprintf((char *)tempbuf, "Custom Force Vendor Defined Data"); break;
-                            case 0x6b: sprintf((char *)tempbuf, "Set Custom Force Report"); break;
-                            case 0x6c: sprintf((char *)tempbuf, "Custom Force Data Offset"); break;
-                            case 0x6d: sprintf((char *)tempbuf, "Sample Count"); break;
-                            case 0x6e: sprintf((char *)tempbuf, "Set Periodic Report"); break;
-                            case 0x6f: sprintf((char *)tempbuf, "Offset"); break;
-                            case 0x70: sprintf((char *)tempbuf, "Magnitude"); break;
-                            case 0x71: sprintf((char *)tempbuf, "Phase"); break;
-                            case 0x72: sprintf((char *)tempbuf, "Period"); break;
-                            case 0x73: sprintf((char *)tempbuf, "Set Constant Force Report"); break;
-                            case 0x74: sprintf((char *)tempbuf, "Set Constant Force"); break;
-                            case 0x75: sprintf((char *)tempbuf, "Ramp Start"); break;
-                            case 0x76: sprintf((char *)tempbuf, "Ramp End"); break;
-                            case 0x77: sprintf((char *)tempbuf, "Effect Operation Report"); break;
-                            case 0x78: sprintf((char *)tempbuf, "Effect Operation"); break;
-                            case 0x79: sprintf((char *)tempbuf, "Op Effect Start"); break;
-                            case 0x7a: sprintf((char *)tempbuf, "Op Effect Start Solo"); break;
-                            case 0x7b: sprintf((char *)tempbuf, "Op Effect Stop"); break;
-                            case 0x7c: sprintf((char *)tempbuf, "Loop Count"); break;
-                            case 0x7d: sprintf((char *)tempbuf, "Gain Report"); break;
-                            case 0x7e: sprintf((char *)tempbuf, "Gain"); break;
-                            case 0x7f: sprintf((char *)tempbuf, "PID Pool Report"); break;
-                            case 0x80: sprintf((char *)tempbuf, "RAM Pool Size"); break;
-                            case 0x81: sprintf((char *)tempbuf, "ROM Pool Size"); break;
-                            case 0x82: sprintf((char *)tempbuf, "ROM Effect Block Count"); break;
-                            case 0x83: sprintf((char *)tempbuf, "Simultaneous Effects Max"); break;
-                            case 0x84: sprintf((char *)tempbuf, "Pool Alignment"); break;
-                            case 0x85: sprintf((char *)tempbuf, "PID Pool Move Report"); break;
-                            case 0x86: sprintf((char *)tempbuf, "Move Source"); break;
-                            case 0x87: sprintf((char *)tempbuf, "Move Destination"); break;
-                            case 0x88: sprintf((char *)tempbuf, "Move Length"); break;
-                            case 0x89: sprintf((char *)tempbuf, "PID Block Load Report"); break;
-                            case 0x8b: sprintf((char *)tempbuf, "Block Load Status"); break;
-                            case 0x8c: sprintf((char *)tempbuf, "Block Load Success"); break;
-                            case 0x8d: sprintf((char *)tempbuf, "Block Load Full"); break;
-                            case 0x8e: sprintf((char *)tempbuf, "Block Load Error"); break;
-                            case 0x8f: sprintf((char *)tempbuf, "Block Handle"); break;
-                            case 0x90: sprintf((char *)tempbuf, "PID Block Free Report"); break;
-                            case 0x91: sprintf((char *)tempbuf, "Type Specific Block Handle"); break;
-                            case 0x92: sprintf((char *)tempbuf, "PID State Report"); break;
-                            case 0x94: sprintf((char *)tempbuf, "Effect Playing"); break;
-                            case 0x95: sprintf((char *)tempbuf, "PID Device Control Report"); break;
-                            case 0x96: sprintf((char *)tempbuf, "PID Device Control"); break;
-                            case 0x97: sprintf((char *)tempbuf, "DC Enable Actuators"); break;
-                            case 0x98: sprintf((char *)tempbuf, "DC Disable Actuators"); break;
-                            case 0x99: sprintf((char *)tempbuf, "DC Stoop All Effects"); break;
-                            case 0x9a: sprintf((char *)tempbuf, "DC Device Reset"); break;
-                            case 0x9b: sprintf((char *)tempbuf, "DC Device Pause"); break;
-                            case 0x9c: sprintf((char *)tempbuf, "DC Device Continue"); break;
-                            case 0x9f: sprintf((char *)tempbuf, "Device Paused"); break;
-                            case 0xa0: sprintf((char *)tempbuf, "Actuators Enabled"); break;
-                            case 0xa4: sprintf((char *)tempbuf, "Safety Switch"); break;
-                            case 0xa5: sprintf((char *)tempbuf, "Actuator Override Switch"); break;
-                            case 0xa6: sprintf((char *)tempbuf, "Actuator Power"); break;
-                            case 0xa7: sprintf((char *)tempbuf, "Start Delay"); break;
-                            case 0xa8: sprintf((char *)tempbuf, "Parameter Block Size"); break;
-                            case 0xa9: sprintf((char *)tempbuf, "Device Managed Pool"); break;
-                            case 0xaa: sprintf((char *)tempbuf, "Shared parameter blocks"); break;
-                            case 0xab: sprintf((char *)tempbuf, "Create New Effect Report"); break;
-                            case 0xac: sprintf((char *)tempbuf, "RAM Pool Available"); break;
-                                
-                                
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
-                    }
-                    else if (usagePage == kHIDPage_Sensor)
-                    {
-                        strcat((char *)buf, (char *)"(");
-                        switch (value)
-                        {
-                            case kHIDUsage_Snsr_Sensor: sprintf((char *)tempbuf, "Sensor"); break;
-                            case kHIDUsage_Snsr_Biometric: sprintf((char *)tempbuf, "Biometric"); break;
-                            case kHIDUsage_Snsr_Location: sprintf((char *)tempbuf, "Location"); break;
-                            case kHIDUsage_Snsr_Motion: sprintf((char *)tempbuf, "Motion"); break;
-                            case kHIDUsage_Snsr_Orientation: sprintf((char *)tempbuf, "Orientation"); break;
-                            case kHIDUsage_Snsr_Other: sprintf((char *)tempbuf, "Other"); break;
-                            case kHIDUsage_Snsr_Other_Generic: sprintf((char *)tempbuf, "Other Generic"); break;
-                            case kHIDUsage_Snsr_Property_ReportInterval: sprintf((char *)tempbuf, "Property: Report Interval"); break;
-                            case kHIDUsage_Snsr_Data_Custom: sprintf((char *)tempbuf, "Data Field: Custom"); break;
-                            default: sprintf((char *)tempbuf, "%d (0x%x)", (int)value, (unsigned int)value); break;
-                        }
-                        strcat((char *)tempbuf, (char *)")");
+                        sprintf((char *)tempbuf, "(%s %u)", name, nameUsage);
                     }
                     else
                     {
@@ -770,3 +453,741 @@ void PrintHIDDescriptor(const uint8_t *reportDesc, uint32_t length)
         printf("%s%s\n",buf, bufvalue);
     }
 }
+
+#define kJSONMaxReportIDs       256
+#define kJSONMaxGlobalStack     32
+
+typedef struct {
+    char *      data;
+    size_t      length;
+    size_t      capacity;
+} JSONBuffer;
+
+typedef struct {
+    uint32_t    usagePage;
+    uint32_t    reportSize;
+    uint32_t    reportCount;
+    uint32_t    reportID;
+} JSONGlobals;
+
+typedef struct {
+    uint64_t    bits[3];
+    uint64_t    elements[3];
+} JSONReport;
+
+static const char * const kJSONItemTypeNames[] = { "Main", "Global", "Local", "Reserved" };
+
+static const char * const kJSONMainTagNames[16] = {
+    [kReport_TagInput]          = "Input",
+    [kReport_TagOutput]         = "Output",
+    [kReport_TagFeature]        = "Feature",
+    [kReport_TagCollection]     = "Collection",
+    [kReport_TagEndCollection]  = "End Collection",
+};
+
+static const char * const kJSONGlobalTagNames[16] = {
+    [kReport_TagUsagePage]      = "Usage Page",
+    [kReport_TagLogicalMin]     = "Logical Minimum",
+    [kReport_TagLogicalMax]     = "Logical Maximum",
+    [kReport_TagPhysicalMin]    = "Physical Minimum",
+    [kReport_TagPhysicalMax]    = "Physical Maximum",
+    [kReport_TagUnitExponent]   = "Unit Exponent",
+    [kReport_TagUnit]           = "Unit",
+    [kReport_TagReportSize]     = "Report Size",
+    [kReport_TagReportID]       = "Report ID",
+    [kReport_TagReportCount]    = "Report Count",
+    [kReport_TagPush]           = "Push",
+    [kReport_TagPop]            = "Pop",
+};
+
+static const char * const kJSONLocalTagNames[16] = {
+    [kReport_TagUsage]              = "Usage",
+    [kReport_TagUsageMin]           = "Usage Minimum",
+    [kReport_TagUsageMax]           = "Usage Maximum",
+    [kReport_TagDesignatorIndex]    = "Designator Index",
+    [kReport_TagDesignatorMin]      = "Designator Minimum",
+    [kReport_TagDesignatorMax]      = "Designator Maximum",
+    [kReport_TagStringIndex]        = "String Index",
+    [kReport_TagStringMin]          = "String Minimum",
+    [kReport_TagStringMax]          = "String Maximum",
+    [kReport_TagSetDelimiter]       = "Delimiter",
+};
+
+// Names of the set bits of an Input, Output or Feature item, see kIO_Data_or_Constant
+static const char * const kJSONMainFlagNames[] = {
+    "Constant", "Variable", "Relative", "Wrap", "Nonlinear", "No Preferred", "Null State", "Volatile", "Buffered Bytes"
+};
+
+static const char * const kJSONCollectionNames[] = {
+    "Physical", "Application", "Logical", "Report", "Named Array", "Usage Switch", "Usage Modifier"
+};
+
+static const char * const kJSONReportTypeNames[] = { "input", "output", "feature" };
+
+static void JSONReserve(JSONBuffer * json, size_t length)
+{
+    size_t  capacity;
+    char *  data;
+
+    if (json->length + length <= json->capacity) {
+        return;
+    }
+
+    capacity = json->capacity ? json->capacity : 4096;
+    while (capacity < json->length + length) {
+        capacity *= 2;
+    }
+
+    data = realloc(json->data, capacity);
+    if (!data) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    json->data      = data;
+    json->capacity  = capacity;
+}
+
+static void JSONAppendBytes(JSONBuffer * json, const char * bytes, size_t length)
+{
+    JSONReserve(json, length);
+    memcpy(json->data + json->length, bytes, length);
+    json->length += length;
+}
+
+#define JSONAppendLiteral(json, literal) JSONAppendBytes(json, literal, sizeof(literal) - 1)
+
+static void JSONAppendString(JSONBuffer * json, const char * string)
+{
+    static const char   hex[] = "0123456789abcdef";
+    size_t              length = strlen(string);
+
+    // Worst case every byte becomes a \u00XX escape
+    JSONReserve(json, length * 6 + 2);
+
+    json->data[json->length++] = '"';
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = (unsigned char)string[i];
+
+        if (c == '"' || c == '\\') {
+            json->data[json->length++] = '\\';
+            json->data[json->length++] = (char)c;
+        } else if (c < 0x20) {
+            memcpy(json->data + json->length, "\\u00", 4);
+            json->data[json->length + 4] = hex[c >> 4];
+            json->data[json->length + 5] = hex[c & 0xF];
+            json->length += 6;
+        } else {
+            json->data[json->length++] = (char)c;
+        }
+    }
+    json->data[json->length++] = '"';
+}
+
+static void JSONAppendUInt(JSONBuffer * json, uint64_t value)
+{
+    char    digits[20];
+    size_t  count = 0;
+
+    do {
+        digits[sizeof(digits) - ++count] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+
+    JSONAppendBytes(json, &digits[sizeof(digits) - count], count);
+}
+
+static void JSONAppendInt(JSONBuffer * json, int64_t value)
+{
+    if (value < 0) {
+        JSONAppendLiteral(json, "-");
+        JSONAppendUInt(json, 0 - (uint64_t)value);
+    } else {
+        JSONAppendUInt(json, (uint64_t)value);
+    }
+}
+
+// Appends ,"name":"<usage name>" when the tables know the usage
+static void JSONAppendUsageName(JSONBuffer * json, uint32_t usagePage, uint32_t usage)
+{
+    const char * name = IOHIDUsageName(usagePage, usage);
+
+    if (name) {
+        JSONAppendLiteral(json, ",\"name\":");
+        JSONAppendString(json, name);
+    } else if ((name = IOHIDUsageNameGeneratedPrefix(usagePage, usage))) {
+        JSONAppendLiteral(json, ",\"name\":\"");
+        JSONAppendBytes(json, name, strlen(name));
+        JSONAppendLiteral(json, " ");
+        JSONAppendUInt(json, usage);
+        JSONAppendLiteral(json, "\"");
+    }
+}
+
+static void JSONAppendReportType(JSONBuffer * json, const JSONReport * report, uint32_t reportID, int type)
+{
+    uint64_t bytes = (report->bits[type] + 7) / 8;
+
+    if (bytes && reportID) {
+        bytes++;
+    }
+
+    JSONAppendLiteral(json, ",\"");
+    JSONAppendBytes(json, kJSONReportTypeNames[type], strlen(kJSONReportTypeNames[type]));
+    JSONAppendLiteral(json, "\":{\"bits\":");
+    JSONAppendUInt(json, report->bits[type]);
+    JSONAppendLiteral(json, ",\"bytes\":");
+    JSONAppendUInt(json, bytes);
+    JSONAppendLiteral(json, ",\"elements\":");
+    JSONAppendUInt(json, report->elements[type]);
+    JSONAppendLiteral(json, "}");
+}
+
+void PrintHIDDescriptorJSON(FILE * file, const char * source, uint64_t line, const uint8_t * reportDesc, uint32_t length, uint32_t options)
+{
+    static JSONBuffer       json, collections;
+    static JSONReport       reports[kJSONMaxReportIDs];
+    static uint8_t          reportIDs[kJSONMaxReportIDs];
+    static bool             reportSeen[kJSONMaxReportIDs];
+    static JSONGlobals      globalStack[kJSONMaxGlobalStack];
+    static int32_t *        openCollections;
+    static uint32_t         openCollectionsCapacity;
+    static char             error[128];
+    const uint8_t *         start = reportDesc;
+    const uint8_t *         end = reportDesc + length;
+    JSONGlobals             globals = { 0 };
+    uint32_t                reportIDCount = 0;
+    uint32_t                globalDepth = 0;
+    uint32_t                collectionCount = 0;
+    uint32_t                collectionDepth = 0;
+    uint32_t                firstUsagePage = 0;
+    uint32_t                firstUsage = 0;
+    bool                    hasUsage = false;
+    bool                    firstItem = true;
+
+    json.length         = 0;
+    collections.length  = 0;
+    error[0]            = 0;
+
+    JSONAppendLiteral(&json, "{\"source\":");
+    JSONAppendString(&json, source ? source : "");
+    if (line) {
+        JSONAppendLiteral(&json, ",\"line\":");
+        JSONAppendUInt(&json, line);
+    }
+    JSONAppendLiteral(&json, ",\"length\":");
+    JSONAppendUInt(&json, length);
+    if (!(options & kHIDDescriptorJSONOmitItems)) {
+        JSONAppendLiteral(&json, ",\"items\":[");
+    }
+
+    while (reportDesc < end)
+    {
+        uint32_t    offset = (uint32_t)(reportDesc - start);
+        uint32_t    size = UnpackReportSize(*reportDesc);
+        uint8_t     type = UnpackReportType(*reportDesc);
+        uint8_t     tag = UnpackReportTag(*reportDesc);
+        uint32_t    value = 0;
+        int32_t     svalue = 0;
+        const char *tagName = NULL;
+
+        if (size == 3) size = 4;    // 0 == 0 bytes, 1 == 1 bytes, 2 == 2 bytes, but 3 == 4 bytes
+        reportDesc++;
+
+        if (tag == kReport_TagLongItem)
+        {
+            if (end - reportDesc < 2 || (uint32_t)(end - reportDesc - 2) < reportDesc[0]) {
+                snprintf(error, sizeof(error), "Truncated long item at offset %u", offset);
+                break;
+            }
+
+            if (!(options & kHIDDescriptorJSONOmitItems)) {
+                if (!firstItem) {
+                    JSONAppendLiteral(&json, ",");
+                }
+                JSONAppendLiteral(&json, "{\"offset\":");
+                JSONAppendUInt(&json, offset);
+                JSONAppendLiteral(&json, ",\"type\":\"Long\",\"tag\":");
+                JSONAppendUInt(&json, reportDesc[1]);
+                JSONAppendLiteral(&json, ",\"size\":");
+                JSONAppendUInt(&json, reportDesc[0]);
+                JSONAppendLiteral(&json, "}");
+                firstItem = false;
+            }
+
+            reportDesc += 2 + reportDesc[0];
+            continue;
+        }
+
+        if ((uint32_t)(end - reportDesc) < size) {
+            snprintf(error, sizeof(error), "Truncated item at offset %u", offset);
+            break;
+        }
+
+        for (uint32_t i = 0; i < size; i++) {
+            value |= (uint32_t)reportDesc[i] << (i * 8);
+        }
+        reportDesc += size;
+
+        switch (size)
+        {
+            case 1: svalue = (int8_t) value; break;
+            case 2: svalue = (int16_t) value; break;
+            case 4: svalue = (int32_t) value; break;
+        }
+
+        switch (type)
+        {
+            case kReport_TypeMain:      tagName = kJSONMainTagNames[tag]; break;
+            case kReport_TypeGlobal:    tagName = kJSONGlobalTagNames[tag]; break;
+            case kReport_TypeLocal:     tagName = kJSONLocalTagNames[tag]; break;
+        }
+
+        if (!(options & kHIDDescriptorJSONOmitItems)) {
+            if (!firstItem) {
+                JSONAppendLiteral(&json, ",");
+            }
+            JSONAppendLiteral(&json, "{\"offset\":");
+            JSONAppendUInt(&json, offset);
+            JSONAppendLiteral(&json, ",\"type\":\"");
+            JSONAppendBytes(&json, kJSONItemTypeNames[type], strlen(kJSONItemTypeNames[type]));
+            JSONAppendLiteral(&json, "\",\"tag\":");
+            if (tagName) {
+                JSONAppendString(&json, tagName);
+            } else {
+                JSONAppendUInt(&json, tag);
+            }
+            JSONAppendLiteral(&json, ",\"size\":");
+            JSONAppendUInt(&json, size);
+            if (size) {
+                JSONAppendLiteral(&json, ",\"value\":");
+                if (type == kReport_TypeGlobal && tag >= kReport_TagLogicalMin && tag <= kReport_TagPhysicalMax) {
+                    JSONAppendInt(&json, svalue);
+                } else {
+                    JSONAppendUInt(&json, value);
+                }
+            }
+            firstItem = false;
+        }
+
+        switch (type)
+        {
+            case kReport_TypeMain:
+                switch (tag)
+                {
+                    case kReport_TagInput:
+                    case kReport_TagOutput:
+                    case kReport_TagFeature:
+                    {
+                        int reportType = (tag == kReport_TagInput) ? 0 : (tag == kReport_TagOutput) ? 1 : 2;
+
+                        if (!(options & kHIDDescriptorJSONOmitItems)) {
+                            bool firstFlag = true;
+
+                            JSONAppendLiteral(&json, ",\"flags\":[");
+                            for (uint32_t bit = 0; bit < sizeof(kJSONMainFlagNames) / sizeof(kJSONMainFlagNames[0]); bit++) {
+                                if (value & (1 << bit)) {
+                                    if (!firstFlag) {
+                                        JSONAppendLiteral(&json, ",");
+                                    }
+                                    JSONAppendString(&json, kJSONMainFlagNames[bit]);
+                                    firstFlag = false;
+                                }
+                            }
+                            JSONAppendLiteral(&json, "]");
+                        }
+
+                        if (globals.reportID >= kJSONMaxReportIDs) {
+                            if (!error[0]) {
+                                snprintf(error, sizeof(error), "Report ID %u out of range at offset %u", globals.reportID, offset);
+                            }
+                            break;
+                        }
+
+                        if (!reportSeen[globals.reportID]) {
+                            reportSeen[globals.reportID] = true;
+                            reportIDs[reportIDCount++] = (uint8_t)globals.reportID;
+                        }
+
+                        reports[globals.reportID].bits[reportType] += (uint64_t)globals.reportSize * globals.reportCount;
+                        if (!(value & kIO_Data_or_Constant)) {
+                            reports[globals.reportID].elements[reportType] += globals.reportCount;
+                        }
+                        break;
+                    }
+
+                    case kReport_TagCollection:
+                        if (!(options & kHIDDescriptorJSONOmitItems) && value < sizeof(kJSONCollectionNames) / sizeof(kJSONCollectionNames[0])) {
+                            JSONAppendLiteral(&json, ",\"name\":");
+                            JSONAppendString(&json, kJSONCollectionNames[value]);
+                        }
+
+                        if (collectionCount) {
+                            JSONAppendLiteral(&collections, ",");
+                        }
+                        JSONAppendLiteral(&collections, "{\"offset\":");
+                        JSONAppendUInt(&collections, offset);
+                        JSONAppendLiteral(&collections, ",\"type\":");
+                        if (value < sizeof(kJSONCollectionNames) / sizeof(kJSONCollectionNames[0])) {
+                            JSONAppendString(&collections, kJSONCollectionNames[value]);
+                        } else {
+                            JSONAppendUInt(&collections, value);
+                        }
+                        JSONAppendLiteral(&collections, ",\"depth\":");
+                        JSONAppendUInt(&collections, collectionDepth);
+                        JSONAppendLiteral(&collections, ",\"parent\":");
+                        JSONAppendInt(&collections, collectionDepth ? openCollections[collectionDepth - 1] : -1);
+                        if (hasUsage) {
+                            JSONAppendLiteral(&collections, ",\"usagePage\":");
+                            JSONAppendUInt(&collections, firstUsagePage);
+                            JSONAppendLiteral(&collections, ",\"usage\":");
+                            JSONAppendUInt(&collections, firstUsage);
+                            JSONAppendUsageName(&collections, firstUsagePage, firstUsage);
+                        }
+                        JSONAppendLiteral(&collections, "}");
+
+                        if (collectionDepth == openCollectionsCapacity) {
+                            uint32_t    capacity = openCollectionsCapacity ? openCollectionsCapacity * 2 : 16;
+                            int32_t *   indices = realloc(openCollections, capacity * sizeof(int32_t));
+
+                            if (!indices) {
+                                fprintf(stderr, "out of memory\n");
+                                exit(1);
+                            }
+                            openCollections         = indices;
+                            openCollectionsCapacity = capacity;
+                        }
+                        openCollections[collectionDepth++] = (int32_t)collectionCount++;
+                        break;
+
+                    case kReport_TagEndCollection:
+                        if (collectionDepth) {
+                            collectionDepth--;
+                        } else if (!error[0]) {
+                            snprintf(error, sizeof(error), "End Collection without Collection at offset %u", offset);
+                        }
+                        break;
+                }
+
+                // Local items only apply to the next main item
+                hasUsage = false;
+                break;
+
+            case kReport_TypeGlobal:
+                switch (tag)
+                {
+                    case kReport_TagUsagePage:
+                        globals.usagePage = value;
+                        if (!(options & kHIDDescriptorJSONOmitItems)) {
+                            const char * name = IOHIDUsagePageName(value);
+
+                            if (name) {
+                                JSONAppendLiteral(&json, ",\"name\":");
+                                JSONAppendString(&json, name);
+                            }
+                        }
+                        break;
+                    case kReport_TagReportSize:     globals.reportSize = value; break;
+                    case kReport_TagReportCount:    globals.reportCount = value; break;
+                    case kReport_TagReportID:       globals.reportID = value; break;
+                    case kReport_TagPush:
+                        if (globalDepth < kJSONMaxGlobalStack) {
+                            globalStack[globalDepth++] = globals;
+                        } else if (!error[0]) {
+                            snprintf(error, sizeof(error), "Push nested too deeply at offset %u", offset);
+                        }
+                        break;
+                    case kReport_TagPop:
+                        if (globalDepth) {
+                            globals = globalStack[--globalDepth];
+                        } else if (!error[0]) {
+                            snprintf(error, sizeof(error), "Pop without Push at offset %u", offset);
+                        }
+                        break;
+                }
+                break;
+
+            case kReport_TypeLocal:
+                if (tag == kReport_TagUsage || tag == kReport_TagUsageMin || tag == kReport_TagUsageMax) {
+                    // 4 byte usages carry their own usage page
+                    uint32_t usagePage  = (size == 4) ? (value >> 16) : globals.usagePage;
+                    uint32_t usage      = (size == 4) ? (value & 0xFFFF) : value;
+
+                    if (!(options & kHIDDescriptorJSONOmitItems)) {
+                        JSONAppendUsageName(&json, usagePage, usage);
+                    }
+
+                    if (!hasUsage) {
+                        firstUsagePage  = usagePage;
+                        firstUsage      = usage;
+                        hasUsage        = true;
+                    }
+                }
+                break;
+        }
+
+        if (!(options & kHIDDescriptorJSONOmitItems)) {
+            JSONAppendLiteral(&json, "}");
+        }
+    }
+
+    if (collectionDepth && !error[0]) {
+        snprintf(error, sizeof(error), "%u collections not closed", collectionDepth);
+    }
+
+    if (!(options & kHIDDescriptorJSONOmitItems)) {
+        JSONAppendLiteral(&json, "]");
+    }
+
+    JSONAppendLiteral(&json, ",\"collections\":[");
+    JSONAppendBytes(&json, collections.data, collections.length);
+    JSONAppendLiteral(&json, "],\"reports\":[");
+    for (uint32_t i = 0; i < reportIDCount; i++) {
+        uint32_t reportID = reportIDs[i];
+
+        if (i) {
+            JSONAppendLiteral(&json, ",");
+        }
+        JSONAppendLiteral(&json, "{\"id\":");
+        JSONAppendUInt(&json, reportID);
+        for (int reportType = 0; reportType < 3; reportType++) {
+            JSONAppendReportType(&json, &reports[reportID], reportID, reportType);
+        }
+        JSONAppendLiteral(&json, "}");
+
+        memset(&reports[reportID], 0, sizeof(reports[reportID]));
+        reportSeen[reportID] = false;
+    }
+    JSONAppendLiteral(&json, "],\"error\":");
+    if (error[0]) {
+        JSONAppendString(&json, error);
+    } else {
+        JSONAppendLiteral(&json, "null");
+    }
+    JSONAppendLiteral(&json, "}\n");
+
+    fwrite(json.data, 1, json.length, file);
+}
+
+#if IOHID_REPORT_DESCRIPTOR_PARSER_MAIN
+
+enum {
+    kToolOptionJSON     = 0x1,
+    kToolOptionLines    = 0x2,
+};
+
+static int HexDigitValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Accepts "05 01 09 02", "0x05, 0x01," and hex dumps with "00000000:" offsets, skipping
+// // comments
+static bool ParseHexDescriptor(const char * text, size_t length, uint8_t ** bytes, uint32_t * byteLength, uint32_t * byteCapacity)
+{
+    const char *    end = text + length;
+    uint32_t        count = 0;
+
+    while (text < end) {
+        const char *    token;
+        size_t          tokenLength;
+
+        if (text[0] == '/' && text + 1 < end && text[1] == '/') {
+            while (text < end && *text != '\n') {
+                text++;
+            }
+            continue;
+        }
+
+        if (!((*text >= '0' && *text <= '9') || (*text >= 'a' && *text <= 'z') || (*text >= 'A' && *text <= 'Z'))) {
+            text++;
+            continue;
+        }
+
+        token = text;
+        while (text < end && ((*text >= '0' && *text <= '9') || (*text >= 'a' && *text <= 'z') || (*text >= 'A' && *text <= 'Z'))) {
+            text++;
+        }
+        tokenLength = text - token;
+
+        // Hex dump offset
+        if (text < end && *text == ':') {
+            text++;
+            continue;
+        }
+
+        if (tokenLength > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) {
+            token += 2;
+            tokenLength -= 2;
+        }
+
+        if (tokenLength > 2 && (tokenLength & 1)) {
+            return false;
+        }
+
+        for (size_t i = 0; i < tokenLength; i += 2) {
+            int high = HexDigitValue(token[i]);
+            int low = (i + 1 < tokenLength) ? HexDigitValue(token[i + 1]) : 0;
+
+            if (high < 0 || low < 0) {
+                return false;
+            }
+
+            if (count == *byteCapacity) {
+                uint32_t    capacity = *byteCapacity ? *byteCapacity * 2 : 1024;
+                uint8_t *   data = realloc(*bytes, capacity);
+
+                if (!data) {
+                    fprintf(stderr, "out of memory\n");
+                    exit(1);
+                }
+                *bytes          = data;
+                *byteCapacity   = capacity;
+            }
+
+            // A single digit is a whole byte
+            (*bytes)[count++] = (i + 1 < tokenLength) ? (uint8_t)((high << 4) | low) : (uint8_t)high;
+        }
+    }
+
+    *byteLength = count;
+    return true;
+}
+
+static void PrintDescriptor(const char * source, uint64_t line, const char * text, size_t length, uint32_t options, uint32_t jsonOptions, int * result)
+{
+    static uint8_t *    bytes;
+    static uint32_t     byteCapacity;
+    uint32_t            byteLength;
+
+    if (!ParseHexDescriptor(text, length, &bytes, &byteLength, &byteCapacity)) {
+        if (line) {
+            fprintf(stderr, "%s:%llu: not a hex descriptor\n", source, (unsigned long long)line);
+        } else {
+            fprintf(stderr, "%s: not a hex descriptor\n", source);
+        }
+        *result = 1;
+        return;
+    }
+
+    if (options & kToolOptionJSON) {
+        PrintHIDDescriptorJSON(stdout, source, line, bytes, byteLength, jsonOptions);
+    } else {
+        PrintHIDDescriptor(bytes, byteLength);
+    }
+}
+
+static void PrintDescriptors(FILE * file, const char * source, uint32_t options, uint32_t jsonOptions, int * result)
+{
+    char *      text = NULL;
+    size_t      capacity = 0;
+    ssize_t     length;
+    uint64_t    line = 0;
+
+    if (options & kToolOptionLines) {
+        while ((length = getline(&text, &capacity, file)) >= 0) {
+            line++;
+
+            // Skip blank lines
+            if (strspn(text, " \t\r\n") == (size_t)length) {
+                continue;
+            }
+
+            PrintDescriptor(source, line, text, length, options, jsonOptions, result);
+        }
+    } else {
+        size_t  size = 0;
+        size_t  read;
+
+        do {
+            if (size == capacity) {
+                char * data = realloc(text, capacity = capacity ? capacity * 2 : 4096);
+
+                if (!data) {
+                    fprintf(stderr, "out of memory\n");
+                    exit(1);
+                }
+                text = data;
+            }
+            read = fread(text + size, 1, capacity - size, file);
+            size += read;
+        } while (read);
+
+        PrintDescriptor(source, 0, text, size, options, jsonOptions, result);
+    }
+
+    free(text);
+}
+
+static void PrintUsage(void)
+{
+    printf("usage: hidReportDescriptorParser [--json] [--no-items] [--lines] [<file> ...]\n\n");
+    printf("Prints the HID report descriptor in each file, given as hex bytes. With no files,\n");
+    printf("or with -, reads one descriptor per line from stdin.\n\n");
+    printf("    -j | --json         Print one line of JSON per descriptor, with its items,\n");
+    printf("                        collections, and bits, bytes and elements per report ID.\n");
+    printf("    -n | --no-items     Leave the items out of the JSON.\n");
+    printf("    -l | --lines        Read every file as one descriptor per line.\n");
+}
+
+int main(int argc, const char * argv[])
+{
+    static char buffer[1 << 16];
+    uint32_t    options     = 0;
+    uint32_t    jsonOptions = 0;
+    int         result      = 0;
+    int         files       = 0;
+
+    setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-j") || !strcmp(argv[i], "--json")) {
+            options |= kToolOptionJSON;
+        } else if (!strcmp(argv[i], "-n") || !strcmp(argv[i], "--no-items")) {
+            jsonOptions |= kHIDDescriptorJSONOmitItems;
+        } else if (!strcmp(argv[i], "-l") || !strcmp(argv[i], "--lines")) {
+            options |= kToolOptionLines;
+        } else if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            PrintUsage();
+            return 0;
+        } else if (argv[i][0] == '-' && argv[i][1]) {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    for (int i = 1; i < argc; i++) {
+        FILE * file;
+
+        if (argv[i][0] == '-' && argv[i][1]) {
+            continue;
+        }
+
+        files++;
+        if (!strcmp(argv[i], "-")) {
+            PrintDescriptors(stdin, "-", options | kToolOptionLines, jsonOptions, &result);
+            continue;
+        }
+
+        file = fopen(argv[i], "r");
+        if (!file) {
+            fprintf(stderr, "%s: ", argv[i]);
+            perror(NULL);
+            result = 1;
+            continue;
+        }
+        PrintDescriptors(file, argv[i], options, jsonOptions, &result);
+        fclose(file);
+    }
+
+    if (!files) {
+        PrintDescriptors(stdin, "-", options | kToolOptionLines, jsonOptions, &result);
+    }
+
+    return result;
+}
+
+#endif /* IOHID_REPORT_DESCRIPTOR_PARSER_MAIN */
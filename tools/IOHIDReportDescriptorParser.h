@@ -12,6 +12,14 @@
 #include <stdio.h>
 #include <stdint.h>
 
+enum {
+    kHIDDescriptorJSONOmitItems = 0x1,
+};
+
 extern void PrintHIDDescriptor(const uint8_t *reportDesc, uint32_t length);
 
+// Prints one line of JSON: the items, the collections, and the bits, bytes and
+// elements of each report. A non-zero line is included to locate the descriptor.
+extern void PrintHIDDescriptorJSON(FILE *file, const char *source, uint64_t line, const uint8_t *reportDesc, uint32_t length, uint32_t options);
+
 #endif /* IOHIDFamily_IOHIDReportParser_h */
@@ -0,0 +1,5664 @@
+//
+//  IOHIDUsageNames.h
+//  IOHIDFamily
+//
+//  Generated by generateUsages.py from HidUsageTables.json 1.4, do not edit.
+//
+//  Usage page and usage names from the HID Usage Tables document: https://www.usb.org/hid.
+//  Pages and the usages of each page are sorted, so lookups are binary searches. Names are
+//  offsets into a single string pool, offset 0 being the empty string.
+//
+
+#ifndef IOHIDFamily_IOHIDUsageNames_h
+#define IOHIDFamily_IOHIDUsageNames_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint16_t    usage;
+    uint16_t    name;
+} IOHIDUsageNameEntry;
+
+typedef struct {
+    uint16_t    page;
+    uint16_t    firstUsage;         // index of the page's first entry in __IOHIDUsageNames
+    uint16_t    usageCount;
+    uint16_t    name;
+    uint16_t    generatedPrefix;    // Button, Ordinal and Monitor Enumerated usages are "<prefix> <usage>"
+    uint16_t    generatedMin;
+    uint16_t    generatedMax;
+} IOHIDUsagePageNameEntry;
+
+static const char __IOHIDUsageNameStrings[] =
+    "\0"
+    "Generic Desktop\0"
+    "Pointer\0"
+    "Mouse\0"
+    "Joystick\0"
+    "Gamepad\0"
+    "Keyboard\0"
+    "Keypad\0"
+    "Multi-axis Controller\0"
+    "Tablet PC System Controls\0"
+    "Water Cooling Device\0"
+    "Computer Chassis Device\0"
+    "Wireless Radio Controls\0"
+    "Portable Device Control\0"
+    "System Multi-Axis Controller\0"
+    "Spatial Controller\0"
+    "Assistive Control\0"
+    "Device Dock\0"
+    "Dockable Device\0"
+    "Call State Management Control\0"
+    "X\0"
+    "Y\0"
+    "Z\0"
+    "Rx\0"
+    "Ry\0"
+    "Rz\0"
+    "Slider\0"
+    "Dial\0"
+    "Wheel\0"
+    "Hat Switch\0"
+    "Counted Buffer\0"
+    "Byte Count\0"
+    "Motion Wakeup\0"
+    "Start\0"
+    "Select\0"
+    "Vx\0"
+    "Vy\0"
+    "Vz\0"
+    "Vbrx\0"
+    "Vbry\0"
+    "Vbrz\0"
+    "Vno\0"
+    "Feature Notification\0"
+    "Resolution Multiplier\0"
+    "Qx\0"
+    "Qy\0"
+    "Qz\0"
+    "Qw\0"
+    "System Control\0"
+    "System Power Down\0"
+    "System Sleep\0"
+    "System Wake Up\0"
+    "System Context Menu\0"
+    "System Main Menu\0"
+    "System App Menu\0"
+    "System Menu Help\0"
+    "System Menu Exit\0"
+    "System Menu Select\0"
+    "System Menu Right\0"
+    "System Menu Left\0"
+    "System Menu Up\0"
+    "System Menu Down\0"
+    "System Cold Restart\0"
+    "System Warm Restart\0"
+    "D-pad Up\0"
+    "D-pad Down\0"
+    "D-pad Right\0"
+    "D-pad Left\0"
+    "Index Trigger\0"
+    "Palm Trigger\0"
+    "Thumbstick\0"
+    "System Function Shift\0"
+    "System Function Shift Lock\0"
+    "System Function Shift Lock Indicator\0"
+    "System Dismiss Notification\0"
+    "System Do Not Disturb\0"
+    "System Dock\0"
+    "System Undock\0"
+    "System Setup\0"
+    "System Break\0"
+    "System Debugger Break\0"
+    "Application Break\0"
+    "Application Debugger Break\0"
+    "System Speaker Mute\0"
+    "System Hibernate\0"
+    "System Microphone Mute\0"
+    "System Display Invert\0"
+    "System Display Internal\0"
+    "System Display External\0"
+    "System Display Both\0"
+    "System Display Dual\0"
+    "System Display Toggle Int/Ext Mode\0"
+    "System Display Swap Primary/Secondary\0"
+    "System Display Toggle LCD Autoscale\0"
+    "Sensor Zone\0"
+    "RPM\0"
+    "Coolant Level\0"
+    "Coolant Critical Level\0"
+    "Coolant Pump\0"
+    "Chassis Enclosure\0"
+    "Wireless Radio Button\0"
+    "Wireless Radio LED\0"
+    "Wireless Radio Slider Switch\0"
+    "System Display Rotation Lock Button\0"
+    "System Display Rotation Lock Slider Switch\0"
+    "Control Enable\0"
+    "Dockable Device Unique ID\0"
+    "Dockable Device Vendor ID\0"
+    "Dockable Device Primary Usage Page\0"
+    "Dockable Device Primary Usage ID\0"
+    "Dockable Device Docking State\0"
+    "Dockable Device Display Occlusion\0"
+    "Dockable Device Object Type\0"
+    "Call Active LED\0"
+    "Call Mute Toggle\0"
+    "Call Mute LED\0"
+    "Simulation Controls\0"
+    "Flight Simulation Device\0"
+    "Automobile Simulation Device\0"
+    "Tank Simulation Device\0"
+    "Spaceship Simulation Device\0"
+    "Submarine Simulation Device\0"
+    "Sailing Simulation Device\0"
+    "Motorcycle Simulation Device\0"
+    "Sports Simulation Device\0"
+    "Airplane Simulation Device\0"
+    "Helicopter Simulation Device\0"
+    "Magic Carpet Simulation Device\0"
+    "Bicycle Simulation Device\0"
+    "Flight Control Stick\0"
+    "Flight Stick\0"
+    "Cyclic Control\0"
+    "Cyclic Trim\0"
+    "Flight Yoke\0"
+    "Track Control\0"
+    "Aileron\0"
+    "Aileron Trim\0"
+    "Anti-Torque Control\0"
+    "Autopilot Enable\0"
+    "Chaff Release\0"
+    "Collective Control\0"
+    "Dive Brake\0"
+    "Electronic Countermeasures\0"
+    "Elevator\0"
+    "Elevator Trim\0"
+    "Rudder\0"
+    "Throttle\0"
+    "Flight Communications\0"
+    "Flare Release\0"
+    "Landing Gear\0"
+    "Toe Brake\0"
+    "Trigger\0"
+    "Weapons Arm\0"
+    "Weapons Select\0"
+    "Wing Flaps\0"
+    "Accelerator\0"
+    "Brake\0"
+    "Clutch\0"
+    "Shifter\0"
+    "Steering\0"
+    "Turret Direction\0"
+    "Barrel Elevation\0"
+    "Dive Plane\0"
+    "Ballast\0"
+    "Bicycle Crank\0"
+    "Handle Bars\0"
+    "Front Brake\0"
+    "Rear Brake\0"
+    "VR Controls\0"
+    "Belt\0"
+    "Body Suit\0"
+    "Flexor\0"
+    "Glove\0"
+    "Head Tracker\0"
+    "Head Mounted Display\0"
+    "Hand Tracker\0"
+    "Oculometer\0"
+    "Vest\0"
+    "Animatronic Device\0"
+    "Stereo Enable\0"
+    "Display Enable\0"
+    "Sport Controls\0"
+    "Baseball Bat\0"
+    "Golf Club\0"
+    "Rowing Machine\0"
+    "Treadmill\0"
+    "Oar\0"
+    "Slope\0"
+    "Rate\0"
+    "Stick Speed\0"
+    "Stick Face Angle\0"
+    "Stick Heel/Toe\0"
+    "Stick Follow Through\0"
+    "Stick Tempo\0"
+    "Stick Type\0"
+    "Stick Height\0"
+    "Putter\0"
+    "1 Iron\0"
+    "2 Iron\0"
+    "3 Iron\0"
+    "4 Iron\0"
+    "5 Iron\0"
+    "6 Iron\0"
+    "7 Iron\0"
+    "8 Iron\0"
+    "9 Iron\0"
+    "10 Iron\0"
+    "11 Iron\0"
+    "Sand Wedge\0"
+    "Loft Wedge\0"
+    "Power Wedge\0"
+    "1 Wood\0"
+    "3 Wood\0"
+    "5 Wood\0"
+    "7 Wood\0"
+    "9 Wood\0"
+    "Game Controls\0"
+    "3D Game Controller\0"
+    "Pinball Device\0"
+    "Gun Device\0"
+    "Point of View\0"
+    "Turn Right/Left\0"
+    "Pitch Forward/Backward\0"
+    "Roll Right/Left\0"
+    "Move Right/Left\0"
+    "Move Forward/Backward\0"
+    "Move Up/Down\0"
+    "Lean Right/Left\0"
+    "Lean Forward/Backward\0"
+    "Height of POV\0"
+    "Flipper\0"
+    "Secondary Flipper\0"
+    "Bump\0"
+    "New Game\0"
+    "Shoot Ball\0"
+    "Player\0"
+    "Gun Bolt\0"
+    "Gun Clip\0"
+    "Gun Selector\0"
+    "Gun Single Shot\0"
+    "Gun Burst\0"
+    "Gun Automatic\0"
+    "Gun Safety\0"
+    "Gamepad Fire/Jump\0"
+    "Gamepad Trigger\0"
+    "Form-fitting Gamepad\0"
+    "Generic Device Controls\0"
+    "Background/Nonuser Controls\0"
+    "Battery Strength\0"
+    "Wireless Channel\0"
+    "Wireless ID\0"
+    "Discover Wireless Control\0"
+    "Security Code Character Entered\0"
+    "Security Code Character Erased\0"
+    "Security Code Cleared\0"
+    "Sequence ID\0"
+    "Sequence ID Reset\0"
+    "RF Signal Strength\0"
+    "Software Version\0"
+    "Protocol Version\0"
+    "Hardware Version\0"
+    "Major\0"
+    "Minor\0"
+    "Revision\0"
+    "Handedness\0"
+    "Either Hand\0"
+    "Left Hand\0"
+    "Right Hand\0"
+    "Both Hands\0"
+    "Grip Pose Offset\0"
+    "Pointer Pose Offset\0"
+    "Keyboard/Keypad\0"
+    "ErrorRollOver\0"
+    "POSTFail\0"
+    "ErrorUndefined\0"
+    "Keyboard A\0"
+    "Keyboard B\0"
+    "Keyboard C\0"
+    "Keyboard D\0"
+    "Keyboard E\0"
+    "Keyboard F\0"
+    "Keyboard G\0"
+    "Keyboard H\0"
+    "Keyboard I\0"
+    "Keyboard J\0"
+    "Keyboard K\0"
+    "Keyboard L\0"
+    "Keyboard M\0"
+    "Keyboard N\0"
+    "Keyboard O\0"
+    "Keyboard P\0"
+    "Keyboard Q\0"
+    "Keyboard R\0"
+    "Keyboard S\0"
+    "Keyboard T\0"
+    "Keyboard U\0"
+    "Keyboard V\0"
+    "Keyboard W\0"
+    "Keyboard X\0"
+    "Keyboard Y\0"
+    "Keyboard Z\0"
+    "Keyboard 1 and Bang\0"
+    "Keyboard 2 and At\0"
+    "Keyboard 3 and Hash\0"
+    "Keyboard 4 and Dollar\0"
+    "Keyboard 5 and Percent\0"
+    "Keyboard 6 and Caret\0"
+    "Keyboard 7 and Ampersand\0"
+    "Keyboard 8 and Star\0"
+    "Keyboard 9 and Left Bracket\0"
+    "Keyboard 0 and Right Bracket\0"
+    "Keyboard Return Enter\0"
+    "Keyboard Escape\0"
+    "Keyboard Delete\0"
+    "Keyboard Tab\0"
+    "Keyboard Spacebar\0"
+    "Keyboard Dash and Underscore\0"
+    "Keyboard Equals and Plus\0"
+    "Keyboard Left Brace\0"
+    "Keyboard Right Brace\0"
+    "Keyboard Backslash and Pipe\0"
+    "Keyboard Non-US Hash and Tilde\0"
+    "Keyboard SemiColon and Colon\0"
+    "Keyboard Left Apos and Double\0"
+    "Keyboard Grave Accent and Tilde\0"
+    "Keyboard Comma and LessThan\0"
+    "Keyboard Period and GreaterThan\0"
+    "Keyboard ForwardSlash and QuestionMark\0"
+    "Keyboard Caps Lock\0"
+    "Keyboard F1\0"
+    "Keyboard F2\0"
+    "Keyboard F3\0"
+    "Keyboard F4\0"
+    "Keyboard F5\0"
+    "Keyboard F6\0"
+    "Keyboard F7\0"
+    "Keyboard F8\0"
+    "Keyboard F9\0"
+    "Keyboard F10\0"
+    "Keyboard F11\0"
+    "Keyboard F12\0"
+    "Keyboard PrintScreen\0"
+    "Keyboard Scroll Lock\0"
+    "Keyboard Pause\0"
+    "Keyboard Insert\0"
+    "Keyboard Home\0"
+    "Keyboard PageUp\0"
+    "Keyboard Delete Forward\0"
+    "Keyboard End\0"
+    "Keyboard PageDown\0"
+    "Keyboard RightArrow\0"
+    "Keyboard LeftArrow\0"
+    "Keyboard DownArrow\0"
+    "Keyboard UpArrow\0"
+    "Keypad Num Lock and Clear\0"
+    "Keypad ForwardSlash\0"
+    "Keypad Star\0"
+    "Keypad Dash\0"
+    "Keypad Plus\0"
+    "Keypad ENTER\0"
+    "Keypad 1 and End\0"
+    "Keypad 2 and Down Arrow\0"
+    "Keypad 3 and PageDn\0"
+    "Keypad 4 and Left Arrow\0"
+    "Keypad 5\0"
+    "Keypad 6 and Right Arrow\0"
+    "Keypad 7 and Home\0"
+    "Keypad 8 and Up Arrow\0"
+    "Keypad 9 and PageUp\0"
+    "Keypad 0 and Insert\0"
+    "Keypad Period and Delete\0"
+    "Keyboard Non-US Backslash and Pipe\0"
+    "Keyboard Application\0"
+    "Keyboard Power\0"
+    "Keypad Equals\0"
+    "Keyboard F13\0"
+    "Keyboard F14\0"
+    "Keyboard F15\0"
+    "Keyboard F16\0"
+    "Keyboard F17\0"
+    "Keyboard F18\0"
+    "Keyboard F19\0"
+    "Keyboard F20\0"
+    "Keyboard F21\0"
+    "Keyboard F22\0"
+    "Keyboard F23\0"
+    "Keyboard F24\0"
+    "Keyboard Execute\0"
+    "Keyboard Help\0"
+    "Keyboard Menu\0"
+    "Keyboard Select\0"
+    "Keyboard Stop\0"
+    "Keyboard Again\0"
+    "Keyboard Undo\0"
+    "Keyboard Cut\0"
+    "Keyboard Copy\0"
+    "Keyboard Paste\0"
+    "Keyboard Find\0"
+    "Keyboard Mute\0"
+    "Keyboard Volume Up\0"
+    "Keyboard Volume Down\0"
+    "Keyboard Locking Caps Lock\0"
+    "Keyboard Locking Num Lock\0"
+    "Keyboard Locking Scroll Lock\0"
+    "Keypad Comma\0"
+    "Keypad Equal Sign\0"
+    "Keyboard International1\0"
+    "Keyboard International2\0"
+    "Keyboard International3\0"
+    "Keyboard International4\0"
+    "Keyboard International5\0"
+    "Keyboard International6\0"
+    "Keyboard International7\0"
+    "Keyboard International8\0"
+    "Keyboard International9\0"
+    "Keyboard LANG1\0"
+    "Keyboard LANG2\0"
+    "Keyboard LANG3\0"
+    "Keyboard LANG4\0"
+    "Keyboard LANG5\0"
+    "Keyboard LANG6\0"
+    "Keyboard LANG7\0"
+    "Keyboard LANG8\0"
+    "Keyboard LANG9\0"
+    "Keyboard Alternate Erase\0"
+    "Keyboard SysReq Attention\0"
+    "Keyboard Cancel\0"
+    "Keyboard Clear\0"
+    "Keyboard Prior\0"
+    "Keyboard Return\0"
+    "Keyboard Separator\0"
+    "Keyboard Out\0"
+    "Keyboard Oper\0"
+    "Keyboard Clear Again\0"
+    "Keyboard CrSel Props\0"
+    "Keyboard ExSel\0"
+    "Keypad Double 0\0"
+    "Keypad Triple 0\0"
+    "Thousands Separator\0"
+    "Decimal Separator\0"
+    "Currency Unit\0"
+    "Currency Sub-unit\0"
+    "Keypad Left Bracket\0"
+    "Keypad Right Bracket\0"
+    "Keypad Left Brace\0"
+    "Keypad Right Brace\0"
+    "Keypad Tab\0"
+    "Keypad Backspace\0"
+    "Keypad A\0"
+    "Keypad B\0"
+    "Keypad C\0"
+    "Keypad D\0"
+    "Keypad E\0"
+    "Keypad F\0"
+    "Keypad XOR\0"
+    "Keypad Caret\0"
+    "Keypad Percentage\0"
+    "Keypad Less\0"
+    "Keypad Greater\0"
+    "Keypad Ampersand\0"
+    "Keypad Double Ampersand\0"
+    "Keypad Bar\0"
+    "Keypad Double Bar\0"
+    "Keypad Colon\0"
+    "Keypad Hash\0"
+    "Keypad Space\0"
+    "Keypad At\0"
+    "Keypad Bang\0"
+    "Keypad Memory Store\0"
+    "Keypad Memory Recall\0"
+    "Keypad Memory Clear\0"
+    "Keypad Memory Add\0"
+    "Keypad Memory Subtract\0"
+    "Keypad Memory Multiply\0"
+    "Keypad Memory Divide\0"
+    "Keypad Plus Minus\0"
+    "Keypad Clear\0"
+    "Keypad Clear Entry\0"
+    "Keypad Binary\0"
+    "Keypad Octal\0"
+    "Keypad Decimal\0"
+    "Keypad Hexadecimal\0"
+    "Keyboard LeftControl\0"
+    "Keyboard LeftShift\0"
+    "Keyboard LeftAlt\0"
+    "Keyboard Left GUI\0"
+    "Keyboard RightControl\0"
+    "Keyboard RightShift\0"
+    "Keyboard RightAlt\0"
+    "Keyboard Right GUI\0"
+    "LED\0"
+    "Num Lock\0"
+    "Caps Lock\0"
+    "Scroll Lock\0"
+    "Compose\0"
+    "Kana\0"
+    "Power\0"
+    "Shift\0"
+    "Do Not Disturb\0"
+    "Mute\0"
+    "Tone Enable\0"
+    "High Cut Filter\0"
+    "Low Cut Filter\0"
+    "Equalizer Enable\0"
+    "Sound Field On\0"
+    "Surround On\0"
+    "Repeat\0"
+    "Stereo\0"
+    "Sampling Rate Detect\0"
+    "Spinning\0"
+    "CAV\0"
+    "CLV\0"
+    "Recording Format Detect\0"
+    "Off-Hook\0"
+    "Ring\0"
+    "Message Waiting\0"
+    "Data Mode\0"
+    "Battery Operation\0"
+    "Battery OK\0"
+    "Battery Low\0"
+    "Speaker\0"
+    "Headset\0"
+    "Hold\0"
+    "Microphone\0"
+    "Coverage\0"
+    "Night Mode\0"
+    "Send Calls\0"
+    "Call Pickup\0"
+    "Conference\0"
+    "Stand-by\0"
+    "Camera On\0"
+    "Camera Off\0"
+    "On-Line\0"
+    "Off-Line\0"
+    "Busy\0"
+    "Ready\0"
+    "Paper-Out\0"
+    "Paper-Jam\0"
+    "Remote\0"
+    "Forward\0"
+    "Reverse\0"
+    "Stop\0"
+    "Rewind\0"
+    "Fast Forward\0"
+    "Play\0"
+    "Pause\0"
+    "Record\0"
+    "Error\0"
+    "Usage Selected Indicator\0"
+    "Usage In Use Indicator\0"
+    "Usage Multi Mode Indicator\0"
+    "Indicator On\0"
+    "Indicator Flash\0"
+    "Indicator Slow Blink\0"
+    "Indicator Fast Blink\0"
+    "Indicator Off\0"
+    "Flash On Time\0"
+    "Slow Blink On Time\0"
+    "Slow Blink Off Time\0"
+    "Fast Blink On Time\0"
+    "Fast Blink Off Time\0"
+    "Usage Indicator Color\0"
+    "Indicator Red\0"
+    "Indicator Green\0"
+    "Indicator Amber\0"
+    "Generic Indicator\0"
+    "System Suspend\0"
+    "External Power Connected\0"
+    "Indicator Blue\0"
+    "Indicator Orange\0"
+    "Good Status\0"
+    "Warning Status\0"
+    "RGB LED\0"
+    "Red LED Channel\0"
+    "Blue LED Channel\0"
+    "Green LED Channel\0"
+    "LED Intensity\0"
+    "Player Indicator\0"
+    "Player 1\0"
+    "Player 2\0"
+    "Player 3\0"
+    "Player 4\0"
+    "Player 5\0"
+    "Player 6\0"
+    "Player 7\0"
+    "Player 8\0"
+    "Button\0"
+    "Instance\0"
+    "Ordinal\0"
+    "Telephony Device\0"
+    "Phone\0"
+    "Answering Machine\0"
+    "Message Controls\0"
+    "Handset\0"
+    "Telephony Key Pad\0"
+    "Programmable Button\0"
+    "Hook Switch\0"
+    "Flash\0"
+    "Feature\0"
+    "Redial\0"
+    "Transfer\0"
+    "Drop\0"
+    "Park\0"
+    "Forward Calls\0"
+    "Alternate Function\0"
+    "Line\0"
+    "Speaker Phone\0"
+    "Ring Enable\0"
+    "Ring Select\0"
+    "Phone Mute\0"
+    "Caller ID\0"
+    "Send\0"
+    "Speed Dial\0"
+    "Store Number\0"
+    "Recall Number\0"
+    "Phone Directory\0"
+    "Voice Mail\0"
+    "Screen Calls\0"
+    "Message\0"
+    "Answer On/Off\0"
+    "Inside Dial Tone\0"
+    "Outside Dial Tone\0"
+    "Inside Ring Tone\0"
+    "Outside Ring Tone\0"
+    "Priority Ring Tone\0"
+    "Inside Ringback\0"
+    "Priority Ringback\0"
+    "Line Busy Tone\0"
+    "Reorder Tone\0"
+    "Call Waiting Tone\0"
+    "Confirmation Tone 1\0"
+    "Confirmation Tone 2\0"
+    "Tones Off\0"
+    "Outside Ringback\0"
+    "Ringer\0"
+    "Phone Key 0\0"
+    "Phone Key 1\0"
+    "Phone Key 2\0"
+    "Phone Key 3\0"
+    "Phone Key 4\0"
+    "Phone Key 5\0"
+    "Phone Key 6\0"
+    "Phone Key 7\0"
+    "Phone Key 8\0"
+    "Phone Key 9\0"
+    "Phone Key Star\0"
+    "Phone Key Pound\0"
+    "Phone Key A\0"
+    "Phone Key B\0"
+    "Phone Key C\0"
+    "Phone Key D\0"
+    "Phone Call History Key\0"
+    "Phone Caller ID Key\0"
+    "Phone Settings Key\0"
+    "Host Control\0"
+    "Host Available\0"
+    "Host Call Active\0"
+    "Activate Handset Audio\0"
+    "Ring Type\0"
+    "Re-dialable Phone Number\0"
+    "Stop Ring Tone\0"
+    "PSTN Ring Tone\0"
+    "Host Ring Tone\0"
+    "Alert Sound Error\0"
+    "Alert Sound Confirm\0"
+    "Alert Sound Notification\0"
+    "Silent Ring\0"
+    "Email Message Waiting\0"
+    "Voicemail Message Waiting\0"
+    "Host Hold\0"
+    "Incoming Call History Count\0"
+    "Outgoing Call History Count\0"
+    "Incoming Call History\0"
+    "Outgoing Call History\0"
+    "Phone Locale\0"
+    "Phone Time Second\0"
+    "Phone Time Minute\0"
+    "Phone Time Hour\0"
+    "Phone Date Day\0"
+    "Phone Date Month\0"
+    "Phone Date Year\0"
+    "Handset Nickname\0"
+    "Address Book ID\0"
+    "Call Duration\0"
+    "Dual Mode Phone\0"
+    "Consumer\0"
+    "Consumer Control\0"
+    "Numeric Key Pad\0"
+    "Programmable Buttons\0"
+    "Headphone\0"
+    "Graphic Equalizer\0"
+    "+10\0"
+    "+100\0"
+    "AM/PM\0"
+    "Reset\0"
+    "Sleep\0"
+    "Sleep After\0"
+    "Sleep Mode\0"
+    "Illumination\0"
+    "Function Buttons\0"
+    "Menu\0"
+    "Menu Pick\0"
+    "Menu Up\0"
+    "Menu Down\0"
+    "Menu Left\0"
+    "Menu Right\0"
+    "Menu Escape\0"
+    "Menu Value Increase\0"
+    "Menu Value Decrease\0"
+    "Data On Screen\0"
+    "Closed Caption\0"
+    "Closed Caption Select\0"
+    "VCR/TV\0"
+    "Broadcast Mode\0"
+    "Snapshot\0"
+    "Still\0"
+    "Picture-in-Picture Toggle\0"
+    "Picture-in-Picture Swap\0"
+    "Red Menu Button\0"
+    "Green Menu Button\0"
+    "Blue Menu Button\0"
+    "Yellow Menu Button\0"
+    "Aspect\0"
+    "3D Mode Select\0"
+    "Display Brightness Increment\0"
+    "Display Brightness Decrement\0"
+    "Display Brightness\0"
+    "Display Backlight Toggle\0"
+    "Display Set Brightness to Minimum\0"
+    "Display Set Brightness to Maximum\0"
+    "Display Set Auto Brightness\0"
+    "Camera Access Enabled\0"
+    "Camera Access Disabled\0"
+    "Camera Access Toggle\0"
+    "Keyboard Brightness Increment\0"
+    "Keyboard Brightness Decrement\0"
+    "Keyboard Backlight Set Level\0"
+    "Keyboard Backlight OOC\0"
+    "Keyboard Backlight Set Minimum\0"
+    "Keyboard Backlight Set Maximum\0"
+    "Keyboard Backlight Auto\0"
+    "Selection\0"
+    "Assign Selection\0"
+    "Mode Step\0"
+    "Recall Last\0"
+    "Enter Channel\0"
+    "Order Movie\0"
+    "Channel\0"
+    "Media Selection\0"
+    "Media Select Computer\0"
+    "Media Select TV\0"
+    "Media Select WWW\0"
+    "Media Select DVD\0"
+    "Media Select Telephone\0"
+    "Media Select Program Guide\0"
+    "Media Select Video Phone\0"
+    "Media Select Games\0"
+    "Media Select Messages\0"
+    "Media Select CD\0"
+    "Media Select VCR\0"
+    "Media Select Tuner\0"
+    "Quit\0"
+    "Help\0"
+    "Media Select Tape\0"
+    "Media Select Cable\0"
+    "Media Select Satellite\0"
+    "Media Select Security\0"
+    "Media Select Home\0"
+    "Media Select Call\0"
+    "Channel Increment\0"
+    "Channel Decrement\0"
+    "Media Select SAP\0"
+    "VCR Plus\0"
+    "Once\0"
+    "Daily\0"
+    "Weekly\0"
+    "Monthly\0"
+    "Scan Next Track\0"
+    "Scan Previous Track\0"
+    "Eject\0"
+    "Random Play\0"
+    "Select Disc\0"
+    "Enter Disc\0"
+    "Tracking\0"
+    "Track Normal\0"
+    "Slow Tracking\0"
+    "Frame Forward\0"
+    "Frame Back\0"
+    "Mark\0"
+    "Clear Mark\0"
+    "Repeat From Mark\0"
+    "Return To Mark\0"
+    "Search Mark Forward\0"
+    "Search Mark Backwards\0"
+    "Counter Reset\0"
+    "Show Counter\0"
+    "Tracking Increment\0"
+    "Tracking Decrement\0"
+    "Stop/Eject\0"
+    "Play/Pause\0"
+    "Play/Skip\0"
+    "Voice Command\0"
+    "Invoke Capture Interface\0"
+    "Start or Stop Game Recording\0"
+    "Historical Game Capture\0"
+    "Capture Game Screenshot\0"
+    "Show or Hide Recording Indicator\0"
+    "Start or Stop Microphone Capture\0"
+    "Start or Stop Camera Capture\0"
+    "Start or Stop Game Broadcast\0"
+    "Start or Stop Voice Dictation Session\0"
+    "Invoke/Dismiss Emoji Picker\0"
+    "Volume\0"
+    "Balance\0"
+    "Bass\0"
+    "Treble\0"
+    "Bass Boost\0"
+    "Surround Mode\0"
+    "Loudness\0"
+    "MPX\0"
+    "Volume Increment\0"
+    "Volume Decrement\0"
+    "Speed Select\0"
+    "Playback Speed\0"
+    "Standard Play\0"
+    "Long Play\0"
+    "Extended Play\0"
+    "Slow\0"
+    "Fan Enable\0"
+    "Fan Speed\0"
+    "Light Enable\0"
+    "Light Illumination Level\0"
+    "Climate Control Enable\0"
+    "Room Temperature\0"
+    "Security Enable\0"
+    "Fire Alarm\0"
+    "Police Alarm\0"
+    "Proximity\0"
+    "Motion\0"
+    "Duress Alarm\0"
+    "Holdup Alarm\0"
+    "Medical Alarm\0"
+    "Balance Right\0"
+    "Balance Left\0"
+    "Bass Increment\0"
+    "Bass Decrement\0"
+    "Treble Increment\0"
+    "Treble Decrement\0"
+    "Speaker System\0"
+    "Channel Left\0"
+    "Channel Right\0"
+    "Channel Center\0"
+    "Channel Front\0"
+    "Channel Center Front\0"
+    "Channel Side\0"
+    "Channel Surround\0"
+    "Channel Low Frequency Enhancement\0"
+    "Channel Top\0"
+    "Channel Unknown\0"
+    "Sub-channel\0"
+    "Sub-channel Increment\0"
+    "Sub-channel Decrement\0"
+    "Alternate Audio Increment\0"
+    "Alternate Audio Decrement\0"
+    "Application Launch Buttons\0"
+    "AL Launch Button Configuration Tool\0"
+    "AL Programmable Button Configuration\0"
+    "AL Consumer Control Configuration\0"
+    "AL Word Processor\0"
+    "AL Text Editor\0"
+    "AL Spreadsheet\0"
+    "AL Graphics Editor\0"
+    "AL Presentation App\0"
+    "AL Database App\0"
+    "AL Email Reader\0"
+    "AL Newsreader\0"
+    "AL Voicemail\0"
+    "AL Contacts/Address Book\0"
+    "AL Calendar/Schedule\0"
+    "AL Task/Project Manager\0"
+    "AL Log/Journal/Timecard\0"
+    "AL Checkbook/Finance\0"
+    "AL Calculator\0"
+    "AL A/V Capture/Playback\0"
+    "AL Local Machine Browser\0"
+    "AL LAN/WAN Browser\0"
+    "AL Internet Browser\0"
+    "AL Remote Networking/ISP Connect\0"
+    "AL Network Conference\0"
+    "AL Network Chat\0"
+    "AL Telephony/Dialer\0"
+    "AL Logon\0"
+    "AL Logoff\0"
+    "AL Logon/Logoff\0"
+    "AL Terminal Lock/Screensaver\0"
+    "AL Control Panel\0"
+    "AL Command Line Processor/Run\0"
+    "AL Process/Task Manager\0"
+    "AL Select Task/Application\0"
+    "AL Next Task/Application\0"
+    "AL Previous Task/Application\0"
+    "AL Preemptive Halt Task/Application\0"
+    "AL Integrated Help Center\0"
+    "AL Documents\0"
+    "AL Thesaurus\0"
+    "AL Dictionary\0"
+    "AL Desktop\0"
+    "AL Spell Check\0"
+    "AL Grammar Check\0"
+    "AL Wireless Status\0"
+    "AL Keyboard Layout\0"
+    "AL Virus Protection\0"
+    "AL Encryption\0"
+    "AL Screen Saver\0"
+    "AL Alarms\0"
+    "AL Clock\0"
+    "AL File Browser\0"
+    "AL Power Status\0"
+    "AL Image Browser\0"
+    "AL Audio Browser\0"
+    "AL Movie Browser\0"
+    "AL Digital Rights Manager\0"
+    "AL Digital Wallet\0"
+    "AL Instant Messaging\0"
+    "AL OEM Features/ Tips/Tutorial Browser\0"
+    "AL OEM Help\0"
+    "AL Online Community\0"
+    "AL Entertainment Content Browser\0"
+    "AL Online Shopping Browser\0"
+    "AL SmartCard Information/Help\0"
+    "AL Market Monitor/Finance Browser\0"
+    "AL Customized Corporate News Browser\0"
+    "AL Online Activity Browser\0"
+    "AL Research/Search Browser\0"
+    "AL Audio Player\0"
+    "AL Message Status\0"
+    "AL Contact Sync\0"
+    "AL Navigation\0"
+    "AL Context\342\200\220aware Desktop Assistant\0"
+    "Generic GUI Application Controls\0"
+    "AC New\0"
+    "AC Open\0"
+    "AC Close\0"
+    "AC Exit\0"
+    "AC Maximize\0"
+    "AC Minimize\0"
+    "AC Save\0"
+    "AC Print\0"
+    "AC Properties\0"
+    "AC Undo\0"
+    "AC Copy\0"
+    "AC Cut\0"
+    "AC Paste\0"
+    "AC Select All\0"
+    "AC Find\0"
+    "AC Find and Replace\0"
+    "AC Search\0"
+    "AC Go To\0"
+    "AC Home\0"
+    "AC Back\0"
+    "AC Forward\0"
+    "AC Stop\0"
+    "AC Refresh\0"
+    "AC Previous Link\0"
+    "AC Next Link\0"
+    "AC Bookmarks\0"
+    "AC History\0"
+    "AC Subscriptions\0"
+    "AC Zoom In\0"
+    "AC Zoom Out\0"
+    "AC Zoom\0"
+    "AC Full Screen View\0"
+    "AC Normal View\0"
+    "AC View Toggle\0"
+    "AC Scroll Up\0"
+    "AC Scroll Down\0"
+    "AC Scroll\0"
+    "AC Pan Left\0"
+    "AC Pan Right\0"
+    "AC Pan\0"
+    "AC New Window\0"
+    "AC Tile Horizontally\0"
+    "AC Tile Vertically\0"
+    "AC Format\0"
+    "AC Edit\0"
+    "AC Bold\0"
+    "AC Italics\0"
+    "AC Underline\0"
+    "AC Strikethrough\0"
+    "AC Subscript\0"
+    "AC Superscript\0"
+    "AC All Caps\0"
+    "AC Rotate\0"
+    "AC Resize\0"
+    "AC Flip Horizontal\0"
+    "AC Flip Vertical\0"
+    "AC Mirror Horizontal\0"
+    "AC Mirror Vertical\0"
+    "AC Font Select\0"
+    "AC Font Color\0"
+    "AC Font Size\0"
+    "AC Justify Left\0"
+    "AC Justify Center H\0"
+    "AC Justify Right\0"
+    "AC Justify Block H\0"
+    "AC Justify Top\0"
+    "AC Justify Center V\0"
+    "AC Justify Bottom\0"
+    "AC Justify Block V\0"
+    "AC Indent Decrease\0"
+    "AC Indent Increase\0"
+    "AC Numbered List\0"
+    "AC Restart Numbering\0"
+    "AC Bulleted List\0"
+    "AC Promote\0"
+    "AC Demote\0"
+    "AC Yes\0"
+    "AC No\0"
+    "AC Cancel\0"
+    "AC Catalog\0"
+    "AC Buy/Checkout\0"
+    "AC Add to Cart\0"
+    "AC Expand\0"
+    "AC Expand All\0"
+    "AC Collapse\0"
+    "AC Collapse All\0"
+    "AC Print Preview\0"
+    "AC Paste Special\0"
+    "AC Insert Mode\0"
+    "AC Delete\0"
+    "AC Lock\0"
+    "AC Unlock\0"
+    "AC Protect\0"
+    "AC Unprotect\0"
+    "AC Attach Comment\0"
+    "AC Delete Comment\0"
+    "AC View Comment\0"
+    "AC Select Word\0"
+    "AC Select Sentence\0"
+    "AC Select Paragraph\0"
+    "AC Select Column\0"
+    "AC Select Row\0"
+    "AC Select Table\0"
+    "AC Select Object\0"
+    "AC Redo/Repeat\0"
+    "AC Sort\0"
+    "AC Sort Ascending\0"
+    "AC Sort Descending\0"
+    "AC Filter\0"
+    "AC Set Clock\0"
+    "AC View Clock\0"
+    "AC Select Time Zone\0"
+    "AC Edit Time Zones\0"
+    "AC Set Alarm\0"
+    "AC Clear Alarm\0"
+    "AC Snooze Alarm\0"
+    "AC Reset Alarm\0"
+    "AC Synchronize\0"
+    "AC Send/Receive\0"
+    "AC Send To\0"
+    "AC Reply\0"
+    "AC Reply All\0"
+    "AC Forward Msg\0"
+    "AC Send\0"
+    "AC Attach File\0"
+    "AC Upload\0"
+    "AC Download (Save Target As)\0"
+    "AC Set Borders\0"
+    "AC Insert Row\0"
+    "AC Insert Column\0"
+    "AC Insert File\0"
+    "AC Insert Picture\0"
+    "AC Insert Object\0"
+    "AC Insert Symbol\0"
+    "AC Save and Close\0"
+    "AC Rename\0"
+    "AC Merge\0"
+    "AC Split\0"
+    "AC Disribute Horizontally\0"
+    "AC Distribute Vertically\0"
+    "AC Next Keyboard Layout Select\0"
+    "AC Navigation Guidance\0"
+    "AC Desktop Show All Windows\0"
+    "AC Soft Key Left\0"
+    "AC Soft Key Right\0"
+    "AC Desktop Show All Applications\0"
+    "AC Idle Keep Alive\0"
+    "Extended Keyboard Attributes Collection\0"
+    "Keyboard Form Factor\0"
+    "Keyboard Key Type\0"
+    "Keyboard Physical Layout\0"
+    "Vendor\342\200\220Specific Keyboard Physical Layout\0"
+    "Keyboard IETF Language Tag Index\0"
+    "Implemented Keyboard Input Assist Controls\0"
+    "Keyboard Input Assist Previous\0"
+    "Keyboard Input Assist Next\0"
+    "Keyboard Input Assist Previous Group\0"
+    "Keyboard Input Assist Next Group\0"
+    "Keyboard Input Assist Accept\0"
+    "Keyboard Input Assist Cancel\0"
+    "Privacy Screen Toggle\0"
+    "Privacy Screen Level Decrement\0"
+    "Privacy Screen Level Increment\0"
+    "Privacy Screen Level Minimum\0"
+    "Privacy Screen Level Maximum\0"
+    "Contact Edited\0"
+    "Contact Added\0"
+    "Contact Record Active\0"
+    "Contact Index\0"
+    "Contact Nickname\0"
+    "Contact First Name\0"
+    "Contact Last Name\0"
+    "Contact Full Name\0"
+    "Contact Phone Number Personal\0"
+    "Contact Phone Number Business\0"
+    "Contact Phone Number Mobile\0"
+    "Contact Phone Number Pager\0"
+    "Contact Phone Number Fax\0"
+    "Contact Phone Number Other\0"
+    "Contact Email Personal\0"
+    "Contact Email Business\0"
+    "Contact Email Other\0"
+    "Contact Email Main\0"
+    "Contact Speed Dial Number\0"
+    "Contact Status Flag\0"
+    "Contact Misc.\0"
+    "Digitizers\0"
+    "Digitizer\0"
+    "Pen\0"
+    "Light Pen\0"
+    "Touch Screen\0"
+    "Touch Pad\0"
+    "Whiteboard\0"
+    "Coordinate Measuring Machine\0"
+    "3D Digitizer\0"
+    "Stereo Plotter\0"
+    "Articulated Arm\0"
+    "Armature\0"
+    "Multiple Point Digitizer\0"
+    "Free Space Wand\0"
+    "Device Configuration\0"
+    "Capacitive Heat Map Digitizer\0"
+    "Stylus\0"
+    "Puck\0"
+    "Finger\0"
+    "Device settings\0"
+    "Character Gesture\0"
+    "Tip Pressure\0"
+    "Barrel Pressure\0"
+    "In Range\0"
+    "Touch\0"
+    "Untouch\0"
+    "Tap\0"
+    "Quality\0"
+    "Data Valid\0"
+    "Transducer Index\0"
+    "Tablet Function Keys\0"
+    "Program Change Keys\0"
+    "Invert\0"
+    "X Tilt\0"
+    "Y Tilt\0"
+    "Azimuth\0"
+    "Altitude\0"
+    "Twist\0"
+    "Tip Switch\0"
+    "Secondary Tip Switch\0"
+    "Barrel Switch\0"
+    "Eraser\0"
+    "Tablet Pick\0"
+    "Touch Valid\0"
+    "Width\0"
+    "Height\0"
+    "Contact Identifier\0"
+    "Device Mode\0"
+    "Device Identifier\0"
+    "Contact Count\0"
+    "Contact Count Maximum\0"
+    "Scan Time\0"
+    "Surface Switch\0"
+    "Button Switch\0"
+    "Pad Type\0"
+    "Secondary Barrel Switch\0"
+    "Transducer Serial Number\0"
+    "Preferred Color\0"
+    "Preferred Color is Locked\0"
+    "Preferred Line Width\0"
+    "Preferred Line Width is Locked\0"
+    "Latency Mode\0"
+    "Gesture Character Quality\0"
+    "Character Gesture Data Length\0"
+    "Character Gesture Data\0"
+    "Gesture Character Encoding\0"
+    "UTF8 Character Gesture Encoding\0"
+    "UTF16 Little Endian Character Gesture Encoding\0"
+    "UTF16 Big Endian Character Gesture Encoding\0"
+    "UTF32 Little Endian Character Gesture Encoding\0"
+    "UTF32 Big Endian Character Gesture Encoding\0"
+    "Capacitive Heat Map Protocol Vendor ID\0"
+    "Capacitive Heat Map Protocol Version\0"
+    "Capacitive Heat Map Frame Data\0"
+    "Gesture Character Enable\0"
+    "Transducer Serial Number Part 2\0"
+    "No Preferred Color\0"
+    "Preferred Line Style\0"
+    "Preferred Line Style is Locked\0"
+    "Ink\0"
+    "Pencil\0"
+    "Highlighter\0"
+    "Chisel Marker\0"
+    "Brush\0"
+    "No Preference\0"
+    "Digitizer Diagnostic\0"
+    "Digitizer Error\0"
+    "Err Normal Status\0"
+    "Err Transducers Exceeded\0"
+    "Err Full Trans Features Unavailable\0"
+    "Err Charge Low\0"
+    "Transducer Software Info\0"
+    "Transducer Vendor Id\0"
+    "Transducer Product Id\0"
+    "Device Supported Protocols\0"
+    "Transducer Supported Protocols\0"
+    "No Protocol\0"
+    "Wacom AES Protocol\0"
+    "USI Protocol\0"
+    "Microsoft Pen Protocol\0"
+    "Supported Report Rates\0"
+    "Report Rate\0"
+    "Transducer Connected\0"
+    "Switch Disabled\0"
+    "Switch Unimplemented\0"
+    "Transducer Switches\0"
+    "Transducer Index Selector\0"
+    "Button Press Threshold\0"
+    "Haptics\0"
+    "Simple Haptic Controller\0"
+    "Waveform List\0"
+    "Duration List\0"
+    "Auto Trigger\0"
+    "Manual Trigger\0"
+    "Auto Trigger Associated Control\0"
+    "Intensity\0"
+    "Repeat Count\0"
+    "Retrigger Period\0"
+    "Waveform Vendor Page\0"
+    "Waveform Vendor ID\0"
+    "Waveform Cutoff Time\0"
+    "Waveform None\0"
+    "Waveform Stop\0"
+    "Waveform Click\0"
+    "Waveform Buzz Continuous\0"
+    "Waveform Rumble Continuous\0"
+    "Waveform Press\0"
+    "Waveform Release\0"
+    "Waveform Hover\0"
+    "Waveform Success\0"
+    "Waveform Error\0"
+    "Waveform Ink Continuous\0"
+    "Waveform Pencil Continuous\0"
+    "Waveform Marker Continuous\0"
+    "Waveform Chisel Marker Continuous\0"
+    "Waveform Brush Continuous\0"
+    "Waveform Eraser Continuous\0"
+    "Waveform Sparkle Continuous\0"
+    "Physical Input Device\0"
+    "Normal\0"
+    "Set Effect Report\0"
+    "Effect Parameter Block Index\0"
+    "Parameter Block Offset\0"
+    "ROM Flag\0"
+    "Effect Type\0"
+    "ET Constant-Force\0"
+    "ET Ramp\0"
+    "ET Custom-Force\0"
+    "ET Square\0"
+    "ET Sine\0"
+    "ET Triangle\0"
+    "ET Sawtooth Up\0"
+    "ET Sawtooth Down\0"
+    "ET Spring\0"
+    "ET Damper\0"
+    "ET Inertia\0"
+    "ET Friction\0"
+    "Duration\0"
+    "Sample Period\0"
+    "Gain\0"
+    "Trigger Button\0"
+    "Trigger Repeat Interval\0"
+    "Axes Enable\0"
+    "Direction Enable\0"
+    "Direction\0"
+    "Type Specific Block Offset\0"
+    "Block Type\0"
+    "Set Envelope Report\0"
+    "Attack Level\0"
+    "Attack Time\0"
+    "Fade Level\0"
+    "Fade Time\0"
+    "Set Condition Report\0"
+    "Center-Point Offset\0"
+    "Positive Coefficient\0"
+    "Negative Coefficient\0"
+    "Positive Saturation\0"
+    "Negative Saturation\0"
+    "Dead Band\0"
+    "Download Force Sample\0"
+    "Isoch Custom-Force Enable\0"
+    "Custom-Force Data Report\0"
+    "Custom-Force Data\0"
+    "Custom-Force Vendor Defined Data\0"
+    "Set Custom-Force Report\0"
+    "Custom-Force Data Offset\0"
+    "Sample Count\0"
+    "Set Periodic Report\0"
+    "Offset\0"
+    "Magnitude\0"
+    "Phase\0"
+    "Period\0"
+    "Set Constant-Force Report\0"
+    "Set Ramp-Force Report\0"
+    "Ramp Start\0"
+    "Ramp End\0"
+    "Effect Operation Report\0"
+    "Effect Operation\0"
+    "Op Effect Start\0"
+    "Op Effect Start Solo\0"
+    "Op Effect Stop\0"
+    "Loop Count\0"
+    "Device Gain Report\0"
+    "Device Gain\0"
+    "Parameter Block Pools Report\0"
+    "RAM Pool Size\0"
+    "ROM Pool Size\0"
+    "ROM Effect Block Count\0"
+    "Simultaneous Effects Max\0"
+    "Pool Alignment\0"
+    "Parameter Block Move Report\0"
+    "Move Source\0"
+    "Move Destination\0"
+    "Move Length\0"
+    "Effect Parameter Block Load Report\0"
+    "Effect Parameter Block Load Status\0"
+    "Block Load Success\0"
+    "Block Load Full\0"
+    "Block Load Error\0"
+    "Block Handle\0"
+    "Effect Parameter Block Free Report\0"
+    "Type Specific Block Handle\0"
+    "PID State Report\0"
+    "Effect Playing\0"
+    "PID Device Control Report\0"
+    "PID Device Control\0"
+    "DC Enable Actuators\0"
+    "DC Disable Actuators\0"
+    "DC Stop All Effects\0"
+    "DC Reset\0"
+    "DC Pause\0"
+    "DC Continue\0"
+    "Device Paused\0"
+    "Actuators Enabled\0"
+    "Safety Switch\0"
+    "Actuator Override Switch\0"
+    "Actuator Power\0"
+    "Start Delay\0"
+    "Parameter Block Size\0"
+    "Device-Managed Pool\0"
+    "Shared Parameter Blocks\0"
+    "Create New Effect Parameter Block Report\0"
+    "RAM Pool Available\0"
+    "SoC\0"
+    "SocControl\0"
+    "FirmwareTransfer\0"
+    "FirmwareFileId\0"
+    "FileOffsetInBytes\0"
+    "FileTransferSizeMaxInBytes\0"
+    "FilePayload\0"
+    "FilePayloadSizeInBytes\0"
+    "FilePayloadContainsLastBytes\0"
+    "FileTransferStop\0"
+    "FileTransferTillEnd\0"
+    "Eye and Head Trackers\0"
+    "Eye Tracker\0"
+    "Tracking Data\0"
+    "Capabilities\0"
+    "Configuration\0"
+    "Status\0"
+    "Control\0"
+    "Sensor Timestamp\0"
+    "Position X\0"
+    "Position Y\0"
+    "Position Z\0"
+    "Gaze Point\0"
+    "Left Eye Position\0"
+    "Right Eye Position\0"
+    "Head Position\0"
+    "Head Direction Point\0"
+    "Rotation about X axis\0"
+    "Rotation about Y axis\0"
+    "Rotation about Z axis\0"
+    "Tracker Quality\0"
+    "Minimum Tracking Distance\0"
+    "Optimum Tracking Distance\0"
+    "Maximum Tracking Distance\0"
+    "Maximum Screen Plane Width\0"
+    "Maximum Screen Plane Height\0"
+    "Display Manufacturer ID\0"
+    "Display Product ID\0"
+    "Display Serial Number\0"
+    "Display Manufacturer Date\0"
+    "Calibrated Screen Width\0"
+    "Calibrated Screen Height\0"
+    "Sampling Frequency\0"
+    "Configuration Status\0"
+    "Device Mode Request\0"
+    "Auxiliary Display\0"
+    "Alphanumeric Display\0"
+    "Display Attributes Report\0"
+    "ASCII Character Set\0"
+    "Data Read Back\0"
+    "Font Read Back\0"
+    "Display Control Report\0"
+    "Clear Display\0"
+    "Screen Saver Delay\0"
+    "Screen Saver Enable\0"
+    "Vertical Scroll\0"
+    "Horizontal Scroll\0"
+    "Character Report\0"
+    "Display Data\0"
+    "Display Status\0"
+    "Stat Not Ready\0"
+    "Stat Ready\0"
+    "Err Not a loadable character\0"
+    "Err Font data cannot be read\0"
+    "Cursor Position Report\0"
+    "Row\0"
+    "Column\0"
+    "Rows\0"
+    "Columns\0"
+    "Cursor Pixel Positioning\0"
+    "Cursor Mode\0"
+    "Cursor Enable\0"
+    "Cursor Blink\0"
+    "Font Report\0"
+    "Font Data\0"
+    "Character Width\0"
+    "Character Height\0"
+    "Character Spacing Horizontal\0"
+    "Character Spacing Vertical\0"
+    "Unicode Character Set\0"
+    "Font 7-Segment\0"
+    "7-Segment Direct Map\0"
+    "Font 14-Segment\0"
+    "14-Segment Direct Map\0"
+    "Display Contrast\0"
+    "Character Attribute\0"
+    "Attribute Readback\0"
+    "Attribute Data\0"
+    "Char Attr Enhance\0"
+    "Char Attr Underline\0"
+    "Char Attr Blink\0"
+    "Bitmap Size X\0"
+    "Bitmap Size Y\0"
+    "Max Blit Size\0"
+    "Bit Depth Format\0"
+    "Display Orientation\0"
+    "Palette Report\0"
+    "Palette Data Size\0"
+    "Palette Data Offset\0"
+    "Palette Data\0"
+    "Blit Report\0"
+    "Blit Rectangle X1\0"
+    "Blit Rectangle Y1\0"
+    "Blit Rectangle X2\0"
+    "Blit Rectangle Y2\0"
+    "Blit Data\0"
+    "Soft Button\0"
+    "Soft Button ID\0"
+    "Soft Button Side\0"
+    "Soft Button Offset 1\0"
+    "Soft Button Offset 2\0"
+    "Soft Button Report\0"
+    "Soft Keys\0"
+    "Display Data Extensions\0"
+    "Character Mapping\0"
+    "Unicode Equivalent\0"
+    "Character Page Mapping\0"
+    "Request Report\0"
+    "Sensors\0"
+    "Sensor\0"
+    "Biometric\0"
+    "Biometric: Human Presence\0"
+    "Biometric: Human Proximity\0"
+    "Biometric: Human Touch\0"
+    "Biometric: Blood Pressure\0"
+    "Biometric: Body Temperature\0"
+    "Biometric: Heart Rate\0"
+    "Biometric: Heart Rate Variability\0"
+    "Biometric: Peripheral Oxygen Saturation\0"
+    "Biometric: Respiratory Rate\0"
+    "Electrical\0"
+    "Electrical: Capacitance\0"
+    "Electrical: Current\0"
+    "Electrical: Power\0"
+    "Electrical: Inductance\0"
+    "Electrical: Resistance\0"
+    "Electrical: Voltage\0"
+    "Electrical: Potentiometer\0"
+    "Electrical: Frequency\0"
+    "Electrical: Period\0"
+    "Environmental\0"
+    "Environmental: Atmospheric Pressure\0"
+    "Environmental: Humidity\0"
+    "Environmental: Temperature\0"
+    "Environmental: Wind Direction\0"
+    "Environmental: Wind Speed\0"
+    "Environmental: Air Quality\0"
+    "Environmental: Heat Index\0"
+    "Environmental: Surface Temperature\0"
+    "Environmental: Volatile Organic Compounds\0"
+    "Environmental: Object Presence\0"
+    "Environmental: Object Proximity\0"
+    "Light\0"
+    "Light: Ambient Light\0"
+    "Light: Consumer Infrared\0"
+    "Light: Infrared Light\0"
+    "Light: Visible Light\0"
+    "Light: Ultraviolet Light\0"
+    "Location\0"
+    "Location: Broadcast\0"
+    "Location: Dead Reckoning\0"
+    "Location: GPS (Global Positioning System)\0"
+    "Location: Lookup\0"
+    "Location: Other\0"
+    "Location: Static\0"
+    "Location: Triangulation\0"
+    "Mechanical\0"
+    "Mechanical: Boolean Switch\0"
+    "Mechanical: Boolean Switch Array\0"
+    "Mechanical: Multivalue Switch\0"
+    "Mechanical: Force\0"
+    "Mechanical: Pressure\0"
+    "Mechanical: Strain\0"
+    "Mechanical: Weight\0"
+    "Mechanical: Haptic Vibrator\0"
+    "Mechanical: Hall Effect Switch\0"
+    "Motion: Accelerometer 1D\0"
+    "Motion: Accelerometer 2D\0"
+    "Motion: Accelerometer 3D\0"
+    "Motion: Gyrometer 1D\0"
+    "Motion: Gyrometer 2D\0"
+    "Motion: Gyrometer 3D\0"
+    "Motion: Motion Detector\0"
+    "Motion: Speedometer\0"
+    "Motion: Accelerometer\0"
+    "Motion: Gyrometer\0"
+    "Motion: Gravity Vector\0"
+    "Motion: Linear Accelerometer\0"
+    "Orientation\0"
+    "Orientation: Compass 1D\0"
+    "Orientation: Compass 2D\0"
+    "Orientation: Compass 3D\0"
+    "Orientation: Inclinometer 1D\0"
+    "Orientation: Inclinometer 2D\0"
+    "Orientation: Inclinometer 3D\0"
+    "Orientation: Distance 1D\0"
+    "Orientation: Distance 2D\0"
+    "Orientation: Distance 3D\0"
+    "Orientation: Device Orientation\0"
+    "Orientation: Compass\0"
+    "Orientation: Inclinometer\0"
+    "Orientation: Distance\0"
+    "Orientation: Relative Orientation\0"
+    "Orientation: Simple Orientation\0"
+    "Scanner\0"
+    "Scanner: Barcode\0"
+    "Scanner: RFID\0"
+    "Scanner: NFC\0"
+    "Time\0"
+    "Time: Alarm Timer\0"
+    "Time: Real Time Clock\0"
+    "Personal Activity\0"
+    "Personal Activity: Activity Detection\0"
+    "Personal Activity: Device Position\0"
+    "Personal Activity: Pedometer\0"
+    "Personal Activity: Step Detection\0"
+    "Orientation Extended\0"
+    "Orientation Extended: Geomagnetic Orientation\0"
+    "Orientation Extended: Magnetometer\0"
+    "Gesture\0"
+    "Gesture: Chassis Flip Gesture\0"
+    "Gesture: Hinge Fold Gesture\0"
+    "Other\0"
+    "Other: Custom\0"
+    "Other: Generic\0"
+    "Other: Generic Enumerator\0"
+    "Other: Hinge Angle\0"
+    "Vendor Reserved 1\0"
+    "Vendor Reserved 2\0"
+    "Vendor Reserved 3\0"
+    "Vendor Reserved 4\0"
+    "Vendor Reserved 5\0"
+    "Vendor Reserved 6\0"
+    "Vendor Reserved 7\0"
+    "Vendor Reserved 8\0"
+    "Vendor Reserved 9\0"
+    "Vendor Reserved 10\0"
+    "Vendor Reserved 11\0"
+    "Vendor Reserved 12\0"
+    "Vendor Reserved 13\0"
+    "Vendor Reserved 14\0"
+    "Vendor Reserved 15\0"
+    "Vendor Reserved 16\0"
+    "Event\0"
+    "Event: Sensor State\0"
+    "Event: Sensor Event\0"
+    "Property\0"
+    "Property: Friendly Name\0"
+    "Property: Persistent Unique ID\0"
+    "Property: Sensor Status\0"
+    "Property: Minimum Report Interval\0"
+    "Property: Sensor Manufacturer\0"
+    "Property: Sensor Model\0"
+    "Property: Sensor Serial Number\0"
+    "Property: Sensor Description\0"
+    "Property: Sensor Connection Type\0"
+    "Property: Sensor Device Path\0"
+    "Property: Hardware Revision\0"
+    "Property: Firmware Version\0"
+    "Property: Release Date\0"
+    "Property: Report Interval\0"
+    "Property: Change Sensitivity Absolute\0"
+    "Property: Change Sensitivity Percent of Range\0"
+    "Property: Change Sensitivity Percent Relative\0"
+    "Property: Accuracy\0"
+    "Property: Resolution\0"
+    "Property: Maximum\0"
+    "Property: Minimum\0"
+    "Property: Reporting State\0"
+    "Property: Sampling Rate\0"
+    "Property: Response Curve\0"
+    "Property: Power State\0"
+    "Property: Maximum FIFO Events\0"
+    "Property: Report Latency\0"
+    "Property: Flush FIFO Events\0"
+    "Property: Maximum Power Consumption\0"
+    "Property: Is Primary\0"
+    "Property: Human Presence Detection Type\0"
+    "Data Field: Location\0"
+    "Data Field: Altitude Antenna Sea Level\0"
+    "Data Field: Differential Reference Station ID\0"
+    "Data Field: Altitude Ellipsoid Error\0"
+    "Data Field: Altitude Ellipsoid\0"
+    "Data Field: Altitude Sea Level Error\0"
+    "Data Field: Altitude Sea Level\0"
+    "Data Field: Differential GPS Data Age\0"
+    "Data Field: Error Radius\0"
+    "Data Field: Fix Quality\0"
+    "Data Field: Fix Type\0"
+    "Data Field: Geoidal Separation\0"
+    "Data Field: GPS Operation Mode\0"
+    "Data Field: GPS Selection Mode\0"
+    "Data Field: GPS Status\0"
+    "Data Field: Position Dilution of Precision\0"
+    "Data Field: Horizontal Dilution of Precision\0"
+    "Data Field: Vertical Dilution of Precision\0"
+    "Data Field: Latitude\0"
+    "Data Field: Longitude\0"
+    "Data Field: True Heading\0"
+    "Data Field: Magnetic Heading\0"
+    "Data Field: Magnetic Variation\0"
+    "Data Field: Speed\0"
+    "Data Field: Satellites in View\0"
+    "Data Field: Satellites in View Azimuth\0"
+    "Data Field: Satellites in View Elevation\0"
+    "Data Field: Satellites in View IDs\0"
+    "Data Field: Satellites in View PRNs\0"
+    "Data Field: Satellites in View S/N Ratios\0"
+    "Data Field: Satellites Used Count\0"
+    "Data Field: Satellites Used PRNs\0"
+    "Data Field: NMEA Sentence\0"
+    "Data Field: Address Line 1\0"
+    "Data Field: Address Line 2\0"
+    "Data Field: City\0"
+    "Data Field: State or Province\0"
+    "Data Field: Country or Region\0"
+    "Data Field: Postal Code\0"
+    "Property: Location\0"
+    "Property: Location Desired Accuracy\0"
+    "Data Field: Environmental\0"
+    "Data Field: Atmospheric Pressure\0"
+    "Data Field: Relative Humidity\0"
+    "Data Field: Temperature\0"
+    "Data Field: Wind Direction\0"
+    "Data Field: Wind Speed\0"
+    "Data Field: Air Quality Index\0"
+    "Data Field: Equivalent CO2\0"
+    "Data Field: Volatile Organic Compound Concentration\0"
+    "Data Field: Object Presence\0"
+    "Data Field: Object Proximity Range\0"
+    "Data Field: Object Proximity Out of Range\0"
+    "Property: Environmental\0"
+    "Property: Reference Pressure\0"
+    "Data Field: Motion\0"
+    "Data Field: Motion State\0"
+    "Data Field: Acceleration\0"
+    "Data Field: Acceleration Axis X\0"
+    "Data Field: Acceleration Axis Y\0"
+    "Data Field: Acceleration Axis Z\0"
+    "Data Field: Angular Velocity\0"
+    "Data Field: Angular Velocity about X Axis\0"
+    "Data Field: Angular Velocity about Y Axis\0"
+    "Data Field: Angular Velocity about Z Axis\0"
+    "Data Field: Angular Position\0"
+    "Data Field: Angular Position about X Axis\0"
+    "Data Field: Angular Position about Y Axis\0"
+    "Data Field: Angular Position about Z Axis\0"
+    "Data Field: Motion Speed\0"
+    "Data Field: Motion Intensity\0"
+    "Data Field: Orientation\0"
+    "Data Field: Heading\0"
+    "Data Field: Heading X Axis\0"
+    "Data Field: Heading Y Axis\0"
+    "Data Field: Heading Z Axis\0"
+    "Data Field: Heading Compensated Magnetic North\0"
+    "Data Field: Heading Compensated True North\0"
+    "Data Field: Heading Magnetic North\0"
+    "Data Field: Heading True North\0"
+    "Data Field: Distance\0"
+    "Data Field: Distance X Axis\0"
+    "Data Field: Distance Y Axis\0"
+    "Data Field: Distance Z Axis\0"
+    "Data Field: Distance Out-of-Range\0"
+    "Data Field: Tilt\0"
+    "Data Field: Tilt X Axis\0"
+    "Data Field: Tilt Y Axis\0"
+    "Data Field: Tilt Z Axis\0"
+    "Data Field: Rotation Matrix\0"
+    "Data Field: Quaternion\0"
+    "Data Field: Magnetic Flux\0"
+    "Data Field: Magnetic Flux X Axis\0"
+    "Data Field: Magnetic Flux Y Axis\0"
+    "Data Field: Magnetic Flux Z Axis\0"
+    "Data Field: Magnetometer Accuracy\0"
+    "Data Field: Simple Orientation Direction\0"
+    "Data Field: Mechanical\0"
+    "Data Field: Boolean Switch State\0"
+    "Data Field: Boolean Switch Array States\0"
+    "Data Field: Multivalue Switch Value\0"
+    "Data Field: Force\0"
+    "Data Field: Absolute Pressure\0"
+    "Data Field: Gauge Pressure\0"
+    "Data Field: Strain\0"
+    "Data Field: Weight\0"
+    "Property: Mechanical\0"
+    "Property: Vibration State\0"
+    "Property: Forward Vibration Speed\0"
+    "Property: Backward Vibration Speed\0"
+    "Data Field: Biometric\0"
+    "Data Field: Human Presence\0"
+    "Data Field: Human Proximity Range\0"
+    "Data Field: Human Proximity Out of Range\0"
+    "Data Field: Human Touch State\0"
+    "Data Field: Blood Pressure\0"
+    "Data Field: Blood Pressure Diastolic\0"
+    "Data Field: Blood Pressure Systolic\0"
+    "Data Field: Heart Rate\0"
+    "Data Field: Resting Heart Rate\0"
+    "Data Field: Heartbeat Interval\0"
+    "Data Field: Respiratory Rate\0"
+    "Data Field: SpO2\0"
+    "Data Field: Human Attention Detected\0"
+    "Data Field: Light\0"
+    "Data Field: Illuminance\0"
+    "Data Field: Color Temperature\0"
+    "Data Field: Chromaticity\0"
+    "Data Field: Chromaticity X\0"
+    "Data Field: Chromaticity Y\0"
+    "Data Field: Consumer IR Sentence Receive\0"
+    "Data Field: Infrared Light\0"
+    "Data Field: Red Light\0"
+    "Data Field: Green Light\0"
+    "Data Field: Blue Light\0"
+    "Data Field: Ultraviolet A Light\0"
+    "Data Field: Ultraviolet B Light\0"
+    "Data Field: Ultraviolet Index\0"
+    "Data Field: Near Infrared Light\0"
+    "Property: Light\0"
+    "Property: Consumer IR Sentence Send\0"
+    "Property: Auto Brightness Preferred\0"
+    "Property: Auto Color Preferred\0"
+    "Data Field: Scanner\0"
+    "Data Field: RFID Tag 40 Bit\0"
+    "Data Field: NFC Sentence Receive\0"
+    "Property: Scanner\0"
+    "Property: NFC Sentence Send\0"
+    "Data Field: Electrical\0"
+    "Data Field: Capacitance\0"
+    "Data Field: Current\0"
+    "Data Field: Electrical Power\0"
+    "Data Field: Inductance\0"
+    "Data Field: Resistance\0"
+    "Data Field: Voltage\0"
+    "Data Field: Frequency\0"
+    "Data Field: Period\0"
+    "Data Field: Percent of Range\0"
+    "Data Field: Time\0"
+    "Data Field: Year\0"
+    "Data Field: Month\0"
+    "Data Field: Day\0"
+    "Data Field: Day of Week\0"
+    "Data Field: Hour\0"
+    "Data Field: Minute\0"
+    "Data Field: Second\0"
+    "Data Field: Millisecond\0"
+    "Data Field: Timestamp\0"
+    "Data Field: Julian Day of Year\0"
+    "Data Field: Time Since System Boot\0"
+    "Property: Time\0"
+    "Property: Time Zone Offset from UTC\0"
+    "Property: Time Zone Name\0"
+    "Property: Daylight Savings Time Observed\0"
+    "Property: Time Trim Adjustment\0"
+    "Property: Arm Alarm\0"
+    "Data Field: Custom\0"
+    "Data Field: Custom Usage\0"
+    "Data Field: Custom Boolean Array\0"
+    "Data Field: Custom Value\0"
+    "Data Field: Custom Value 1\0"
+    "Data Field: Custom Value 2\0"
+    "Data Field: Custom Value 3\0"
+    "Data Field: Custom Value 4\0"
+    "Data Field: Custom Value 5\0"
+    "Data Field: Custom Value 6\0"
+    "Data Field: Custom Value 7\0"
+    "Data Field: Custom Value 8\0"
+    "Data Field: Custom Value 9\0"
+    "Data Field: Custom Value 10\0"
+    "Data Field: Custom Value 11\0"
+    "Data Field: Custom Value 12\0"
+    "Data Field: Custom Value 13\0"
+    "Data Field: Custom Value 14\0"
+    "Data Field: Custom Value 15\0"
+    "Data Field: Custom Value 16\0"
+    "Data Field: Custom Value 17\0"
+    "Data Field: Custom Value 18\0"
+    "Data Field: Custom Value 19\0"
+    "Data Field: Custom Value 20\0"
+    "Data Field: Custom Value 21\0"
+    "Data Field: Custom Value 22\0"
+    "Data Field: Custom Value 23\0"
+    "Data Field: Custom Value 24\0"
+    "Data Field: Custom Value 25\0"
+    "Data Field: Custom Value 26\0"
+    "Data Field: Custom Value 27\0"
+    "Data Field: Custom Value 28\0"
+    "Data Field: Generic\0"
+    "Data Field: Generic GUID or PROPERTYKEY\0"
+    "Data Field: Generic Category GUID\0"
+    "Data Field: Generic Type GUID\0"
+    "Data Field: Generic Event PROPERTYKEY\0"
+    "Data Field: Generic Property PROPERTYKEY\0"
+    "Data Field: Generic Data Field PROPERTYKEY\0"
+    "Data Field: Generic Event\0"
+    "Data Field: Generic Property\0"
+    "Data Field: Generic Data Field\0"
+    "Data Field: Enumerator Table Row Index\0"
+    "Data Field: Enumerator Table Row Count\0"
+    "Data Field: Generic GUID or PROPERTYKEY kind\0"
+    "Data Field: Generic GUID\0"
+    "Data Field: Generic PROPERTYKEY\0"
+    "Data Field: Generic Top Level Collection ID\0"
+    "Data Field: Generic Report ID\0"
+    "Data Field: Generic Report Item Position Index\0"
+    "Data Field: Generic Firmware VARTYPE\0"
+    "Data Field: Generic Unit of Measure\0"
+    "Data Field: Generic Unit Exponent\0"
+    "Data Field: Generic Report Size\0"
+    "Data Field: Generic Report Count\0"
+    "Property: Generic\0"
+    "Property: Enumerator Table Row Index\0"
+    "Property: Enumerator Table Row Count\0"
+    "Data Field: Personal Activity\0"
+    "Data Field: Activity Type\0"
+    "Data Field: Activity State\0"
+    "Data Field: Device Position\0"
+    "Data Field: Step Count\0"
+    "Data Field: Step Count Reset\0"
+    "Data Field: Step Duration\0"
+    "Data Field: Step Type\0"
+    "Property: Minimum Activity Detection Interval\0"
+    "Property: Supported Activity Types\0"
+    "Property: Subscribed Activity Types\0"
+    "Property: Supported Step Types\0"
+    "Property: Subscribed Step Types\0"
+    "Property: Floor Height\0"
+    "Data Field: Custom Type ID\0"
+    "Property: Custom\0"
+    "Property: Custom Value 1\0"
+    "Property: Custom Value 2\0"
+    "Property: Custom Value 3\0"
+    "Property: Custom Value 4\0"
+    "Property: Custom Value 5\0"
+    "Property: Custom Value 6\0"
+    "Property: Custom Value 7\0"
+    "Property: Custom Value 8\0"
+    "Property: Custom Value 9\0"
+    "Property: Custom Value 10\0"
+    "Property: Custom Value 11\0"
+    "Property: Custom Value 12\0"
+    "Property: Custom Value 13\0"
+    "Property: Custom Value 14\0"
+    "Property: Custom Value 15\0"
+    "Property: Custom Value 16\0"
+    "Data Field: Hinge\0"
+    "Data Field: Hinge Angle\0"
+    "Data Field: Gesture Sensor\0"
+    "Data Field: Gesture State\0"
+    "Data Field: Hinge Fold Initial Angle\0"
+    "Data Field: Hinge Fold Final Angle\0"
+    "Data Field: Hinge Fold Contributing Panel\0"
+    "Data Field: Hinge Fold Type\0"
+    "Sensor State: Undefined\0"
+    "Sensor State: Ready\0"
+    "Sensor State: Not Available\0"
+    "Sensor State: No Data\0"
+    "Sensor State: Initializing\0"
+    "Sensor State: Access Denied\0"
+    "Sensor State: Error\0"
+    "Sensor Event: Unknown\0"
+    "Sensor Event: State Changed\0"
+    "Sensor Event: Property Changed\0"
+    "Sensor Event: Data Updated\0"
+    "Sensor Event: Poll Response\0"
+    "Sensor Event: Change Sensitivity\0"
+    "Sensor Event: Range Maximum Reached\0"
+    "Sensor Event: Range Minimum Reached\0"
+    "Sensor Event: High Threshold Cross Upward\0"
+    "Sensor Event: High Threshold Cross Downward\0"
+    "Sensor Event: Low Threshold Cross Upward\0"
+    "Sensor Event: Low Threshold Cross Downward\0"
+    "Sensor Event: Zero Threshold Cross Upward\0"
+    "Sensor Event: Zero Threshold Cross Downward\0"
+    "Sensor Event: Period Exceeded\0"
+    "Sensor Event: Frequency Exceeded\0"
+    "Sensor Event: Complex Trigger\0"
+    "Connection Type: PC Integrated\0"
+    "Connection Type: PC Attached\0"
+    "Connection Type: PC External\0"
+    "Reporting State: Report No Events\0"
+    "Reporting State: Report All Events\0"
+    "Reporting State: Report Threshold Events\0"
+    "Reporting State: Wake On No Events\0"
+    "Reporting State: Wake On All Events\0"
+    "Reporting State: Wake On Threshold Events\0"
+    "Power State: Undefined\0"
+    "Power State: D0 Full Power\0"
+    "Power State: D1 Low Power\0"
+    "Power State: D2 Standby Power with Wakeup\0"
+    "Power State: D3 Sleep with Wakeup\0"
+    "Power State: D4 Power Off\0"
+    "Accuracy: Default\0"
+    "Accuracy: High\0"
+    "Accuracy: Medium\0"
+    "Accuracy: Low\0"
+    "Fix Quality: No Fix\0"
+    "Fix Quality: GPS\0"
+    "Fix Quality: DGPS\0"
+    "Fix Type: No Fix\0"
+    "Fix Type: GPS SPS Mode, Fix Valid\0"
+    "Fix Type: DGPS SPS Mode, Fix Valid\0"
+    "Fix Type: GPS PPS Mode, Fix Valid\0"
+    "Fix Type: Real Time Kinematic\0"
+    "Fix Type: Float RTK\0"
+    "Fix Type: Estimated (dead reckoned)\0"
+    "Fix Type: Manual Input Mode\0"
+    "Fix Type: Simulator Mode\0"
+    "GPS Operation Mode: Manual\0"
+    "GPS Operation Mode: Automatic\0"
+    "GPS Selection Mode: Autonomous\0"
+    "GPS Selection Mode: DGPS\0"
+    "GPS Selection Mode: Estimated (dead reckoned)\0"
+    "GPS Selection Mode: Manual Input\0"
+    "GPS Selection Mode: Simulator\0"
+    "GPS Selection Mode: Data Not Valid\0"
+    "GPS Status Data: Valid\0"
+    "GPS Status Data: Not Valid\0"
+    "Day of Week: Sunday\0"
+    "Day of Week: Monday\0"
+    "Day of Week: Tuesday\0"
+    "Day of Week: Wednesday\0"
+    "Day of Week: Thursday\0"
+    "Day of Week: Friday\0"
+    "Day of Week: Saturday\0"
+    "Kind: Category\0"
+    "Kind: Type\0"
+    "Kind: Event\0"
+    "Kind: Property\0"
+    "Kind: Data Field\0"
+    "Magnetometer Accuracy: Low\0"
+    "Magnetometer Accuracy: Medium\0"
+    "Magnetometer Accuracy: High\0"
+    "Simple Orientation Direction: Not Rotated\0"
+    "Simple Orientation Direction: Rotated 90 Degrees CCW\0"
+    "Simple Orientation Direction: Rotated 180 Degrees CCW\0"
+    "Simple Orientation Direction: Rotated 270 Degrees CCW\0"
+    "Simple Orientation Direction: Face Up\0"
+    "Simple Orientation Direction: Face Down\0"
+    "VT_NULL\0"
+    "VT_BOOL\0"
+    "VT_UI1\0"
+    "VT_I1\0"
+    "VT_UI2\0"
+    "VT_I2\0"
+    "VT_UI4\0"
+    "VT_I4\0"
+    "VT_UI8\0"
+    "VT_I8\0"
+    "VT_R4\0"
+    "VT_R8\0"
+    "VT_WSTR\0"
+    "VT_STR\0"
+    "VT_CLSID\0"
+    "VT_VECTOR VT_UI1\0"
+    "VT_F16E0\0"
+    "VT_F16E1\0"
+    "VT_F16E2\0"
+    "VT_F16E3\0"
+    "VT_F16E4\0"
+    "VT_F16E5\0"
+    "VT_F16E6\0"
+    "VT_F16E7\0"
+    "VT_F16E8\0"
+    "VT_F16E9\0"
+    "VT_F16EA\0"
+    "VT_F16EB\0"
+    "VT_F16EC\0"
+    "VT_F16ED\0"
+    "VT_F16EE\0"
+    "VT_F16EF\0"
+    "VT_F32E0\0"
+    "VT_F32E1\0"
+    "VT_F32E2\0"
+    "VT_F32E3\0"
+    "VT_F32E4\0"
+    "VT_F32E5\0"
+    "VT_F32E6\0"
+    "VT_F32E7\0"
+    "VT_F32E8\0"
+    "VT_F32E9\0"
+    "VT_F32EA\0"
+    "VT_F32EB\0"
+    "VT_F32EC\0"
+    "VT_F32ED\0"
+    "VT_F32EE\0"
+    "VT_F32EF\0"
+    "Activity Type: Unknown\0"
+    "Activity Type: Stationary\0"
+    "Activity Type: Fidgeting\0"
+    "Activity Type: Walking\0"
+    "Activity Type: Running\0"
+    "Activity Type: In Vehicle\0"
+    "Activity Type: Biking\0"
+    "Activity Type: Idle\0"
+    "Unit: Not Specified\0"
+    "Unit: Lux\0"
+    "Unit: Degrees Kelvin\0"
+    "Unit: Degrees Celsius\0"
+    "Unit: Pascal\0"
+    "Unit: Newton\0"
+    "Unit: Meters/Second\0"
+    "Unit: Kilogram\0"
+    "Unit: Meter\0"
+    "Unit: Meters/Second/Second\0"
+    "Unit: Farad\0"
+    "Unit: Ampere\0"
+    "Unit: Watt\0"
+    "Unit: Henry\0"
+    "Unit: Ohm\0"
+    "Unit: Volt\0"
+    "Unit: Hertz\0"
+    "Unit: Bar\0"
+    "Unit: Degrees Anti-clockwise\0"
+    "Unit: Degrees Clockwise\0"
+    "Unit: Degrees\0"
+    "Unit: Degrees/Second\0"
+    "Unit: Degrees/Second/Second\0"
+    "Unit: Knot\0"
+    "Unit: Percent\0"
+    "Unit: Second\0"
+    "Unit: Millisecond\0"
+    "Unit: G\0"
+    "Unit: Bytes\0"
+    "Unit: Milligauss\0"
+    "Unit: Bits\0"
+    "Activity State: No State Change\0"
+    "Activity State: Start Activity\0"
+    "Activity State: End Activity\0"
+    "Exponent 0\0"
+    "Exponent 1\0"
+    "Exponent 2\0"
+    "Exponent 3\0"
+    "Exponent 4\0"
+    "Exponent 5\0"
+    "Exponent 6\0"
+    "Exponent 7\0"
+    "Exponent 8\0"
+    "Exponent 9\0"
+    "Exponent A\0"
+    "Exponent B\0"
+    "Exponent C\0"
+    "Exponent D\0"
+    "Exponent E\0"
+    "Exponent F\0"
+    "Device Position: Unknown\0"
+    "Device Position: Unchanged\0"
+    "Device Position: On Desk\0"
+    "Device Position: In Hand\0"
+    "Device Position: Moving in Bag\0"
+    "Device Position: Stationary in Bag\0"
+    "Step Type: Unknown\0"
+    "Step Type: Running\0"
+    "Step Type: Walking\0"
+    "Gesture State: Unknown\0"
+    "Gesture State: Started\0"
+    "Gesture State: Completed\0"
+    "Gesture State: Cancelled\0"
+    "Hinge Fold Contributing Panel: Unknown\0"
+    "Hinge Fold Contributing Panel: Panel 1\0"
+    "Hinge Fold Contributing Panel: Panel 2\0"
+    "Hinge Fold Contributing Panel: Both\0"
+    "Hinge Fold Type: Unknown\0"
+    "Hinge Fold Type: Increasing\0"
+    "Hinge Fold Type: Decreasing\0"
+    "Human Presence Detection Type: Vendor-Defined Non-Biometric\0"
+    "Human Presence Detection Type: Vendor-Defined Biometric\0"
+    "Human Presence Detection Type: Facial Biometric\0"
+    "Human Presence Detection Type: Audio Biometric\0"
+    "Modifier: Change Sensitivity Absolute\0"
+    "Modifier: Maximum\0"
+    "Modifier: Minimum\0"
+    "Modifier: Accuracy\0"
+    "Modifier: Resolution\0"
+    "Modifier: Threshold High\0"
+    "Modifier: Threshold Low\0"
+    "Modifier: Calibration Offset\0"
+    "Modifier: Calibration Multiplier\0"
+    "Modifier: Report Interval\0"
+    "Modifier: Frequency Max\0"
+    "Modifier: Period Max\0"
+    "Modifier: Change Sensitivity Percent of Range\0"
+    "Modifier: Change Sensitivity Percent Relative\0"
+    "Modifier: Vendor Reserved\0"
+    "Medical Instrument\0"
+    "Medical Ultrasound\0"
+    "VCR/Acquisition\0"
+    "Freeze/Thaw\0"
+    "Clip Store\0"
+    "Update\0"
+    "Next\0"
+    "Save\0"
+    "Print\0"
+    "Microphone Enable\0"
+    "Cine\0"
+    "Transmit Power\0"
+    "Focus\0"
+    "Depth\0"
+    "Soft Step - Primary\0"
+    "Soft Step - Secondary\0"
+    "Depth Gain Compensation\0"
+    "Zoom Select\0"
+    "Zoom Adjust\0"
+    "Spectral Doppler Mode Select\0"
+    "Spectral Doppler Adjust\0"
+    "Color Doppler Mode Select\0"
+    "Color Doppler Adjust\0"
+    "Motion Mode Select\0"
+    "Motion Mode Adjust\0"
+    "2-D Mode Select\0"
+    "2-D Mode Adjust\0"
+    "Soft Control Select\0"
+    "Soft Control Adjust\0"
+    "Braille Display\0"
+    "Braille Row\0"
+    "8 Dot Braille Cell\0"
+    "6 Dot Braille Cell\0"
+    "Number of Braille Cells\0"
+    "Screen Reader Control\0"
+    "Screen Reader Identifier\0"
+    "Router Set 1\0"
+    "Router Set 2\0"
+    "Router Set 3\0"
+    "Router Key\0"
+    "Row Router Key\0"
+    "Braille Buttons\0"
+    "Braille Keyboard Dot 1\0"
+    "Braille Keyboard Dot 2\0"
+    "Braille Keyboard Dot 3\0"
+    "Braille Keyboard Dot 4\0"
+    "Braille Keyboard Dot 5\0"
+    "Braille Keyboard Dot 6\0"
+    "Braille Keyboard Dot 7\0"
+    "Braille Keyboard Dot 8\0"
+    "Braille Keyboard Space\0"
+    "Braille Keyboard Left Space\0"
+    "Braille Keyboard Right Space\0"
+    "Braille Face Controls\0"
+    "Braille Left Controls\0"
+    "Braille Right Controls\0"
+    "Braille Top Controls\0"
+    "Braille Joystick Center\0"
+    "Braille Joystick Up\0"
+    "Braille Joystick Down\0"
+    "Braille Joystick Left\0"
+    "Braille Joystick Right\0"
+    "Braille D-Pad Center\0"
+    "Braille D-Pad Up\0"
+    "Braille D-Pad Down\0"
+    "Braille D-Pad Left\0"
+    "Braille D-Pad Right\0"
+    "Braille Pan Left\0"
+    "Braille Pan Right\0"
+    "Braille Rocker Up\0"
+    "Braille Rocker Down\0"
+    "Braille Rocker Press\0"
+    "Lighting And Illumination\0"
+    "LampArray\0"
+    "LampArrayAttributesReport\0"
+    "LampCount\0"
+    "BoundingBoxWidthInMicrometers\0"
+    "BoundingBoxHeightInMicrometers\0"
+    "BoundingBoxDepthInMicrometers\0"
+    "LampArrayKind\0"
+    "MinUpdateIntervalInMicroseconds\0"
+    "LampAttributesRequestReport\0"
+    "LampId\0"
+    "LampAttributesResponseReport\0"
+    "PositionXInMicrometers\0"
+    "PositionYInMicrometers\0"
+    "PositionZInMicrometers\0"
+    "LampPurposes\0"
+    "UpdateLatencyInMicroseconds\0"
+    "RedLevelCount\0"
+    "GreenLevelCount\0"
+    "BlueLevelCount\0"
+    "IntensityLevelCount\0"
+    "IsProgrammable\0"
+    "InputBinding\0"
+    "LampMultiUpdateReport\0"
+    "RedUpdateChannel\0"
+    "GreenUpdateChannel\0"
+    "BlueUpdateChannel\0"
+    "IntensityUpdateChannel\0"
+    "LampUpdateFlags\0"
+    "LampRangeUpdateReport\0"
+    "LampIdStart\0"
+    "LampIdEnd\0"
+    "LampArrayControlReport\0"
+    "AutonomousMode\0"
+    "Monitor\0"
+    "Monitor Control\0"
+    "EDID Information\0"
+    "VDIF Information\0"
+    "VESA Version\0"
+    "Enum\0"
+    "Monitor Enumerated\0"
+    "VESA Virtual Controls\0"
+    "Degauss\0"
+    "Brightness\0"
+    "Contrast\0"
+    "Red Video Gain\0"
+    "Green Video Gain\0"
+    "Blue Video Gain\0"
+    "Horizontal Position\0"
+    "Horizontal Size\0"
+    "Horizontal Pincushion\0"
+    "Horizontal Pincushion Balance\0"
+    "Horizontal Misconvergence\0"
+    "Horizontal Linearity\0"
+    "Horizontal Linearity Balance\0"
+    "Vertical Position\0"
+    "Vertical Size\0"
+    "Vertical Pincushion\0"
+    "Vertical Pincushion Balance\0"
+    "Vertical Misconvergence\0"
+    "Vertical Linearity\0"
+    "Vertical Linearity Balance\0"
+    "Parallelogram Distortion (Key Balance)\0"
+    "Trapezoidal Distortion (Key)\0"
+    "Tilt (Rotation)\0"
+    "Top Corner Distortion Control\0"
+    "Top Corner Distortion Balance\0"
+    "Bottom Corner Distortion Control\0"
+    "Bottom Corner Distortion Balance\0"
+    "Horizontal Moir\303\251\0"
+    "Vertical Moir\303\251\0"
+    "Input Level Select\0"
+    "Input Source Select\0"
+    "Red Video Black Level\0"
+    "Green Video Black Level\0"
+    "Blue Video Black Level\0"
+    "Auto Size Center\0"
+    "Polarity Horizontal Synchronization\0"
+    "Polarity Vertical Synchronization\0"
+    "Synchronization Type\0"
+    "Screen Orientation\0"
+    "Horizontal Frequency\0"
+    "Vertical Frequency\0"
+    "Settings\0"
+    "On Screen Display\0"
+    "Stereo Mode\0"
+    "iName\0"
+    "Present Status\0"
+    "Changed Status\0"
+    "UPS\0"
+    "Power Supply\0"
+    "Battery System\0"
+    "Battery System Id\0"
+    "Battery\0"
+    "Battery Id\0"
+    "Charger\0"
+    "Charger Id\0"
+    "Power Converter\0"
+    "Power Converter Id\0"
+    "Outlet System\0"
+    "Outlet System Id\0"
+    "Input\0"
+    "Input Id\0"
+    "Output\0"
+    "Output Id\0"
+    "Flow\0"
+    "Flow Id\0"
+    "Outlet\0"
+    "Outlet Id\0"
+    "Gang\0"
+    "Gang Id\0"
+    "Power Summary\0"
+    "Power Summary Id\0"
+    "Voltage\0"
+    "Current\0"
+    "Frequency\0"
+    "Apparent Power\0"
+    "Active Power\0"
+    "Percent Load\0"
+    "Temperature\0"
+    "Humidity\0"
+    "Bad Count\0"
+    "Config Voltage\0"
+    "Config Current\0"
+    "Config Frequency\0"
+    "Config Apparent Power\0"
+    "Config Active Power\0"
+    "Config Percent Load\0"
+    "Config Temperature\0"
+    "Config Humidity\0"
+    "Switch On Control\0"
+    "Switch Off Control\0"
+    "Toggle Control\0"
+    "Low Voltage Transfer\0"
+    "High Voltage Transfer\0"
+    "Delay Before Reboot\0"
+    "Delay Before Startup\0"
+    "Delay Before Shutdown\0"
+    "Test\0"
+    "Module Reset\0"
+    "Audible Alarm Control\0"
+    "Present\0"
+    "Good\0"
+    "Internal Failure\0"
+    "Voltag Out Of Range\0"
+    "Frequency Out Of Range\0"
+    "Overload\0"
+    "Over Charged\0"
+    "Over Temperature\0"
+    "Shutdown Requested\0"
+    "Shutdown Imminent\0"
+    "Switch On/Off\0"
+    "Switchable\0"
+    "Used\0"
+    "Boost\0"
+    "Buck\0"
+    "Initialized\0"
+    "Tested\0"
+    "Awaiting Power\0"
+    "Communication Lost\0"
+    "iManufacturer\0"
+    "iProduct\0"
+    "iSerialNumber\0"
+    "Smart Battery Battery Mode\0"
+    "Smart Battery Battery Status\0"
+    "Smart Battery Alarm Warning\0"
+    "Smart Battery Charger Mode\0"
+    "Smart Battery Charger Status\0"
+    "Smart Battery Charger Spec Info\0"
+    "Smart Battery Selector State\0"
+    "Smart Battery Selector Presets\0"
+    "Smart Battery Selector Info\0"
+    "Optional Mfg Function 1\0"
+    "Optional Mfg Function 2\0"
+    "Optional Mfg Function 3\0"
+    "Optional Mfg Function 4\0"
+    "Optional Mfg Function 5\0"
+    "Connection To SM Bus\0"
+    "Output Connection\0"
+    "Charger Connection\0"
+    "Battery Insertion\0"
+    "Use Next\0"
+    "OK To Use\0"
+    "Battery Supported\0"
+    "Selector Revision\0"
+    "Charging Indicator\0"
+    "Manufacturer Access\0"
+    "Remaining Capacity Limit\0"
+    "Remaining Time Limit\0"
+    "At Rate\0"
+    "Capacity Mode\0"
+    "Broadcast To Charger\0"
+    "Primary Battery\0"
+    "Charge Controller\0"
+    "Terminate Charge\0"
+    "Terminate Discharge\0"
+    "Below Remaining Capacity Limit\0"
+    "Remaining Time Limit Expired\0"
+    "Charging\0"
+    "Discharging\0"
+    "Fully Charged\0"
+    "Fully Discharged\0"
+    "Conditioning Flag\0"
+    "At Rate OK\0"
+    "Smart Battery Error Code\0"
+    "Need Replacement\0"
+    "At Rate Time To Full\0"
+    "At Rate Time To Empty\0"
+    "Average Current\0"
+    "Max Error\0"
+    "Relative State Of Charge\0"
+    "Absolute State Of Charge\0"
+    "Remaining Capacity\0"
+    "Full Charge Capacity\0"
+    "Run Time To Empty\0"
+    "Average Time To Empty\0"
+    "Average Time To Full\0"
+    "Cycle Count\0"
+    "Battery Pack Model Level\0"
+    "Internal Charge Controller\0"
+    "Primary Battery Support\0"
+    "Design Capacity\0"
+    "Specification Info\0"
+    "Manufacture Date\0"
+    "Serial Number\0"
+    "iManufacturer Name\0"
+    "iDevice Name\0"
+    "iDevice Chemistry\0"
+    "Manufacturer Data\0"
+    "Rechargable\0"
+    "Warning Capacity Limit\0"
+    "Capacity Granularity 1\0"
+    "Capacity Granularity 2\0"
+    "iOEM Information\0"
+    "Inhibit Charge\0"
+    "Enable Polling\0"
+    "Reset To Zero\0"
+    "AC Present\0"
+    "Battery Present\0"
+    "Power Fail\0"
+    "Alarm Inhibited\0"
+    "Thermistor Under Range\0"
+    "Thermistor Hot\0"
+    "Thermistor Cold\0"
+    "Thermistor Over Range\0"
+    "Voltage Out Of Range\0"
+    "Current Out Of Range\0"
+    "Current Not Regulated\0"
+    "Voltage Not Regulated\0"
+    "Master Mode\0"
+    "Charger Selector Support\0"
+    "Charger Spec\0"
+    "Level 2\0"
+    "Level 3\0"
+    "Barcode Scanner\0"
+    "Barcode Badge Reader\0"
+    "Dumb Bar Code Scanner\0"
+    "Cordless Scanner Base\0"
+    "Bar Code Scanner Cradle\0"
+    "Attribute Report\0"
+    "Settings Report\0"
+    "Scanned Data Report\0"
+    "Raw Scanned Data Report\0"
+    "Trigger Report\0"
+    "Status Report\0"
+    "UPC/EAN Control Report\0"
+    "EAN 2/3 Label Control Report\0"
+    "Code 39 Control Report\0"
+    "Interleaved 2 of 5 Control Report\0"
+    "Standard 2 of 5 Control Report\0"
+    "MSI Plessey Control Report\0"
+    "Codabar Control Report\0"
+    "Code 128 Control Report\0"
+    "Misc 1D Control Report\0"
+    "2D Control Report\0"
+    "Aiming/Pointer Mode\0"
+    "Bar Code Present Sensor\0"
+    "Class 1A Laser\0"
+    "Class 2 Laser\0"
+    "Heater Present\0"
+    "Contact Scanner\0"
+    "Electronic Article Surveillance Notification\0"
+    "Constant Electronic Article Surveillance\0"
+    "Error Indication\0"
+    "Fixed Beeper\0"
+    "Good Decode Indication\0"
+    "Hands Free Scanning\0"
+    "Intrinsically Safe\0"
+    "Klasse Eins Laser\0"
+    "Long Range Scanner\0"
+    "Mirror Speed Control\0"
+    "Not On File Indication\0"
+    "Programmable Beeper\0"
+    "Triggerless\0"
+    "Wand\0"
+    "Water Resistant\0"
+    "Multi-Range Scanner\0"
+    "Proximity Sensor\0"
+    "Fragment Decoding\0"
+    "Scanner Read Confidence\0"
+    "Data Prefix\0"
+    "Prefix AIMI\0"
+    "Prefix None\0"
+    "Prefix Proprietary\0"
+    "Active Time\0"
+    "Aiming Laser Pattern\0"
+    "Bar Code Present\0"
+    "Beeper State\0"
+    "Laser On Time\0"
+    "Laser State\0"
+    "Lockout Time\0"
+    "Motor State\0"
+    "Motor Timeout\0"
+    "Power On Reset Scanner\0"
+    "Prevent Read of Barcodes\0"
+    "Initiate Barcode Read\0"
+    "Trigger State\0"
+    "Trigger Mode\0"
+    "Trigger Mode Blinking Laser On\0"
+    "Trigger Mode Continuous Laser On\0"
+    "Trigger Mode Laser on while Pulled\0"
+    "Trigger Mode Laser stays on after release\0"
+    "Commit Parameters to NVM\0"
+    "Parameter Scanning\0"
+    "Parameters Changed\0"
+    "Set parameter default values\0"
+    "Scanner In Cradle\0"
+    "Scanner In Range\0"
+    "Aim Duration\0"
+    "Good Read Lamp Duration\0"
+    "Good Read Lamp Intensity\0"
+    "Good Read LED\0"
+    "Good Read Tone Frequency\0"
+    "Good Read Tone Length\0"
+    "Good Read Tone Volume\0"
+    "No Read Message\0"
+    "Not on File Volume\0"
+    "Powerup Beep\0"
+    "Sound Error Beep\0"
+    "Sound Good Read Beep\0"
+    "Sound Not On File Beep\0"
+    "Good Read When to Write\0"
+    "GRWTI After Decode\0"
+    "GRWTI Beep/Lamp after transmit\0"
+    "GRWTI No Beep/Lamp use at all\0"
+    "Bookland EAN\0"
+    "Convert EAN 8 to 13 Type\0"
+    "Convert UPC A to EAN-13\0"
+    "Convert UPC-E to A\0"
+    "EAN-13\0"
+    "EAN-8\0"
+    "EAN-99 128 Mandatory\0"
+    "EAN-99 P5/128 Optional\0"
+    "Enable EAN Two Label\0"
+    "UPC/EAN\0"
+    "UPC/EAN Coupon Code\0"
+    "UPC/EAN Periodicals\0"
+    "UPC-A\0"
+    "UPC-A with 128 Mandatory\0"
+    "UPC-A with 128 Optional\0"
+    "UPC-A with P5 Optional\0"
+    "UPC-E\0"
+    "UPC-E1\0"
+    "Periodical\0"
+    "Periodical Auto-Discriminate +2\0"
+    "Periodical Only Decode with +2\0"
+    "Periodical Ignore +2\0"
+    "Periodical Auto-Discriminate +5\0"
+    "Periodical Only Decode with +5\0"
+    "Periodical Ignore +5\0"
+    "Check\0"
+    "Check Disable Price\0"
+    "Check Enable 4 digit Price\0"
+    "Check Enable 5 digit Price\0"
+    "Check Enable European 4 digit Price\0"
+    "Check Enable European 5 digit Price\0"
+    "EAN Two Label\0"
+    "EAN Three Label\0"
+    "EAN 8 Flag Digit 1\0"
+    "EAN 8 Flag Digit 2\0"
+    "EAN 8 Flag Digit 3\0"
+    "EAN 13 Flag Digit 1\0"
+    "EAN 13 Flag Digit 2\0"
+    "EAN 13 Flag Digit 3\0"
+    "Add EAN 2/3 Label Definition\0"
+    "Clear all EAN 2/3 Label Definitions\0"
+    "Codabar\0"
+    "Code 128\0"
+    "Code 39\0"
+    "Code 93\0"
+    "Full ASCII Conversion\0"
+    "Interleaved 2 of 5\0"
+    "Italian Pharmacy Code\0"
+    "MSI/Plessey\0"
+    "Standard 2 of 5 IATA\0"
+    "Standard 2 of 5\0"
+    "Transmit Start/Stop\0"
+    "Tri-Optic\0"
+    "UCC/EAN-128\0"
+    "Check Digit\0"
+    "Check Digit Disable\0"
+    "Check Digit Enable Interleaved 2 of 5 OPCC\0"
+    "Check Digit Enable Interleaved 2 of 5 USS\0"
+    "Check Digit Enable Standard 2 of 5 OPCC\0"
+    "Check Digit Enable Standard 2 of 5 USS\0"
+    "Check Digit Enable One MSI Plessey\0"
+    "Check Digit Enable Two MSI Plessey\0"
+    "Check Digit Codabar Enable\0"
+    "Check Digit Code 39 Enable\0"
+    "Transmit Check Digit\0"
+    "Disable Check Digit Transmit\0"
+    "Enable Check Digit Transmit\0"
+    "Symbology Identifier 1\0"
+    "Symbology Identifier 2\0"
+    "Symbology Identifier 3\0"
+    "Decoded Data\0"
+    "Decode Data Continued\0"
+    "Bar Space Data\0"
+    "Scanner Data Accuracy\0"
+    "Raw Data Polarity\0"
+    "Polarity Inverted Bar Code\0"
+    "Polarity Normal Bar Code\0"
+    "Minimum Length to Decode\0"
+    "Maximum Length to Decode\0"
+    "Discrete Length to Decode 1\0"
+    "Discrete Length to Decode 2\0"
+    "Data Length Method\0"
+    "DL Method Read any\0"
+    "DL Method Check in Range\0"
+    "DL Method Check for Discrete\0"
+    "Aztec Code\0"
+    "BC412\0"
+    "Channel Code\0"
+    "Code 16\0"
+    "Code 32\0"
+    "Code 49\0"
+    "Code One\0"
+    "Colorcode\0"
+    "Data Matrix\0"
+    "MaxiCode\0"
+    "MicroPDF\0"
+    "PDF-417\0"
+    "PosiCode\0"
+    "QR Code\0"
+    "SuperCode\0"
+    "UltraCode\0"
+    "USD-5 (Slug Code)\0"
+    "VeriCode\0"
+    "Scales\0"
+    "Scale Device\0"
+    "Scale Class\0"
+    "Scale Class I Metric\0"
+    "Scale Class II Metric\0"
+    "Scale Class III Metric\0"
+    "Scale Class IIIL Metric\0"
+    "Scale Class IV Metric\0"
+    "Scale Class III English\0"
+    "Scale Class IIIL English\0"
+    "Scale Class IV English\0"
+    "Scale Class Generic\0"
+    "Scale Attribute Report\0"
+    "Scale Control Report\0"
+    "Scale Data Report\0"
+    "Scale Status Report\0"
+    "Scale Weight Limit Report\0"
+    "Scale Statistics Report\0"
+    "Data Weight\0"
+    "Data Scaling\0"
+    "Weight Unit\0"
+    "Weight Unit Milligram\0"
+    "Weight Unit Gram\0"
+    "Weight Unit Kilogram\0"
+    "Weight Unit Carats\0"
+    "Weight Unit Taels\0"
+    "Weight Unit Grains\0"
+    "Weight Unit Pennyweights\0"
+    "Weight Unit Metric Ton\0"
+    "Weight Unit Avoir Ton\0"
+    "Weight Unit Troy Ounce\0"
+    "Weight Unit Ounce\0"
+    "Weight Unit Pound\0"
+    "Calibration Count\0"
+    "Re-Zero Count\0"
+    "Scale Status\0"
+    "Scale Status Fault\0"
+    "Scale Status Stable at Center of Zero\0"
+    "Scale Status In Motion\0"
+    "Scale Status Weight Stable\0"
+    "Scale Status Under Zero\0"
+    "Scale Status Over Weight Limit\0"
+    "Scale Status Requires Calibration\0"
+    "Scale Status Requires Rezeroing\0"
+    "Zero Scale\0"
+    "Enforced Zero Return\0"
+    "Magnetic Stripe Reader\0"
+    "MSR Device Read-Only\0"
+    "Track 1 Length\0"
+    "Track 2 Length\0"
+    "Track 3 Length\0"
+    "Track JIS Length\0"
+    "Track Data\0"
+    "Track 1 Data\0"
+    "Track 2 Data\0"
+    "Track 3 Data\0"
+    "Track JIS Data\0"
+    "Camera Control\0"
+    "Camera Auto-focus\0"
+    "Camera Shutter\0"
+    "Arcade\0"
+    "General Purpose IO Card\0"
+    "Coin Door\0"
+    "Watchdog Timer\0"
+    "General Purpose Analog Input State\0"
+    "General Purpose Digital Input State\0"
+    "General Purpose Optical Input State\0"
+    "General Purpose Digital Output State\0"
+    "Number of Coin Doors\0"
+    "Coin Drawer Drop Count\0"
+    "Coin Drawer Start\0"
+    "Coin Drawer Service\0"
+    "Coin Drawer Tilt\0"
+    "Coin Door Test\0"
+    "Coin Door Lockout\0"
+    "Watchdog Timeout\0"
+    "Watchdog Action\0"
+    "Watchdog Reboot\0"
+    "Watchdog Restart\0"
+    "Alarm Input\0"
+    "Coin Door Counter\0"
+    "I/O Direction Mapping\0"
+    "Set I/O Direction Mapping\0"
+    "Extended Optical Input State\0"
+    "Pin Pad Input State\0"
+    "Pin Pad Status\0"
+    "Pin Pad Output\0"
+    "Pin Pad Command\0"
+    "FIDO Alliance\0"
+    "U2F Authenticator Device\0"
+    "Input Report Data\0"
+    "Output Report Data\0";
+
+static const IOHIDUsagePageNameEntry __IOHIDUsagePageNames[] = {
+    { 0x0001,    0, 114,     1,     0, 0x0000, 0x0000 },   // Generic Desktop
+    { 0x0002,  114,  51,  1905,     0, 0x0000, 0x0000 },   // Simulation Controls
+    { 0x0003,  165,  12,  2755,     0, 0x0000, 0x0000 },   // VR Controls
+    { 0x0004,  177,  34,  2906,     0, 0x0000, 0x0000 },   // Sport Controls
+    { 0x0005,  211,  29,  3240,     0, 0x0000, 0x0000 },   // Game Controls
+    { 0x0006,  240,  24,  3666,     0, 0x0000, 0x0000 },   // Generic Device Controls
+    { 0x0007,  264, 218,  4088,     0, 0x0000, 0x0000 },   // Keyboard/Keypad
+    { 0x0008,  482,  96,  7808,     0, 0x0000, 0x0000 },   // LED
+    { 0x0009,  578,   0,  8967,  8967, 0x0001, 0xFFFF },   // Button
+    { 0x000A,  578,   0,  8983,  8974, 0x0001, 0xFFFF },   // Ordinal
+    { 0x000B,  578,  99,  8991,     0, 0x0000, 0x0000 },   // Telephony Device
+    { 0x000C,  677, 450, 10410,     0, 0x0000, 0x0000 },   // Consumer
+    { 0x000D, 1127, 108, 18047,     0, 0x0000, 0x0000 },   // Digitizers
+    { 0x000E, 1235,  29, 19997,     0, 0x0000, 0x0000 },   // Haptics
+    { 0x000F, 1264, 105, 20586,     0, 0x0000, 0x0000 },   // Physical Input Device
+    { 0x0011, 1369,  10, 22412,     0, 0x0000, 0x0000 },   // SoC
+    { 0x0012, 1379,  34, 22605,     0, 0x0000, 0x0000 },   // Eye and Head Trackers
+    { 0x0014, 1413,  75, 23243,     0, 0x0000, 0x0000 },   // Auxiliary Display
+    { 0x0020, 1488, 665, 24493,     0, 0x0000, 0x0000 },   // Sensors
+    { 0x0040, 2153,  29, 41280,     0, 0x0000, 0x0000 },   // Medical Instrument
+    { 0x0041, 2182,  43, 41730,     0, 0x0000, 0x0000 },   // Braille Display
+    { 0x0059, 2225,  33, 42601,     0, 0x0000, 0x0000 },   // Lighting And Illumination
+    { 0x0080, 2258,   4, 43274,     0, 0x0000, 0x0000 },   // Monitor
+    { 0x0081, 2262,   0, 43350, 43345, 0x0001, 0xFFFF },   // Monitor Enumerated
+    { 0x0082, 2262,  45, 43369,     0, 0x0000, 0x0000 },   // VESA Virtual Controls
+    { 0x0084, 2307,  77,  7856,     0, 0x0000, 0x0000 },   // Power
+    { 0x0085, 2384,  91, 44392,     0, 0x0000, 0x0000 },   // Battery System
+    { 0x008C, 2475, 194, 47114,     0, 0x0000, 0x0000 },   // Barcode Scanner
+    { 0x008D, 2669,  46, 50991,     0, 0x0000, 0x0000 },   // Scales
+    { 0x008E, 2715,  10, 51946,     0, 0x0000, 0x0000 },   // Magnetic Stripe Reader
+    { 0x0090, 2725,   2, 52117,     0, 0x0000, 0x0000 },   // Camera Control
+    { 0x0091, 2727,  27, 52165,     0, 0x0000, 0x0000 },   // Arcade
+    { 0xF1D0, 2754,   3, 52736,     0, 0x0000, 0x0000 },   // FIDO Alliance
+};
+
+static const IOHIDUsageNameEntry __IOHIDUsageNames[] = {
+    { 0x0001,    17 },
+    { 0x0002,    25 },
+    { 0x0004,    31 },
+    { 0x0005,    40 },
+    { 0x0006,    48 },
+    { 0x0007,    57 },
+    { 0x0008,    64 },
+    { 0x0009,    86 },
+    { 0x000A,   112 },
+    { 0x000B,   133 },
+    { 0x000C,   157 },
+    { 0x000D,   181 },
+    { 0x000E,   205 },
+    { 0x000F,   234 },
+    { 0x0010,   253 },
+    { 0x0011,   271 },
+    { 0x0012,   283 },
+    { 0x0013,   299 },
+    { 0x0030,   329 },
+    { 0x0031,   331 },
+    { 0x0032,   333 },
+    { 0x0033,   335 },
+    { 0x0034,   338 },
+    { 0x0035,   341 },
+    { 0x0036,   344 },
+    { 0x0037,   351 },
+    { 0x0038,   356 },
+    { 0x0039,   362 },
+    { 0x003A,   373 },
+    { 0x003B,   388 },
+    { 0x003C,   399 },
+    { 0x003D,   413 },
+    { 0x003E,   419 },
+    { 0x0040,   426 },
+    { 0x0041,   429 },
+    { 0x0042,   432 },
+    { 0x0043,   435 },
+    { 0x0044,   440 },
+    { 0x0045,   445 },
+    { 0x0046,   450 },
+    { 0x0047,   454 },
+    { 0x0048,   475 },
+    { 0x0049,   497 },
+    { 0x004A,   500 },
+    { 0x004B,   503 },
+    { 0x004C,   506 },
+    { 0x0080,   509 },
+    { 0x0081,   524 },
+    { 0x0082,   542 },
+    { 0x0083,   555 },
+    { 0x0084,   570 },
+    { 0x0085,   590 },
+    { 0x0086,   607 },
+    { 0x0087,   623 },
+    { 0x0088,   640 },
+    { 0x0089,   657 },
+    { 0x008A,   676 },
+    { 0x008B,   694 },
+    { 0x008C,   711 },
+    { 0x008D,   726 },
+    { 0x008E,   743 },
+    { 0x008F,   763 },
+    { 0x0090,   783 },
+    { 0x0091,   792 },
+    { 0x0092,   803 },
+    { 0x0093,   815 },
+    { 0x0094,   826 },
+    { 0x0095,   840 },
+    { 0x0096,   853 },
+    { 0x0097,   864 },
+    { 0x0098,   886 },
+    { 0x0099,   913 },
+    { 0x009A,   950 },
+    { 0x009B,   978 },
+    { 0x00A0,  1000 },
+    { 0x00A1,  1012 },
+    { 0x00A2,  1026 },
+    { 0x00A3,  1039 },
+    { 0x00A4,  1052 },
+    { 0x00A5,  1074 },
+    { 0x00A6,  1092 },
+    { 0x00A7,  1119 },
+    { 0x00A8,  1139 },
+    { 0x00A9,  1156 },
+    { 0x00B0,  1179 },
+    { 0x00B1,  1201 },
+    { 0x00B2,  1225 },
+    { 0x00B3,  1249 },
+    { 0x00B4,  1269 },
+    { 0x00B5,  1289 },
+    { 0x00B6,  1324 },
+    { 0x00B7,  1362 },
+    { 0x00C0,  1398 },
+    { 0x00C1,  1410 },
+    { 0x00C2,  1414 },
+    { 0x00C3,  1428 },
+    { 0x00C4,  1451 },
+    { 0x00C5,  1464 },
+    { 0x00C6,  1482 },
+    { 0x00C7,  1504 },
+    { 0x00C8,  1523 },
+    { 0x00C9,  1552 },
+    { 0x00CA,  1588 },
+    { 0x00CB,  1631 },
+    { 0x00D0,  1646 },
+    { 0x00D1,  1672 },
+    { 0x00D2,  1698 },
+    { 0x00D3,  1733 },
+    { 0x00D4,  1766 },
+    { 0x00D5,  1796 },
+    { 0x00D6,  1830 },
+    { 0x00E0,  1858 },
+    { 0x00E1,  1874 },
+    { 0x00E2,  1891 },
+    { 0x0001,  1925 },
+    { 0x0002,  1950 },
+    { 0x0003,  1979 },
+    { 0x0004,  2002 },
+    { 0x0005,  2030 },
+    { 0x0006,  2058 },
+    { 0x0007,  2084 },
+    { 0x0008,  2113 },
+    { 0x0009,  2138 },
+    { 0x000A,  2165 },
+    { 0x000B,  2194 },
+    { 0x000C,  2225 },
+    { 0x0020,  2251 },
+    { 0x0021,  2272 },
+    { 0x0022,  2285 },
+    { 0x0023,  2300 },
+    { 0x0024,  2312 },
+    { 0x0025,  2324 },
+    { 0x00B0,  2338 },
+    { 0x00B1,  2346 },
+    { 0x00B2,  2359 },
+    { 0x00B3,  2379 },
+    { 0x00B4,  2396 },
+    { 0x00B5,  2410 },
+    { 0x00B6,  2429 },
+    { 0x00B7,  2440 },
+    { 0x00B8,  2467 },
+    { 0x00B9,  2476 },
+    { 0x00BA,  2490 },
+    { 0x00BB,  2497 },
+    { 0x00BC,  2506 },
+    { 0x00BD,  2528 },
+    { 0x00BE,  2542 },
+    { 0x00BF,  2555 },
+    { 0x00C0,  2565 },
+    { 0x00C1,  2573 },
+    { 0x00C2,  2585 },
+    { 0x00C3,  2600 },
+    { 0x00C4,  2611 },
+    { 0x00C5,  2623 },
+    { 0x00C6,  2629 },
+    { 0x00C7,  2636 },
+    { 0x00C8,  2644 },
+    { 0x00C9,  2653 },
+    { 0x00CA,  2670 },
+    { 0x00CB,  2687 },
+    { 0x00CC,  2698 },
+    { 0x00CD,  2706 },
+    { 0x00CE,  2720 },
+    { 0x00CF,  2732 },
+    { 0x00D0,  2744 },
+    { 0x0001,  2767 },
+    { 0x0002,  2772 },
+    { 0x0003,  2782 },
+    { 0x0004,  2789 },
+    { 0x0005,  2795 },
+    { 0x0006,  2808 },
+    { 0x0007,  2829 },
+    { 0x0008,  2842 },
+    { 0x0009,  2853 },
+    { 0x000A,  2858 },
+    { 0x0020,  2877 },
+    { 0x0021,  2891 },
+    { 0x0001,  2921 },
+    { 0x0002,  2934 },
+    { 0x0003,  2944 },
+    { 0x0004,  2959 },
+    { 0x0030,  2969 },
+    { 0x0031,  2973 },
+    { 0x0032,  2979 },
+    { 0x0033,  2984 },
+    { 0x0034,  2996 },
+    { 0x0035,  3013 },
+    { 0x0036,  3028 },
+    { 0x0037,  3049 },
+    { 0x0038,  3061 },
+    { 0x0039,  3072 },
+    { 0x0050,  3085 },
+    { 0x0051,  3092 },
+    { 0x0052,  3099 },
+    { 0x0053,  3106 },
+    { 0x0054,  3113 },
+    { 0x0055,  3120 },
+    { 0x0056,  3127 },
+    { 0x0057,  3134 },
+    { 0x0058,  3141 },
+    { 0x0059,  3148 },
+    { 0x005A,  3155 },
+    { 0x005B,  3163 },
+    { 0x005C,  3171 },
+    { 0x005D,  3182 },
+    { 0x005E,  3193 },
+    { 0x005F,  3205 },
+    { 0x0060,  3212 },
+    { 0x0061,  3219 },
+    { 0x0062,  3226 },
+    { 0x0063,  3233 },
+    { 0x0001,  3254 },
+    { 0x0002,  3273 },
+    { 0x0003,  3288 },
+    { 0x0020,  3299 },
+    { 0x0021,  3313 },
+    { 0x0022,  3329 },
+    { 0x0023,  3352 },
+    { 0x0024,  3368 },
+    { 0x0025,  3384 },
+    { 0x0026,  3406 },
+    { 0x0027,  3419 },
+    { 0x0028,  3435 },
+    { 0x0029,  3457 },
+    { 0x002A,  3471 },
+    { 0x002B,  3479 },
+    { 0x002C,  3497 },
+    { 0x002D,  3502 },
+    { 0x002E,  3511 },
+    { 0x002F,  3522 },
+    { 0x0030,  3529 },
+    { 0x0031,  3538 },
+    { 0x0032,  3547 },
+    { 0x0033,  3560 },
+    { 0x0034,  3576 },
+    { 0x0035,  3586 },
+    { 0x0036,  3600 },
+    { 0x0037,  3611 },
+    { 0x0039,  3629 },
+    { 0x003A,  3645 },
+    { 0x0001,  3690 },
+    { 0x0020,  3718 },
+    { 0x0021,  3735 },
+    { 0x0022,  3752 },
+    { 0x0023,  3764 },
+    { 0x0024,  3790 },
+    { 0x0025,  3822 },
+    { 0x0026,  3853 },
+    { 0x0027,  3875 },
+    { 0x0028,  3887 },
+    { 0x0029,  3905 },
+    { 0x002A,  3924 },
+    { 0x002B,  3941 },
+    { 0x002C,  3958 },
+    { 0x002D,  3975 },
+    { 0x002E,  3981 },
+    { 0x002F,  3987 },
+    { 0x0030,  3996 },
+    { 0x0031,  4007 },
+    { 0x0032,  4019 },
+    { 0x0033,  4029 },
+    { 0x0034,  4040 },
+    { 0x0040,  4051 },
+    { 0x0041,  4068 },
+    { 0x0001,  4104 },
+    { 0x0002,  4118 },
+    { 0x0003,  4127 },
+    { 0x0004,  4142 },
+    { 0x0005,  4153 },
+    { 0x0006,  4164 },
+    { 0x0007,  4175 },
+    { 0x0008,  4186 },
+    { 0x0009,  4197 },
+    { 0x000A,  4208 },
+    { 0x000B,  4219 },
+    { 0x000C,  4230 },
+    { 0x000D,  4241 },
+    { 0x000E,  4252 },
+    { 0x000F,  4263 },
+    { 0x0010,  4274 },
+    { 0x0011,  4285 },
+    { 0x0012,  4296 },
+    { 0x0013,  4307 },
+    { 0x0014,  4318 },
+    { 0x0015,  4329 },
+    { 0x0016,  4340 },
+    { 0x0017,  4351 },
+    { 0x0018,  4362 },
+    { 0x0019,  4373 },
+    { 0x001A,  4384 },
+    { 0x001B,  4395 },
+    { 0x001C,  4406 },
+    { 0x001D,  4417 },
+    { 0x001E,  4428 },
+    { 0x001F,  4448 },
+    { 0x0020,  4466 },
+    { 0x0021,  4486 },
+    { 0x0022,  4508 },
+    { 0x0023,  4531 },
+    { 0x0024,  4552 },
+    { 0x0025,  4577 },
+    { 0x0026,  4597 },
+    { 0x0027,  4625 },
+    { 0x0028,  4654 },
+    { 0x0029,  4676 },
+    { 0x002A,  4692 },
+    { 0x002B,  4708 },
+    { 0x002C,  4721 },
+    { 0x002D,  4739 },
+    { 0x002E,  4768 },
+    { 0x002F,  4793 },
+    { 0x0030,  4813 },
+    { 0x0031,  4834 },
+    { 0x0032,  4862 },
+    { 0x0033,  4893 },
+    { 0x0034,  4922 },
+    { 0x0035,  4952 },
+    { 0x0036,  4984 },
+    { 0x0037,  5012 },
+    { 0x0038,  5044 },
+    { 0x0039,  5083 },
+    { 0x003A,  5102 },
+    { 0x003B,  5114 },
+    { 0x003C,  5126 },
+    { 0x003D,  5138 },
+    { 0x003E,  5150 },
+    { 0x003F,  5162 },
+    { 0x0040,  5174 },
+    { 0x0041,  5186 },
+    { 0x0042,  5198 },
+    { 0x0043,  5210 },
+    { 0x0044,  5223 },
+    { 0x0045,  5236 },
+    { 0x0046,  5249 },
+    { 0x0047,  5270 },
+    { 0x0048,  5291 },
+    { 0x0049,  5306 },
+    { 0x004A,  5322 },
+    { 0x004B,  5336 },
+    { 0x004C,  5352 },
+    { 0x004D,  5376 },
+    { 0x004E,  5389 },
+    { 0x004F,  5407 },
+    { 0x0050,  5427 },
+    { 0x0051,  5446 },
+    { 0x0052,  5465 },
+    { 0x0053,  5482 },
+    { 0x0054,  5508 },
+    { 0x0055,  5528 },
+    { 0x0056,  5540 },
+    { 0x0057,  5552 },
+    { 0x0058,  5564 },
+    { 0x0059,  5577 },
+    { 0x005A,  5594 },
+    { 0x005B,  5618 },
+    { 0x005C,  5638 },
+    { 0x005D,  5662 },
+    { 0x005E,  5671 },
+    { 0x005F,  5696 },
+    { 0x0060,  5714 },
+    { 0x0061,  5736 },
+    { 0x0062,  5756 },
+    { 0x0063,  5776 },
+    { 0x0064,  5801 },
+    { 0x0065,  5836 },
+    { 0x0066,  5857 },
+    { 0x0067,  5872 },
+    { 0x0068,  5886 },
+    { 0x0069,  5899 },
+    { 0x006A,  5912 },
+    { 0x006B,  5925 },
+    { 0x006C,  5938 },
+    { 0x006D,  5951 },
+    { 0x006E,  5964 },
+    { 0x006F,  5977 },
+    { 0x0070,  5990 },
+    { 0x0071,  6003 },
+    { 0x0072,  6016 },
+    { 0x0073,  6029 },
+    { 0x0074,  6042 },
+    { 0x0075,  6059 },
+    { 0x0076,  6073 },
+    { 0x0077,  6087 },
+    { 0x0078,  6103 },
+    { 0x0079,  6117 },
+    { 0x007A,  6132 },
+    { 0x007B,  6146 },
+    { 0x007C,  6159 },
+    { 0x007D,  6173 },
+    { 0x007E,  6188 },
+    { 0x007F,  6202 },
+    { 0x0080,  6216 },
+    { 0x0081,  6235 },
+    { 0x0082,  6256 },
+    { 0x0083,  6283 },
+    { 0x0084,  6309 },
+    { 0x0085,  6338 },
+    { 0x0086,  6351 },
+    { 0x0087,  6369 },
+    { 0x0088,  6393 },
+    { 0x0089,  6417 },
+    { 0x008A,  6441 },
+    { 0x008B,  6465 },
+    { 0x008C,  6489 },
+    { 0x008D,  6513 },
+    { 0x008E,  6537 },
+    { 0x008F,  6561 },
+    { 0x0090,  6585 },
+    { 0x0091,  6600 },
+    { 0x0092,  6615 },
+    { 0x0093,  6630 },
+    { 0x0094,  6645 },
+    { 0x0095,  6660 },
+    { 0x0096,  6675 },
+    { 0x0097,  6690 },
+    { 0x0098,  6705 },
+    { 0x0099,  6720 },
+    { 0x009A,  6745 },
+    { 0x009B,  6771 },
+    { 0x009C,  6787 },
+    { 0x009D,  6802 },
+    { 0x009E,  6817 },
+    { 0x009F,  6833 },
+    { 0x00A0,  6852 },
+    { 0x00A1,  6865 },
+    { 0x00A2,  6879 },
+    { 0x00A3,  6900 },
+    { 0x00A4,  6921 },
+    { 0x00B0,  6936 },
+    { 0x00B1,  6952 },
+    { 0x00B2,  6968 },
+    { 0x00B3,  6988 },
+    { 0x00B4,  7006 },
+    { 0x00B5,  7020 },
+    { 0x00B6,  7038 },
+    { 0x00B7,  7058 },
+    { 0x00B8,  7079 },
+    { 0x00B9,  7097 },
+    { 0x00BA,  7116 },
+    { 0x00BB,  7127 },
+    { 0x00BC,  7144 },
+    { 0x00BD,  7153 },
+    { 0x00BE,  7162 },
+    { 0x00BF,  7171 },
+    { 0x00C0,  7180 },
+    { 0x00C1,  7189 },
+    { 0x00C2,  7198 },
+    { 0x00C3,  7209 },
+    { 0x00C4,  7222 },
+    { 0x00C5,  7240 },
+    { 0x00C6,  7252 },
+    { 0x00C7,  7267 },
+    { 0x00C8,  7284 },
+    { 0x00C9,  7308 },
+    { 0x00CA,  7319 },
+    { 0x00CB,  7337 },
+    { 0x00CC,  7350 },
+    { 0x00CD,  7362 },
+    { 0x00CE,  7375 },
+    { 0x00CF,  7385 },
+    { 0x00D0,  7397 },
+    { 0x00D1,  7417 },
+    { 0x00D2,  7438 },
+    { 0x00D3,  7458 },
+    { 0x00D4,  7476 },
+    { 0x00D5,  7499 },
+    { 0x00D6,  7522 },
+    { 0x00D7,  7543 },
+    { 0x00D8,  7561 },
+    { 0x00D9,  7574 },
+    { 0x00DA,  7593 },
+    { 0x00DB,  7607 },
+    { 0x00DC,  7620 },
+    { 0x00DD,  7635 },
+    { 0x00E0,  7654 },
+    { 0x00E1,  7675 },
+    { 0x00E2,  7694 },
+    { 0x00E3,  7711 },
+    { 0x00E4,  7729 },
+    { 0x00E5,  7751 },
+    { 0x00E6,  7771 },
+    { 0x00E7,  7789 },
+    { 0x0001,  7812 },
+    { 0x0002,  7821 },
+    { 0x0003,  7831 },
+    { 0x0004,  7843 },
+    { 0x0005,  7851 },
+    { 0x0006,  7856 },
+    { 0x0007,  7862 },
+    { 0x0008,  7868 },
+    { 0x0009,  7883 },
+    { 0x000A,  7888 },
+    { 0x000B,  7900 },
+    { 0x000C,  7916 },
+    { 0x000D,  7931 },
+    { 0x000E,  7948 },
+    { 0x000F,  7963 },
+    { 0x0010,  7975 },
+    { 0x0011,  7982 },
+    { 0x0012,  7989 },
+    { 0x0013,  8010 },
+    { 0x0014,  8019 },
+    { 0x0015,  8023 },
+    { 0x0016,  8027 },
+    { 0x0017,  8051 },
+    { 0x0018,  8060 },
+    { 0x0019,  8065 },
+    { 0x001A,  8081 },
+    { 0x001B,  8091 },
+    { 0x001C,  8109 },
+    { 0x001D,  8120 },
+    { 0x001E,  8132 },
+    { 0x001F,  8140 },
+    { 0x0020,  8148 },
+    { 0x0021,  8153 },
+    { 0x0022,  8164 },
+    { 0x0023,  8173 },
+    { 0x0024,  8184 },
+    { 0x0025,  8195 },
+    { 0x0026,  8207 },
+    { 0x0027,  8218 },
+    { 0x0028,  8227 },
+    { 0x0029,  8237 },
+    { 0x002A,  8248 },
+    { 0x002B,  8256 },
+    { 0x002C,  8265 },
+    { 0x002D,  8270 },
+    { 0x002E,  8276 },
+    { 0x002F,  8286 },
+    { 0x0030,  8296 },
+    { 0x0031,  8303 },
+    { 0x0032,  8311 },
+    { 0x0033,  8319 },
+    { 0x0034,  8324 },
+    { 0x0035,  8331 },
+    { 0x0036,  8344 },
+    { 0x0037,  8349 },
+    { 0x0038,  8355 },
+    { 0x0039,  8362 },
+    { 0x003A,  8368 },
+    { 0x003B,  8393 },
+    { 0x003C,  8416 },
+    { 0x003D,  8443 },
+    { 0x003E,  8456 },
+    { 0x003F,  8472 },
+    { 0x0040,  8493 },
+    { 0x0041,  8514 },
+    { 0x0042,  8528 },
+    { 0x0043,  8542 },
+    { 0x0044,  8561 },
+    { 0x0045,  8581 },
+    { 0x0046,  8600 },
+    { 0x0047,  8620 },
+    { 0x0048,  8642 },
+    { 0x0049,  8656 },
+    { 0x004A,  8672 },
+    { 0x004B,  8688 },
+    { 0x004C,  8706 },
+    { 0x004D,  8721 },
+    { 0x004E,  8746 },
+    { 0x004F,  8761 },
+    { 0x0050,  8778 },
+    { 0x0051,  8790 },
+    { 0x0052,  8805 },
+    { 0x0053,  8813 },
+    { 0x0054,  8829 },
+    { 0x0055,  8846 },
+    { 0x0056,  8864 },
+    { 0x0057,  1156 },
+    { 0x0060,  8878 },
+    { 0x0061,  8895 },
+    { 0x0062,  8904 },
+    { 0x0063,  8913 },
+    { 0x0064,  8922 },
+    { 0x0065,  8931 },
+    { 0x0066,  8940 },
+    { 0x0067,  8949 },
+    { 0x0068,  8958 },
+    { 0x0001,  9008 },
+    { 0x0002,  9014 },
+    { 0x0003,  9032 },
+    { 0x0004,  9049 },
+    { 0x0005,  8140 },
+    { 0x0006,  9057 },
+    { 0x0007,  9075 },
+    { 0x0020,  9095 },
+    { 0x0021,  9107 },
+    { 0x0022,  9113 },
+    { 0x0023,  8148 },
+    { 0x0024,  9121 },
+    { 0x0025,  9128 },
+    { 0x0026,  9137 },
+    { 0x0027,  9142 },
+    { 0x0028,  9147 },
+    { 0x0029,  9161 },
+    { 0x002A,  9180 },
+    { 0x002B,  9185 },
+    { 0x002C,  8207 },
+    { 0x002D,  9199 },
+    { 0x002E,  9211 },
+    { 0x002F,  9223 },
+    { 0x0030,  9234 },
+    { 0x0031,  9244 },
+    { 0x0050,  9249 },
+    { 0x0051,  9260 },
+    { 0x0052,  9273 },
+    { 0x0053,  9287 },
+    { 0x0070,  9303 },
+    { 0x0071,  9314 },
+    { 0x0072,  7868 },
+    { 0x0073,  9327 },
+    { 0x0074,  9335 },
+    { 0x0090,  9349 },
+    { 0x0091,  9366 },
+    { 0x0092,  9384 },
+    { 0x0093,  9401 },
+    { 0x0094,  9419 },
+    { 0x0095,  9438 },
+    { 0x0096,  9454 },
+    { 0x0097,  9472 },
+    { 0x0098,  9487 },
+    { 0x0099,  9500 },
+    { 0x009A,  9518 },
+    { 0x009B,  9538 },
+    { 0x009C,  9558 },
+    { 0x009D,  9568 },
+    { 0x009E,  9585 },
+    { 0x00B0,  9592 },
+    { 0x00B1,  9604 },
+    { 0x00B2,  9616 },
+    { 0x00B3,  9628 },
+    { 0x00B4,  9640 },
+    { 0x00B5,  9652 },
+    { 0x00B6,  9664 },
+    { 0x00B7,  9676 },
+    { 0x00B8,  9688 },
+    { 0x00B9,  9700 },
+    { 0x00BA,  9712 },
+    { 0x00BB,  9727 },
+    { 0x00BC,  9743 },
+    { 0x00BD,  9755 },
+    { 0x00BE,  9767 },
+    { 0x00BF,  9779 },
+    { 0x00C0,  9791 },
+    { 0x00C1,  9814 },
+    { 0x00C2,  9834 },
+    { 0x00F0,  9853 },
+    { 0x00F1,  9866 },
+    { 0x00F2,  9881 },
+    { 0x00F3,  9898 },
+    { 0x00F4,  9921 },
+    { 0x00F5,  9931 },
+    { 0x00F8,  9956 },
+    { 0x00F9,  9971 },
+    { 0x00FA,  9986 },
+    { 0x00FB, 10001 },
+    { 0x00FC, 10019 },
+    { 0x00FD, 10039 },
+    { 0x00FE, 10064 },
+    { 0x0108, 10076 },
+    { 0x0109, 10098 },
+    { 0x010A, 10124 },
+    { 0x0110, 10134 },
+    { 0x0111, 10162 },
+    { 0x0112, 10190 },
+    { 0x0113, 10212 },
+    { 0x0114, 10234 },
+    { 0x0140, 10247 },
+    { 0x0141, 10265 },
+    { 0x0142, 10283 },
+    { 0x0143, 10299 },
+    { 0x0144, 10314 },
+    { 0x0145, 10331 },
+    { 0x0146, 10347 },
+    { 0x0147, 10364 },
+    { 0x014A, 10380 },
+    { 0x014B, 10394 },
+    { 0x0001, 10419 },
+    { 0x0002, 10436 },
+    { 0x0003, 10452 },
+    { 0x0004,  8153 },
+    { 0x0005, 10473 },
+    { 0x0006, 10483 },
+    { 0x0020, 10501 },
+    { 0x0021, 10505 },
+    { 0x0022, 10510 },
+    { 0x0030,  7856 },
+    { 0x0031, 10516 },
+    { 0x0032, 10522 },
+    { 0x0033, 10528 },
+    { 0x0034, 10540 },
+    { 0x0035, 10551 },
+    { 0x0036, 10564 },
+    { 0x0040, 10581 },
+    { 0x0041, 10586 },
+    { 0x0042, 10596 },
+    { 0x0043, 10604 },
+    { 0x0044, 10614 },
+    { 0x0045, 10624 },
+    { 0x0046, 10635 },
+    { 0x0047, 10647 },
+    { 0x0048, 10667 },
+    { 0x0060, 10687 },
+    { 0x0061, 10702 },
+    { 0x0062, 10717 },
+    { 0x0063, 10739 },
+    { 0x0064, 10746 },
+    { 0x0065, 10761 },
+    { 0x0066, 10770 },
+    { 0x0067, 10776 },
+    { 0x0068, 10802 },
+    { 0x0069, 10826 },
+    { 0x006A, 10842 },
+    { 0x006B, 10860 },
+    { 0x006C, 10877 },
+    { 0x006D, 10896 },
+    { 0x006E, 10903 },
+    { 0x006F, 10918 },
+    { 0x0070, 10947 },
+    { 0x0071, 10976 },
+    { 0x0072, 10995 },
+    { 0x0073, 11020 },
+    { 0x0074, 11054 },
+    { 0x0075, 11088 },
+    { 0x0076, 11116 },
+    { 0x0077, 11138 },
+    { 0x0078, 11161 },
+    { 0x0079, 11182 },
+    { 0x007A, 11212 },
+    { 0x007B, 11242 },
+    { 0x007C, 11271 },
+    { 0x007D, 11294 },
+    { 0x007E, 11325 },
+    { 0x007F, 11356 },
+    { 0x0080, 11380 },
+    { 0x0081, 11390 },
+    { 0x0082, 11407 },
+    { 0x0083, 11417 },
+    { 0x0084, 11429 },
+    { 0x0085, 11443 },
+    { 0x0086, 11455 },
+    { 0x0087, 11463 },
+    { 0x0088, 11479 },
+    { 0x0089, 11501 },
+    { 0x008A, 11517 },
+    { 0x008B, 11534 },
+    { 0x008C, 11551 },
+    { 0x008D, 11574 },
+    { 0x008E, 11601 },
+    { 0x008F, 11626 },
+    { 0x0090, 11645 },
+    { 0x0091, 11667 },
+    { 0x0092, 11683 },
+    { 0x0093, 11700 },
+    { 0x0094, 11719 },
+    { 0x0095, 11724 },
+    { 0x0096, 11729 },
+    { 0x0097, 11747 },
+    { 0x0098, 11766 },
+    { 0x0099, 11789 },
+    { 0x009A, 11811 },
+    { 0x009B, 11829 },
+    { 0x009C, 11847 },
+    { 0x009D, 11865 },
+    { 0x009E, 11883 },
+    { 0x00A0, 11900 },
+    { 0x00A1, 11909 },
+    { 0x00A2, 11914 },
+    { 0x00A3, 11920 },
+    { 0x00A4, 11927 },
+    { 0x00B0,  8344 },
+    { 0x00B1,  8349 },
+    { 0x00B2,  8355 },
+    { 0x00B3,  8331 },
+    { 0x00B4,  8324 },
+    { 0x00B5, 11935 },
+    { 0x00B6, 11951 },
+    { 0x00B7,  8319 },
+    { 0x00B8, 11971 },
+    { 0x00B9, 11977 },
+    { 0x00BA, 11989 },
+    { 0x00BB, 12001 },
+    { 0x00BC,  7975 },
+    { 0x00BD, 12012 },
+    { 0x00BE, 12021 },
+    { 0x00BF, 12034 },
+    { 0x00C0, 12048 },
+    { 0x00C1, 12062 },
+    { 0x00C2, 12073 },
+    { 0x00C3, 12078 },
+    { 0x00C4, 12089 },
+    { 0x00C5, 12106 },
+    { 0x00C6, 12121 },
+    { 0x00C7, 12141 },
+    { 0x00C8, 12163 },
+    { 0x00C9, 12177 },
+    { 0x00CA, 12190 },
+    { 0x00CB, 12209 },
+    { 0x00CC, 12228 },
+    { 0x00CD, 12239 },
+    { 0x00CE, 12250 },
+    { 0x00CF, 12260 },
+    { 0x00D0, 12274 },
+    { 0x00D1, 12299 },
+    { 0x00D2, 12328 },
+    { 0x00D3, 12352 },
+    { 0x00D4, 12376 },
+    { 0x00D5, 12409 },
+    { 0x00D6, 12442 },
+    { 0x00D7, 12471 },
+    { 0x00D8, 12500 },
+    { 0x00D9, 12538 },
+    { 0x00E0, 12566 },
+    { 0x00E1, 12573 },
+    { 0x00E2,  7883 },
+    { 0x00E3, 12581 },
+    { 0x00E4, 12586 },
+    { 0x00E5, 12593 },
+    { 0x00E6, 12604 },
+    { 0x00E7, 12618 },
+    { 0x00E8, 12627 },
+    { 0x00E9, 12631 },
+    { 0x00EA, 12648 },
+    { 0x00F0, 12665 },
+    { 0x00F1, 12678 },
+    { 0x00F2, 12693 },
+    { 0x00F3, 12707 },
+    { 0x00F4, 12717 },
+    { 0x00F5, 12731 },
+    { 0x0100, 12736 },
+    { 0x0101, 12747 },
+    { 0x0102, 12757 },
+    { 0x0103, 12770 },
+    { 0x0104, 12795 },
+    { 0x0105, 12818 },
+    { 0x0106, 12835 },
+    { 0x0107, 12851 },
+    { 0x0108, 12862 },
+    { 0x0109, 12875 },
+    { 0x010A, 12885 },
+    { 0x010B, 12892 },
+    { 0x010C, 12905 },
+    { 0x010D, 12918 },
+    { 0x0150, 12932 },
+    { 0x0151, 12946 },
+    { 0x0152, 12959 },
+    { 0x0153, 12974 },
+    { 0x0154, 12989 },
+    { 0x0155, 13006 },
+    { 0x0160, 13023 },
+    { 0x0161, 13038 },
+    { 0x0162, 13051 },
+    { 0x0163, 13065 },
+    { 0x0164, 13080 },
+    { 0x0165, 13094 },
+    { 0x0166, 13115 },
+    { 0x0167, 13128 },
+    { 0x0168, 13145 },
+    { 0x0169, 13179 },
+    { 0x016A, 13191 },
+    { 0x0170, 13207 },
+    { 0x0171, 13219 },
+    { 0x0172, 13241 },
+    { 0x0173, 13263 },
+    { 0x0174, 13289 },
+    { 0x0180, 13315 },
+    { 0x0181, 13342 },
+    { 0x0182, 13378 },
+    { 0x0183, 13415 },
+    { 0x0184, 13449 },
+    { 0x0185, 13467 },
+    { 0x0186, 13482 },
+    { 0x0187, 13497 },
+    { 0x0188, 13516 },
+    { 0x0189, 13536 },
+    { 0x018A, 13552 },
+    { 0x018B, 13568 },
+    { 0x018C, 13582 },
+    { 0x018D, 13595 },
+    { 0x018E, 13620 },
+    { 0x018F, 13641 },
+    { 0x0190, 13665 },
+    { 0x0191, 13689 },
+    { 0x0192, 13710 },
+    { 0x0193, 13724 },
+    { 0x0194, 13748 },
+    { 0x0195, 13773 },
+    { 0x0196, 13792 },
+    { 0x0197, 13812 },
+    { 0x0198, 13845 },
+    { 0x0199, 13867 },
+    { 0x019A, 13883 },
+    { 0x019B, 13903 },
+    { 0x019C, 13912 },
+    { 0x019D, 13922 },
+    { 0x019E, 13938 },
+    { 0x019F, 13967 },
+    { 0x01A0, 13984 },
+    { 0x01A1, 14014 },
+    { 0x01A2, 14038 },
+    { 0x01A3, 14065 },
+    { 0x01A4, 14090 },
+    { 0x01A5, 14119 },
+    { 0x01A6, 14155 },
+    { 0x01A7, 14181 },
+    { 0x01A8, 14194 },
+    { 0x01A9, 14207 },
+    { 0x01AA, 14221 },
+    { 0x01AB, 14232 },
+    { 0x01AC, 14247 },
+    { 0x01AD, 14264 },
+    { 0x01AE, 14283 },
+    { 0x01AF, 14302 },
+    { 0x01B0, 14322 },
+    { 0x01B1, 14336 },
+    { 0x01B2, 14352 },
+    { 0x01B3, 14362 },
+    { 0x01B4, 14371 },
+    { 0x01B5, 14387 },
+    { 0x01B6, 14403 },
+    { 0x01B7, 14420 },
+    { 0x01B8, 14437 },
+    { 0x01B9, 14454 },
+    { 0x01BA, 14480 },
+    { 0x01BC, 14498 },
+    { 0x01BD, 14519 },
+    { 0x01BE, 14558 },
+    { 0x01BF, 14570 },
+    { 0x01C0, 14590 },
+    { 0x01C1, 14623 },
+    { 0x01C2, 14650 },
+    { 0x01C3, 14680 },
+    { 0x01C4, 14714 },
+    { 0x01C5, 14751 },
+    { 0x01C6, 14778 },
+    { 0x01C7, 14805 },
+    { 0x01C8, 14821 },
+    { 0x01C9, 14839 },
+    { 0x01CA, 14855 },
+    { 0x01CB, 14869 },
+    { 0x0200, 14906 },
+    { 0x0201, 14939 },
+    { 0x0202, 14946 },
+    { 0x0203, 14954 },
+    { 0x0204, 14963 },
+    { 0x0205, 14971 },
+    { 0x0206, 14983 },
+    { 0x0207, 14995 },
+    { 0x0208, 15003 },
+    { 0x0209, 15012 },
+    { 0x021A, 15026 },
+    { 0x021B, 15034 },
+    { 0x021C, 15042 },
+    { 0x021D, 15049 },
+    { 0x021E, 15058 },
+    { 0x021F, 15072 },
+    { 0x0220, 15080 },
+    { 0x0221, 15100 },
+    { 0x0222, 15110 },
+    { 0x0223, 15119 },
+    { 0x0224, 15127 },
+    { 0x0225, 15135 },
+    { 0x0226, 15146 },
+    { 0x0227, 15154 },
+    { 0x0228, 15165 },
+    { 0x0229, 15182 },
+    { 0x022A, 15195 },
+    { 0x022B, 15208 },
+    { 0x022C, 15219 },
+    { 0x022D, 15236 },
+    { 0x022E, 15247 },
+    { 0x022F, 15259 },
+    { 0x0230, 15267 },
+    { 0x0231, 15287 },
+    { 0x0232, 15302 },
+    { 0x0233, 15317 },
+    { 0x0234, 15330 },
+    { 0x0235, 15345 },
+    { 0x0236, 15355 },
+    { 0x0237, 15367 },
+    { 0x0238, 15380 },
+    { 0x0239, 15387 },
+    { 0x023A, 15401 },
+    { 0x023B, 15422 },
+    { 0x023C, 15441 },
+    { 0x023D, 15451 },
+    { 0x023E, 15459 },
+    { 0x023F, 15467 },
+    { 0x0240, 15478 },
+    { 0x0241, 15491 },
+    { 0x0242, 15508 },
+    { 0x0243, 15521 },
+    { 0x0244, 15536 },
+    { 0x0245, 15548 },
+    { 0x0246, 15558 },
+    { 0x0247, 15568 },
+    { 0x0248, 15587 },
+    { 0x0249, 15604 },
+    { 0x024A, 15625 },
+    { 0x024B, 15644 },
+    { 0x024C, 15659 },
+    { 0x024D, 15673 },
+    { 0x024E, 15686 },
+    { 0x024F, 15702 },
+    { 0x0250, 15722 },
+    { 0x0251, 15739 },
+    { 0x0252, 15758 },
+    { 0x0253, 15773 },
+    { 0x0254, 15793 },
+    { 0x0255, 15811 },
+    { 0x0256, 15830 },
+    { 0x0257, 15849 },
+    { 0x0258, 15868 },
+    { 0x0259, 15885 },
+    { 0x025A, 15906 },
+    { 0x025B, 15923 },
+    { 0x025C, 15934 },
+    { 0x025D, 15944 },
+    { 0x025E, 15951 },
+    { 0x025F, 15957 },
+    { 0x0260, 15967 },
+    { 0x0261, 15978 },
+    { 0x0262, 15994 },
+    { 0x0263, 16009 },
+    { 0x0264, 16019 },
+    { 0x0265, 16033 },
+    { 0x0266, 16045 },
+    { 0x0267, 16061 },
+    { 0x0268, 16078 },
+    { 0x0269, 16095 },
+    { 0x026A, 16110 },
+    { 0x026B, 16120 },
+    { 0x026C, 16128 },
+    { 0x026D, 16138 },
+    { 0x026E, 16149 },
+    { 0x026F, 16162 },
+    { 0x0270, 16180 },
+    { 0x0271, 16198 },
+    { 0x0272, 16214 },
+    { 0x0273, 16229 },
+    { 0x0274, 16248 },
+    { 0x0275, 16268 },
+    { 0x0276, 16285 },
+    { 0x0277, 16299 },
+    { 0x0278, 16315 },
+    { 0x0279, 16332 },
+    { 0x027A, 16347 },
+    { 0x027B, 16355 },
+    { 0x027C, 16373 },
+    { 0x027D, 16392 },
+    { 0x027E, 16402 },
+    { 0x027F, 16415 },
+    { 0x0280, 16429 },
+    { 0x0281, 16449 },
+    { 0x0282, 16468 },
+    { 0x0283, 16481 },
+    { 0x0284, 16496 },
+    { 0x0285, 16512 },
+    { 0x0286, 16527 },
+    { 0x0287, 16542 },
+    { 0x0288, 16558 },
+    { 0x0289, 16569 },
+    { 0x028A, 16578 },
+    { 0x028B, 16591 },
+    { 0x028C, 16606 },
+    { 0x028D, 16614 },
+    { 0x028E, 16629 },
+    { 0x028F, 16639 },
+    { 0x0290, 16668 },
+    { 0x0291, 16683 },
+    { 0x0292, 16697 },
+    { 0x0293, 16714 },
+    { 0x0294, 16729 },
+    { 0x0295, 16747 },
+    { 0x0296, 16764 },
+    { 0x0297, 16781 },
+    { 0x0298, 16799 },
+    { 0x0299, 16809 },
+    { 0x029A, 16818 },
+    { 0x029B, 16827 },
+    { 0x029C, 16853 },
+    { 0x029D, 16878 },
+    { 0x029E, 16909 },
+    { 0x029F, 16932 },
+    { 0x02A0, 16960 },
+    { 0x02A1, 16977 },
+    { 0x02A2, 16995 },
+    { 0x02B0, 17028 },
+    { 0x02C0, 17047 },
+    { 0x02C1, 17087 },
+    { 0x02C2, 17108 },
+    { 0x02C3, 17126 },
+    { 0x02C4, 17151 },
+    { 0x02C5, 17194 },
+    { 0x02C6, 17227 },
+    { 0x02C7, 17270 },
+    { 0x02C8, 17301 },
+    { 0x02C9, 17328 },
+    { 0x02CA, 17365 },
+    { 0x02CB, 17398 },
+    { 0x02CC, 17427 },
+    { 0x02D0, 17456 },
+    { 0x02D1, 17478 },
+    { 0x02D2, 17509 },
+    { 0x02D3, 17540 },
+    { 0x02D4, 17569 },
+    { 0x0500, 17598 },
+    { 0x0501, 17613 },
+    { 0x0502, 17627 },
+    { 0x0503, 17649 },
+    { 0x0504, 17663 },
+    { 0x0505, 17680 },
+    { 0x0506, 17699 },
+    { 0x0507, 17717 },
+    { 0x0508, 17735 },
+    { 0x0509, 17765 },
+    { 0x050A, 17795 },
+    { 0x050B, 17823 },
+    { 0x050C, 17850 },
+    { 0x050D, 17875 },
+    { 0x050E, 17902 },
+    { 0x050F, 17925 },
+    { 0x0510, 17948 },
+    { 0x0511, 17968 },
+    { 0x0512, 17987 },
+    { 0x0513, 18013 },
+    { 0x0514, 18033 },
+    { 0x0001, 18058 },
+    { 0x0002, 18068 },
+    { 0x0003, 18072 },
+    { 0x0004, 18082 },
+    { 0x0005, 18095 },
+    { 0x0006, 18105 },
+    { 0x0007, 18116 },
+    { 0x0008, 18145 },
+    { 0x0009, 18158 },
+    { 0x000A, 18173 },
+    { 0x000B, 18189 },
+    { 0x000C, 18198 },
+    { 0x000D, 18223 },
+    { 0x000E, 18239 },
+    { 0x000F, 18260 },
+    { 0x0020, 18290 },
+    { 0x0021, 18297 },
+    { 0x0022, 18302 },
+    { 0x0023, 18309 },
+    { 0x0024, 18325 },
+    { 0x0030, 18343 },
+    { 0x0031, 18356 },
+    { 0x0032, 18372 },
+    { 0x0033, 18381 },
+    { 0x0034, 18387 },
+    { 0x0035, 18395 },
+    { 0x0036, 18399 },
+    { 0x0037, 18407 },
+    { 0x0038, 18418 },
+    { 0x0039, 18435 },
+    { 0x003A, 18456 },
+    { 0x003B,  3718 },
+    { 0x003C, 18476 },
+    { 0x003D, 18483 },
+    { 0x003E, 18490 },
+    { 0x003F, 18497 },
+    { 0x0040, 18505 },
+    { 0x0041, 18514 },
+    { 0x0042, 18520 },
+    { 0x0043, 18531 },
+    { 0x0044, 18552 },
+    { 0x0045, 18566 },
+    { 0x0046, 18573 },
+    { 0x0047, 18585 },
+    { 0x0048, 18597 },
+    { 0x0049, 18603 },
+    { 0x0051, 18610 },
+    { 0x0052, 18629 },
+    { 0x0053, 18641 },
+    { 0x0054, 18659 },
+    { 0x0055, 18673 },
+    { 0x0056, 18695 },
+    { 0x0057, 18705 },
+    { 0x0058, 18720 },
+    { 0x0059, 18734 },
+    { 0x005A, 18743 },
+    { 0x005B, 18767 },
+    { 0x005C, 18792 },
+    { 0x005D, 18808 },
+    { 0x005E, 18834 },
+    { 0x005F, 18855 },
+    { 0x0060, 18886 },
+    { 0x0061, 18899 },
+    { 0x0062, 18925 },
+    { 0x0063, 18955 },
+    { 0x0064, 18978 },
+    { 0x0065, 19005 },
+    { 0x0066, 19037 },
+    { 0x0067, 19084 },
+    { 0x0068, 19128 },
+    { 0x0069, 19175 },
+    { 0x006A, 19219 },
+    { 0x006B, 19258 },
+    { 0x006C, 19295 },
+    { 0x006D, 19326 },
+    { 0x006E, 19351 },
+    { 0x006F, 19383 },
+    { 0x0070, 19402 },
+    { 0x0071, 19423 },
+    { 0x0072, 19454 },
+    { 0x0073, 19458 },
+    { 0x0074, 19465 },
+    { 0x0075, 19477 },
+    { 0x0076, 19491 },
+    { 0x0077, 19497 },
+    { 0x0080, 19511 },
+    { 0x0081, 19532 },
+    { 0x0082, 19548 },
+    { 0x0083, 19566 },
+    { 0x0084, 19591 },
+    { 0x0085, 19627 },
+    { 0x0090, 19642 },
+    { 0x0091, 19667 },
+    { 0x0092, 19688 },
+    { 0x0093, 19710 },
+    { 0x0094, 19737 },
+    { 0x0095, 19768 },
+    { 0x0096, 19780 },
+    { 0x0097, 19799 },
+    { 0x0098, 19812 },
+    { 0x00A0, 19835 },
+    { 0x00A1, 19858 },
+    { 0x00A2, 19870 },
+    { 0x00A3, 19891 },
+    { 0x00A4, 19907 },
+    { 0x00A5, 19928 },
+    { 0x00A6, 19948 },
+    { 0x00B0, 19974 },
+    { 0x0001, 20005 },
+    { 0x0010, 20030 },
+    { 0x0011, 20044 },
+    { 0x0020, 20058 },
+    { 0x0021, 20071 },
+    { 0x0022, 20086 },
+    { 0x0023, 20118 },
+    { 0x0024, 20128 },
+    { 0x0025, 20141 },
+    { 0x0026, 20158 },
+    { 0x0027, 20179 },
+    { 0x0028, 20198 },
+    { 0x1001, 20219 },
+    { 0x1002, 20233 },
+    { 0x1003, 20247 },
+    { 0x1004, 20262 },
+    { 0x1005, 20287 },
+    { 0x1006, 20314 },
+    { 0x1007, 20329 },
+    { 0x1008, 20346 },
+    { 0x1009, 20361 },
+    { 0x100A, 20378 },
+    { 0x100B, 20393 },
+    { 0x100C, 20417 },
+    { 0x100D, 20444 },
+    { 0x100E, 20471 },
+    { 0x100F, 20505 },
+    { 0x1010, 20531 },
+    { 0x1011, 20558 },
+    { 0x0001, 20586 },
+    { 0x0020, 20608 },
+    { 0x0021, 20615 },
+    { 0x0022, 20633 },
+    { 0x0023, 20662 },
+    { 0x0024, 20685 },
+    { 0x0025, 20694 },
+    { 0x0026, 20706 },
+    { 0x0027, 20724 },
+    { 0x0028, 20732 },
+    { 0x0030, 20748 },
+    { 0x0031, 20758 },
+    { 0x0032, 20766 },
+    { 0x0033, 20778 },
+    { 0x0034, 20793 },
+    { 0x0040, 20810 },
+    { 0x0041, 20820 },
+    { 0x0042, 20830 },
+    { 0x0043, 20841 },
+    { 0x0050, 20853 },
+    { 0x0051, 20862 },
+    { 0x0052, 20876 },
+    { 0x0053, 20881 },
+    { 0x0054, 20896 },
+    { 0x0055, 20920 },
+    { 0x0056, 20932 },
+    { 0x0057, 20949 },
+    { 0x0058, 20959 },
+    { 0x0059, 20986 },
+    { 0x005A, 20997 },
+    { 0x005B, 21017 },
+    { 0x005C, 21030 },
+    { 0x005D, 21042 },
+    { 0x005E, 21053 },
+    { 0x005F, 21063 },
+    { 0x0060, 21084 },
+    { 0x0061, 21104 },
+    { 0x0062, 21125 },
+    { 0x0063, 21146 },
+    { 0x0064, 21166 },
+    { 0x0065, 21186 },
+    { 0x0066, 21196 },
+    { 0x0067, 21218 },
+    { 0x0068, 21244 },
+    { 0x0069, 21269 },
+    { 0x006A, 21287 },
+    { 0x006B, 21320 },
+    { 0x006C, 21344 },
+    { 0x006D, 21369 },
+    { 0x006E, 21382 },
+    { 0x006F, 21402 },
+    { 0x0070, 21409 },
+    { 0x0071, 21419 },
+    { 0x0072, 21425 },
+    { 0x0073, 21432 },
+    { 0x0074, 21458 },
+    { 0x0075, 21480 },
+    { 0x0076, 21491 },
+    { 0x0077, 21500 },
+    { 0x0078, 21524 },
+    { 0x0079, 21541 },
+    { 0x007A, 21557 },
+    { 0x007B, 21578 },
+    { 0x007C, 21593 },
+    { 0x007D, 21604 },
+    { 0x007E, 21623 },
+    { 0x007F, 21635 },
+    { 0x0080, 21664 },
+    { 0x0081, 21678 },
+    { 0x0082, 21692 },
+    { 0x0083, 21715 },
+    { 0x0084, 21740 },
+    { 0x0085, 21755 },
+    { 0x0086, 21783 },
+    { 0x0087, 21795 },
+    { 0x0088, 21812 },
+    { 0x0089, 21824 },
+    { 0x008B, 21859 },
+    { 0x008C, 21894 },
+    { 0x008D, 21913 },
+    { 0x008E, 21929 },
+    { 0x008F, 21946 },
+    { 0x0090, 21959 },
+    { 0x0091, 21994 },
+    { 0x0092, 22021 },
+    { 0x0094, 22038 },
+    { 0x0095, 22053 },
+    { 0x0096, 22079 },
+    { 0x0097, 22098 },
+    { 0x0098, 22118 },
+    { 0x0099, 22139 },
+    { 0x009A, 22159 },
+    { 0x009B, 22168 },
+    { 0x009C, 22177 },
+    { 0x009F, 22189 },
+    { 0x00A0, 22203 },
+    { 0x00A4, 22221 },
+    { 0x00A5, 22235 },
+    { 0x00A6, 22260 },
+    { 0x00A7, 22275 },
+    { 0x00A8, 22287 },
+    { 0x00A9, 22308 },
+    { 0x00AA, 22328 },
+    { 0x00AB, 22352 },
+    { 0x00AC, 22393 },
+    { 0x0001, 22416 },
+    { 0x0002, 22427 },
+    { 0x0003, 22444 },
+    { 0x0004, 22459 },
+    { 0x0005, 22477 },
+    { 0x0006, 22504 },
+    { 0x0007, 22516 },
+    { 0x0008, 22539 },
+    { 0x0009, 22568 },
+    { 0x000A, 22585 },
+    { 0x0001, 22627 },
+    { 0x0002,  2795 },
+    { 0x0010, 22639 },
+    { 0x0011, 22653 },
+    { 0x0012, 22666 },
+    { 0x0013, 22680 },
+    { 0x0014, 22687 },
+    { 0x0020, 22695 },
+    { 0x0021, 22712 },
+    { 0x0022, 22723 },
+    { 0x0023, 22734 },
+    { 0x0024, 22745 },
+    { 0x0025, 22756 },
+    { 0x0026, 22774 },
+    { 0x0027, 22793 },
+    { 0x0028, 22807 },
+    { 0x0029, 22828 },
+    { 0x002A, 22850 },
+    { 0x002B, 22872 },
+    { 0x0100, 22894 },
+    { 0x0101, 22910 },
+    { 0x0102, 22936 },
+    { 0x0103, 22962 },
+    { 0x0104, 22988 },
+    { 0x0105, 23015 },
+    { 0x0200, 23043 },
+    { 0x0201, 23067 },
+    { 0x0202, 23086 },
+    { 0x0203, 23108 },
+    { 0x0204, 23134 },
+    { 0x0205, 23158 },
+    { 0x0300, 23183 },
+    { 0x0301, 23202 },
+    { 0x0400, 23223 },
+    { 0x0001, 23261 },
+    { 0x0002, 23243 },
+    { 0x0020, 23282 },
+    { 0x0021, 23308 },
+    { 0x0022, 23328 },
+    { 0x0023, 23343 },
+    { 0x0024, 23358 },
+    { 0x0025, 23381 },
+    { 0x0026,  2891 },
+    { 0x0027, 23395 },
+    { 0x0028, 23414 },
+    { 0x0029, 23434 },
+    { 0x002A, 23450 },
+    { 0x002B, 23468 },
+    { 0x002C, 23485 },
+    { 0x002D, 23498 },
+    { 0x002E, 23513 },
+    { 0x002F, 23528 },
+    { 0x0030, 23539 },
+    { 0x0031, 23568 },
+    { 0x0032, 23597 },
+    { 0x0033, 23620 },
+    { 0x0034, 23624 },
+    { 0x0035, 23631 },
+    { 0x0036, 23636 },
+    { 0x0037, 23644 },
+    { 0x0038, 23669 },
+    { 0x0039, 23681 },
+    { 0x003A, 23695 },
+    { 0x003B, 23708 },
+    { 0x003C, 23720 },
+    { 0x003D, 23730 },
+    { 0x003E, 23746 },
+    { 0x003F, 23763 },
+    { 0x0040, 23792 },
+    { 0x0041, 23819 },
+    { 0x0042, 23841 },
+    { 0x0043, 23856 },
+    { 0x0044, 23877 },
+    { 0x0045, 23893 },
+    { 0x0046, 10976 },
+    { 0x0047, 23915 },
+    { 0x0048, 23932 },
+    { 0x0049, 23952 },
+    { 0x004A, 23971 },
+    { 0x004B, 23986 },
+    { 0x004C, 24004 },
+    { 0x004D, 24024 },
+    { 0x0080, 24040 },
+    { 0x0081, 24054 },
+    { 0x0082, 24068 },
+    { 0x0083, 24082 },
+    { 0x0084, 24099 },
+    { 0x0085, 24119 },
+    { 0x0086, 24134 },
+    { 0x0087, 24152 },
+    { 0x0088, 24172 },
+    { 0x008A, 24185 },
+    { 0x008B, 24197 },
+    { 0x008C, 24215 },
+    { 0x008D, 24233 },
+    { 0x008E, 24251 },
+    { 0x008F, 24269 },
+    { 0x0090, 24279 },
+    { 0x0091, 24291 },
+    { 0x0092, 24306 },
+    { 0x0093, 24323 },
+    { 0x0094, 24344 },
+    { 0x0095, 24365 },
+    { 0x00C2, 24384 },
+    { 0x00CC, 24394 },
+    { 0x00CF, 24418 },
+    { 0x00DD, 24436 },
+    { 0x00DF, 24455 },
+    { 0x00FF, 24478 },
+    { 0x0001, 24501 },
+    { 0x0010, 24508 },
+    { 0x0011, 24518 },
+    { 0x0012, 24544 },
+    { 0x0013, 24571 },
+    { 0x0014, 24594 },
+    { 0x0015, 24620 },
+    { 0x0016, 24648 },
+    { 0x0017, 24670 },
+    { 0x0018, 24704 },
+    { 0x0019, 24744 },
+    { 0x0020, 24772 },
+    { 0x0021, 24783 },
+    { 0x0022, 24807 },
+    { 0x0023, 24827 },
+    { 0x0024, 24845 },
+    { 0x0025, 24868 },
+    { 0x0026, 24891 },
+    { 0x0027, 24911 },
+    { 0x0028, 24937 },
+    { 0x0029, 24959 },
+    { 0x0030, 24978 },
+    { 0x0031, 24992 },
+    { 0x0032, 25028 },
+    { 0x0033, 25052 },
+    { 0x0034, 25079 },
+    { 0x0035, 25109 },
+    { 0x0036, 25135 },
+    { 0x0037, 25162 },
+    { 0x0038, 25188 },
+    { 0x0039, 25223 },
+    { 0x003A, 25265 },
+    { 0x003B, 25296 },
+    { 0x0040, 25328 },
+    { 0x0041, 25334 },
+    { 0x0042, 25355 },
+    { 0x0043, 25380 },
+    { 0x0044, 25402 },
+    { 0x0045, 25423 },
+    { 0x0050, 25448 },
+    { 0x0051, 25457 },
+    { 0x0052, 25477 },
+    { 0x0053, 25502 },
+    { 0x0054, 25544 },
+    { 0x0055, 25561 },
+    { 0x0056, 25577 },
+    { 0x0057, 25594 },
+    { 0x0060, 25618 },
+    { 0x0061, 25629 },
+    { 0x0062, 25656 },
+    { 0x0063, 25689 },
+    { 0x0064, 25719 },
+    { 0x0065, 25737 },
+    { 0x0066, 25758 },
+    { 0x0067, 25777 },
+    { 0x0068, 25796 },
+    { 0x0069, 25824 },
+    { 0x0070, 12885 },
+    { 0x0071, 25855 },
+    { 0x0072, 25880 },
+    { 0x0073, 25905 },
+    { 0x0074, 25930 },
+    { 0x0075, 25951 },
+    { 0x0076, 25972 },
+    { 0x0077, 25993 },
+    { 0x0078, 26017 },
+    { 0x0079, 26037 },
+    { 0x007A, 26059 },
+    { 0x007B, 26077 },
+    { 0x007C, 26100 },
+    { 0x0080, 26129 },
+    { 0x0081, 26141 },
+    { 0x0082, 26165 },
+    { 0x0083, 26189 },
+    { 0x0084, 26213 },
+    { 0x0085, 26242 },
+    { 0x0086, 26271 },
+    { 0x0087, 26300 },
+    { 0x0088, 26325 },
+    { 0x0089, 26350 },
+    { 0x008A, 26375 },
+    { 0x008B, 26407 },
+    { 0x008C, 26428 },
+    { 0x008D, 26454 },
+    { 0x008E, 26476 },
+    { 0x008F, 26510 },
+    { 0x0090, 26542 },
+    { 0x0091, 26550 },
+    { 0x0092, 26567 },
+    { 0x0093, 26581 },
+    { 0x00A0, 26594 },
+    { 0x00A1, 26599 },
+    { 0x00A2, 26617 },
+    { 0x00B0, 26639 },
+    { 0x00B1, 26657 },
+    { 0x00B2, 26695 },
+    { 0x00B3, 26730 },
+    { 0x00B4, 26759 },
+    { 0x00C0, 26793 },
+    { 0x00C1, 26814 },
+    { 0x00C2, 26860 },
+    { 0x00D0, 26895 },
+    { 0x00D1, 26903 },
+    { 0x00D2, 26933 },
+    { 0x00E0, 26961 },
+    { 0x00E1, 26967 },
+    { 0x00E2, 26981 },
+    { 0x00E3, 26996 },
+    { 0x00E4, 27022 },
+    { 0x00F0, 27041 },
+    { 0x00F1, 27059 },
+    { 0x00F2, 27077 },
+    { 0x00F3, 27095 },
+    { 0x00F4, 27113 },
+    { 0x00F5, 27131 },
+    { 0x00F6, 27149 },
+    { 0x00F7, 27167 },
+    { 0x00F8, 27185 },
+    { 0x00F9, 27203 },
+    { 0x00FA, 27222 },
+    { 0x00FB, 27241 },
+    { 0x00FC, 27260 },
+    { 0x00FD, 27279 },
+    { 0x00FE, 27298 },
+    { 0x00FF, 27317 },
+    { 0x0200, 27336 },
+    { 0x0201, 27342 },
+    { 0x0202, 27362 },
+    { 0x0300, 27382 },
+    { 0x0301, 27391 },
+    { 0x0302, 27415 },
+    { 0x0303, 27446 },
+    { 0x0304, 27470 },
+    { 0x0305, 27504 },
+    { 0x0306, 27534 },
+    { 0x0307, 27557 },
+    { 0x0308, 27588 },
+    { 0x0309, 27617 },
+    { 0x030A, 27650 },
+    { 0x030B, 27679 },
+    { 0x030C, 27707 },
+    { 0x030D, 27734 },
+    { 0x030E, 27757 },
+    { 0x030F, 27783 },
+    { 0x0310, 27821 },
+    { 0x0311, 27867 },
+    { 0x0312, 27913 },
+    { 0x0313, 27932 },
+    { 0x0314, 27953 },
+    { 0x0315, 27971 },
+    { 0x0316, 27989 },
+    { 0x0317, 28015 },
+    { 0x0318, 28039 },
+    { 0x0319, 28064 },
+    { 0x031A, 28086 },
+    { 0x031B, 28116 },
+    { 0x031C, 28141 },
+    { 0x031D, 28169 },
+    { 0x031E, 28205 },
+    { 0x031F, 28226 },
+    { 0x0400, 28266 },
+    { 0x0402, 28287 },
+    { 0x0403, 28326 },
+    { 0x0404, 28372 },
+    { 0x0405, 28409 },
+    { 0x0406, 28440 },
+    { 0x0407, 28477 },
+    { 0x0408, 28508 },
+    { 0x0409, 28546 },
+    { 0x040A, 28571 },
+    { 0x040B, 28595 },
+    { 0x040C, 28616 },
+    { 0x040D, 28647 },
+    { 0x040E, 28678 },
+    { 0x040F, 28709 },
+    { 0x0410, 28732 },
+    { 0x0411, 28775 },
+    { 0x0412, 28820 },
+    { 0x0413, 28863 },
+    { 0x0414, 28884 },
+    { 0x0415, 28906 },
+    { 0x0416, 28931 },
+    { 0x0417, 28960 },
+    { 0x0418, 28991 },
+    { 0x0419, 29009 },
+    { 0x041A, 29040 },
+    { 0x041B, 29079 },
+    { 0x041C, 29120 },
+    { 0x041D, 29155 },
+    { 0x041E, 29191 },
+    { 0x041F, 29233 },
+    { 0x0420, 29267 },
+    { 0x0421, 29300 },
+    { 0x0422, 29326 },
+    { 0x0423, 29353 },
+    { 0x0424, 29380 },
+    { 0x0425, 29397 },
+    { 0x0426, 29427 },
+    { 0x0427, 29457 },
+    { 0x042A, 29481 },
+    { 0x042B, 29500 },
+    { 0x0430, 29536 },
+    { 0x0431, 29562 },
+    { 0x0433, 29595 },
+    { 0x0434, 29625 },
+    { 0x0435, 29649 },
+    { 0x0436, 29676 },
+    { 0x0437, 29699 },
+    { 0x0438, 29729 },
+    { 0x0439, 29756 },
+    { 0x043A, 29808 },
+    { 0x043B, 29836 },
+    { 0x043C, 29871 },
+    { 0x0440, 29913 },
+    { 0x0441, 29937 },
+    { 0x0450, 29966 },
+    { 0x0451, 29985 },
+    { 0x0452, 30010 },
+    { 0x0453, 30035 },
+    { 0x0454, 30067 },
+    { 0x0455, 30099 },
+    { 0x0456, 30131 },
+    { 0x0457, 30160 },
+    { 0x0458, 30202 },
+    { 0x0459, 30244 },
+    { 0x045A, 30286 },
+    { 0x045B, 30315 },
+    { 0x045C, 30357 },
+    { 0x045D, 30399 },
+    { 0x045E, 30441 },
+    { 0x045F, 30466 },
+    { 0x0470, 30495 },
+    { 0x0471, 30519 },
+    { 0x0472, 30539 },
+    { 0x0473, 30566 },
+    { 0x0474, 30593 },
+    { 0x0475, 30620 },
+    { 0x0476, 30667 },
+    { 0x0477, 30710 },
+    { 0x0478, 30745 },
+    { 0x0479, 30776 },
+    { 0x047A, 30797 },
+    { 0x047B, 30825 },
+    { 0x047C, 30853 },
+    { 0x047D, 30881 },
+    { 0x047E, 30915 },
+    { 0x047F, 30932 },
+    { 0x0480, 30956 },
+    { 0x0481, 30980 },
+    { 0x0482, 31004 },
+    { 0x0483, 31032 },
+    { 0x0484, 31055 },
+    { 0x0485, 31081 },
+    { 0x0486, 31114 },
+    { 0x0487, 31147 },
+    { 0x0488, 31180 },
+    { 0x0489, 31214 },
+    { 0x0490, 31255 },
+    { 0x0491, 31278 },
+    { 0x0492, 31311 },
+    { 0x0493, 31351 },
+    { 0x0494, 31387 },
+    { 0x0495, 31405 },
+    { 0x0496, 31435 },
+    { 0x0497, 31462 },
+    { 0x0498, 31481 },
+    { 0x04A0, 31500 },
+    { 0x04A1, 31521 },
+    { 0x04A2, 31547 },
+    { 0x04A3, 31581 },
+    { 0x04B0, 31616 },
+    { 0x04B1, 31638 },
+    { 0x04B2, 31665 },
+    { 0x04B3, 31699 },
+    { 0x04B4, 31740 },
+    { 0x04B5, 31770 },
+    { 0x04B6, 31797 },
+    { 0x04B7, 31834 },
+    { 0x04B8, 31870 },
+    { 0x04B9, 31893 },
+    { 0x04BA, 31924 },
+    { 0x04BB, 31955 },
+    { 0x04BC, 31984 },
+    { 0x04BD, 32001 },
+    { 0x04D0, 32038 },
+    { 0x04D1, 32056 },
+    { 0x04D2, 32080 },
+    { 0x04D3, 32110 },
+    { 0x04D4, 32135 },
+    { 0x04D5, 32162 },
+    { 0x04D6, 32189 },
+    { 0x04D7, 32230 },
+    { 0x04D8, 32257 },
+    { 0x04D9, 32279 },
+    { 0x04DA, 32303 },
+    { 0x04DB, 32326 },
+    { 0x04DC, 32358 },
+    { 0x04DD, 32390 },
+    { 0x04DE, 32420 },
+    { 0x04DF, 32452 },
+    { 0x04E0, 32468 },
+    { 0x04E2, 32504 },
+    { 0x04E3, 32540 },
+    { 0x04F0, 32571 },
+    { 0x04F1, 32591 },
+    { 0x04F2, 32619 },
+    { 0x04F8, 32652 },
+    { 0x04F9, 32670 },
+    { 0x0500, 32698 },
+    { 0x0501, 32721 },
+    { 0x0502, 32745 },
+    { 0x0503, 32765 },
+    { 0x0504, 32794 },
+    { 0x0505, 32817 },
+    { 0x0506, 32840 },
+    { 0x0507, 32860 },
+    { 0x0508, 32882 },
+    { 0x0509, 32901 },
+    { 0x0520, 32930 },
+    { 0x0521, 32947 },
+    { 0x0522, 32964 },
+    { 0x0523, 32982 },
+    { 0x0524, 32998 },
+    { 0x0525, 33022 },
+    { 0x0526, 33039 },
+    { 0x0527, 33058 },
+    { 0x0528, 33077 },
+    { 0x0529, 33101 },
+    { 0x052A, 33123 },
+    { 0x052B, 33154 },
+    { 0x0530, 33189 },
+    { 0x0531, 33204 },
+    { 0x0532, 33240 },
+    { 0x0533, 33265 },
+    { 0x0534, 33306 },
+    { 0x0535, 33337 },
+    { 0x0540, 33357 },
+    { 0x0541, 33376 },
+    { 0x0542, 33401 },
+    { 0x0543, 33434 },
+    { 0x0544, 33459 },
+    { 0x0545, 33486 },
+    { 0x0546, 33513 },
+    { 0x0547, 33540 },
+    { 0x0548, 33567 },
+    { 0x0549, 33594 },
+    { 0x054A, 33621 },
+    { 0x054B, 33648 },
+    { 0x054C, 33675 },
+    { 0x054D, 33702 },
+    { 0x054E, 33730 },
+    { 0x054F, 33758 },
+    { 0x0550, 33786 },
+    { 0x0551, 33814 },
+    { 0x0552, 33842 },
+    { 0x0553, 33870 },
+    { 0x0554, 33898 },
+    { 0x0555, 33926 },
+    { 0x0556, 33954 },
+    { 0x0557, 33982 },
+    { 0x0558, 34010 },
+    { 0x0559, 34038 },
+    { 0x055A, 34066 },
+    { 0x055B, 34094 },
+    { 0x055C, 34122 },
+    { 0x055D, 34150 },
+    { 0x055E, 34178 },
+    { 0x055F, 34206 },
+    { 0x0560, 34234 },
+    { 0x0561, 34254 },
+    { 0x0562, 34294 },
+    { 0x0563, 34328 },
+    { 0x0564, 34358 },
+    { 0x0565, 34396 },
+    { 0x0566, 34437 },
+    { 0x0567, 34480 },
+    { 0x0568, 34506 },
+    { 0x0569, 34535 },
+    { 0x056A, 34566 },
+    { 0x056B, 34605 },
+    { 0x056C, 34644 },
+    { 0x056D, 34689 },
+    { 0x056E, 34714 },
+    { 0x056F, 34746 },
+    { 0x0570, 34790 },
+    { 0x0571, 34820 },
+    { 0x0572, 34867 },
+    { 0x0573, 34904 },
+    { 0x0574, 34940 },
+    { 0x0575, 34974 },
+    { 0x0576, 35006 },
+    { 0x0580, 35039 },
+    { 0x0581, 35057 },
+    { 0x0582, 35094 },
+    { 0x0590, 35131 },
+    { 0x0591, 35161 },
+    { 0x0592, 35187 },
+    { 0x0593, 35214 },
+    { 0x0594, 35242 },
+    { 0x0595, 35265 },
+    { 0x0596, 35294 },
+    { 0x0597, 35320 },
+    { 0x05A0, 35342 },
+    { 0x05A1, 35388 },
+    { 0x05A2, 35423 },
+    { 0x05A3, 35459 },
+    { 0x05A4, 35490 },
+    { 0x05A5, 35522 },
+    { 0x05B0, 35545 },
+    { 0x05C0, 35572 },
+    { 0x05C1, 35589 },
+    { 0x05C2, 35614 },
+    { 0x05C3, 35639 },
+    { 0x05C4, 35664 },
+    { 0x05C5, 35689 },
+    { 0x05C6, 35714 },
+    { 0x05C7, 35739 },
+    { 0x05C8, 35764 },
+    { 0x05C9, 35789 },
+    { 0x05CA, 35814 },
+    { 0x05CB, 35840 },
+    { 0x05CC, 35866 },
+    { 0x05CD, 35892 },
+    { 0x05CE, 35918 },
+    { 0x05CF, 35944 },
+    { 0x05D0, 35970 },
+    { 0x05E0, 35996 },
+    { 0x05E1, 36014 },
+    { 0x05F0, 36038 },
+    { 0x05F1, 36065 },
+    { 0x05F2, 36091 },
+    { 0x05F3, 36128 },
+    { 0x05F4, 36163 },
+    { 0x05F5, 36205 },
+    { 0x0800, 36233 },
+    { 0x0801, 36257 },
+    { 0x0802, 36277 },
+    { 0x0803, 36305 },
+    { 0x0804, 36327 },
+    { 0x0805, 36354 },
+    { 0x0806, 36382 },
+    { 0x0810, 36402 },
+    { 0x0811, 36424 },
+    { 0x0812, 36452 },
+    { 0x0813, 36483 },
+    { 0x0814, 36510 },
+    { 0x0815, 36538 },
+    { 0x0816, 36571 },
+    { 0x0817, 36607 },
+    { 0x0818, 36643 },
+    { 0x0819, 36685 },
+    { 0x081A, 36729 },
+    { 0x081B, 36770 },
+    { 0x081C, 36813 },
+    { 0x081D, 36855 },
+    { 0x081E, 36899 },
+    { 0x081F, 36929 },
+    { 0x0820, 36962 },
+    { 0x0830, 36992 },
+    { 0x0831, 37023 },
+    { 0x0832, 37052 },
+    { 0x0840, 37081 },
+    { 0x0841, 37115 },
+    { 0x0842, 37150 },
+    { 0x0843, 37191 },
+    { 0x0844, 37226 },
+    { 0x0845, 37262 },
+    { 0x0850, 37304 },
+    { 0x0851, 37327 },
+    { 0x0852, 37354 },
+    { 0x0853, 37380 },
+    { 0x0854, 37422 },
+    { 0x0855, 37456 },
+    { 0x0860, 37482 },
+    { 0x0861, 37500 },
+    { 0x0862, 37515 },
+    { 0x0863, 37532 },
+    { 0x0870, 37546 },
+    { 0x0871, 37566 },
+    { 0x0872, 37583 },
+    { 0x0880, 37601 },
+    { 0x0881, 37618 },
+    { 0x0882, 37652 },
+    { 0x0883, 37687 },
+    { 0x0884, 37721 },
+    { 0x0885, 37751 },
+    { 0x0886, 37771 },
+    { 0x0887, 37807 },
+    { 0x0888, 37835 },
+    { 0x0890, 37860 },
+    { 0x0891, 37887 },
+    { 0x08A0, 37917 },
+    { 0x08A1, 37948 },
+    { 0x08A2, 37973 },
+    { 0x08A3, 38019 },
+    { 0x08A4, 38052 },
+    { 0x08A5, 38082 },
+    { 0x08B0, 38117 },
+    { 0x08B1, 38140 },
+    { 0x08C0, 38167 },
+    { 0x08C1, 38187 },
+    { 0x08C2, 38207 },
+    { 0x08C3, 38228 },
+    { 0x08C4, 38251 },
+    { 0x08C5, 38273 },
+    { 0x08C6, 38293 },
+    { 0x08D0, 38315 },
+    { 0x08D1, 38330 },
+    { 0x08D2, 38341 },
+    { 0x08D3, 38353 },
+    { 0x08D4, 38368 },
+    { 0x08E0, 38385 },
+    { 0x08E1, 38412 },
+    { 0x08E2, 38442 },
+    { 0x08F0, 38470 },
+    { 0x08F1, 38512 },
+    { 0x08F2, 38565 },
+    { 0x08F3, 38619 },
+    { 0x08F4, 38673 },
+    { 0x08F5, 38711 },
+    { 0x0900, 38751 },
+    { 0x0901, 38759 },
+    { 0x0902, 38767 },
+    { 0x0903, 38774 },
+    { 0x0904, 38780 },
+    { 0x0905, 38787 },
+    { 0x0906, 38793 },
+    { 0x0907, 38800 },
+    { 0x0908, 38806 },
+    { 0x0909, 38813 },
+    { 0x090A, 38819 },
+    { 0x090B, 38825 },
+    { 0x090C, 38831 },
+    { 0x090D, 38839 },
+    { 0x090E, 38846 },
+    { 0x090F, 38855 },
+    { 0x0910, 38872 },
+    { 0x0911, 38881 },
+    { 0x0912, 38890 },
+    { 0x0913, 38899 },
+    { 0x0914, 38908 },
+    { 0x0915, 38917 },
+    { 0x0916, 38926 },
+    { 0x0917, 38935 },
+    { 0x0918, 38944 },
+    { 0x0919, 38953 },
+    { 0x091A, 38962 },
+    { 0x091B, 38971 },
+    { 0x091C, 38980 },
+    { 0x091D, 38989 },
+    { 0x091E, 38998 },
+    { 0x091F, 39007 },
+    { 0x0920, 39016 },
+    { 0x0921, 39025 },
+    { 0x0922, 39034 },
+    { 0x0923, 39043 },
+    { 0x0924, 39052 },
+    { 0x0925, 39061 },
+    { 0x0926, 39070 },
+    { 0x0927, 39079 },
+    { 0x0928, 39088 },
+    { 0x0929, 39097 },
+    { 0x092A, 39106 },
+    { 0x092B, 39115 },
+    { 0x092C, 39124 },
+    { 0x092D, 39133 },
+    { 0x092E, 39142 },
+    { 0x092F, 39151 },
+    { 0x0930, 39160 },
+    { 0x0931, 39183 },
+    { 0x0932, 39209 },
+    { 0x0933, 39234 },
+    { 0x0934, 39257 },
+    { 0x0935, 39280 },
+    { 0x0936, 39306 },
+    { 0x0937, 39328 },
+    { 0x0940, 39348 },
+    { 0x0941, 39368 },
+    { 0x0942, 39378 },
+    { 0x0943, 39399 },
+    { 0x0944, 39421 },
+    { 0x0945, 39434 },
+    { 0x0946, 39447 },
+    { 0x0947, 39467 },
+    { 0x0948, 39482 },
+    { 0x0949, 39494 },
+    { 0x094A, 39521 },
+    { 0x094B, 39533 },
+    { 0x094C, 39546 },
+    { 0x094D, 39557 },
+    { 0x094E, 39569 },
+    { 0x094F, 39579 },
+    { 0x0950, 39590 },
+    { 0x0951, 39602 },
+    { 0x0952, 39612 },
+    { 0x0953, 39641 },
+    { 0x0954, 39665 },
+    { 0x0955, 39679 },
+    { 0x0956, 39700 },
+    { 0x0957, 39728 },
+    { 0x0958, 39739 },
+    { 0x0959, 39753 },
+    { 0x095A, 39766 },
+    { 0x095B, 39784 },
+    { 0x095C, 39792 },
+    { 0x095D, 39804 },
+    { 0x095E, 39821 },
+    { 0x0960, 39832 },
+    { 0x0961, 39864 },
+    { 0x0962, 39895 },
+    { 0x0970, 39924 },
+    { 0x0971, 39935 },
+    { 0x0972, 39946 },
+    { 0x0973, 39957 },
+    { 0x0974, 39968 },
+    { 0x0975, 39979 },
+    { 0x0976, 39990 },
+    { 0x0977, 40001 },
+    { 0x0978, 40012 },
+    { 0x0979, 40023 },
+    { 0x097A, 40034 },
+    { 0x097B, 40045 },
+    { 0x097C, 40056 },
+    { 0x097D, 40067 },
+    { 0x097E, 40078 },
+    { 0x097F, 40089 },
+    { 0x0980, 40100 },
+    { 0x0981, 40125 },
+    { 0x0982, 40152 },
+    { 0x0983, 40177 },
+    { 0x0984, 40202 },
+    { 0x0985, 40233 },
+    { 0x0990, 40268 },
+    { 0x0991, 40287 },
+    { 0x0992, 40306 },
+    { 0x09A0, 40325 },
+    { 0x09A1, 40348 },
+    { 0x09A2, 40371 },
+    { 0x09A3, 40396 },
+    { 0x09B0, 40421 },
+    { 0x09B1, 40460 },
+    { 0x09B2, 40499 },
+    { 0x09B3, 40538 },
+    { 0x09B4, 40574 },
+    { 0x09B5, 40599 },
+    { 0x09B6, 40627 },
+    { 0x09C0, 40655 },
+    { 0x09C1, 40715 },
+    { 0x09C2, 40771 },
+    { 0x09C3, 40819 },
+    { 0x1000, 40866 },
+    { 0x2000, 40904 },
+    { 0x3000, 40922 },
+    { 0x4000, 40940 },
+    { 0x5000, 40959 },
+    { 0x6000, 40980 },
+    { 0x7000, 41005 },
+    { 0x8000, 41029 },
+    { 0x9000, 41058 },
+    { 0xA000, 41091 },
+    { 0xB000, 41117 },
+    { 0xC000, 41141 },
+    { 0xD000, 41162 },
+    { 0xE000, 41208 },
+    { 0xF000, 41254 },
+    { 0x0001, 41299 },
+    { 0x0020, 41318 },
+    { 0x0021, 41334 },
+    { 0x0022, 41346 },
+    { 0x0023, 41357 },
+    { 0x0024, 41364 },
+    { 0x0025, 41369 },
+    { 0x0026, 41374 },
+    { 0x0027, 41380 },
+    { 0x0040, 41398 },
+    { 0x0041, 41403 },
+    { 0x0042, 12566 },
+    { 0x0043, 41418 },
+    { 0x0044, 41424 },
+    { 0x0060, 41430 },
+    { 0x0061, 41450 },
+    { 0x0070, 41472 },
+    { 0x0080, 41496 },
+    { 0x0081, 41508 },
+    { 0x0082, 41520 },
+    { 0x0083, 41549 },
+    { 0x0084, 41573 },
+    { 0x0085, 41599 },
+    { 0x0086, 41620 },
+    { 0x0087, 41639 },
+    { 0x0088, 41658 },
+    { 0x0089, 41674 },
+    { 0x00A0, 41690 },
+    { 0x00A1, 41710 },
+    { 0x0001, 41730 },
+    { 0x0002, 41746 },
+    { 0x0003, 41758 },
+    { 0x0004, 41777 },
+    { 0x0005, 41796 },
+    { 0x0006, 41820 },
+    { 0x0007, 41842 },
+    { 0x00FA, 41867 },
+    { 0x00FB, 41880 },
+    { 0x00FC, 41893 },
+    { 0x0100, 41906 },
+    { 0x0101, 41917 },
+    { 0x0200, 41932 },
+    { 0x0201, 41948 },
+    { 0x0202, 41971 },
+    { 0x0203, 41994 },
+    { 0x0204, 42017 },
+    { 0x0205, 42040 },
+    { 0x0206, 42063 },
+    { 0x0207, 42086 },
+    { 0x0208, 42109 },
+    { 0x0209, 42132 },
+    { 0x020A, 42155 },
+    { 0x020B, 42183 },
+    { 0x020C, 42212 },
+    { 0x020D, 42234 },
+    { 0x020E, 42256 },
+    { 0x020F, 42279 },
+    { 0x0210, 42300 },
+    { 0x0211, 42324 },
+    { 0x0212, 42344 },
+    { 0x0213, 42366 },
+    { 0x0214, 42388 },
+    { 0x0215, 42411 },
+    { 0x0216, 42432 },
+    { 0x0217, 42449 },
+    { 0x0218, 42468 },
+    { 0x0219, 42487 },
+    { 0x021A, 42507 },
+    { 0x021B, 42524 },
+    { 0x021C, 42542 },
+    { 0x021D, 42560 },
+    { 0x021E, 42580 },
+    { 0x0001, 42627 },
+    { 0x0002, 42637 },
+    { 0x0003, 42663 },
+    { 0x0004, 42673 },
+    { 0x0005, 42703 },
+    { 0x0006, 42734 },
+    { 0x0007, 42764 },
+    { 0x0008, 42778 },
+    { 0x0020, 42810 },
+    { 0x0021, 42838 },
+    { 0x0022, 42845 },
+    { 0x0023, 42874 },
+    { 0x0024, 42897 },
+    { 0x0025, 42920 },
+    { 0x0026, 42943 },
+    { 0x0027, 42956 },
+    { 0x0028, 42984 },
+    { 0x0029, 42998 },
+    { 0x002A, 43014 },
+    { 0x002B, 43029 },
+    { 0x002C, 43049 },
+    { 0x002D, 43064 },
+    { 0x0050, 43077 },
+    { 0x0051, 43099 },
+    { 0x0052, 43116 },
+    { 0x0053, 43135 },
+    { 0x0054, 43153 },
+    { 0x0055, 43176 },
+    { 0x0060, 43192 },
+    { 0x0061, 43214 },
+    { 0x0062, 43226 },
+    { 0x0070, 43236 },
+    { 0x0071, 43259 },
+    { 0x0001, 43282 },
+    { 0x0002, 43298 },
+    { 0x0003, 43315 },
+    { 0x0004, 43332 },
+    { 0x0001, 43391 },
+    { 0x0010, 43399 },
+    { 0x0012, 43410 },
+    { 0x0016, 43419 },
+    { 0x0018, 43434 },
+    { 0x001A, 43451 },
+    { 0x001C, 41418 },
+    { 0x0020, 43467 },
+    { 0x0022, 43487 },
+    { 0x0024, 43503 },
+    { 0x0026, 43525 },
+    { 0x0028, 43555 },
+    { 0x002A, 43581 },
+    { 0x002C, 43602 },
+    { 0x0030, 43631 },
+    { 0x0032, 43649 },
+    { 0x0034, 43663 },
+    { 0x0036, 43683 },
+    { 0x0038, 43711 },
+    { 0x003A, 43735 },
+    { 0x003C, 43754 },
+    { 0x0040, 43781 },
+    { 0x0042, 43820 },
+    { 0x0044, 43849 },
+    { 0x0046, 43865 },
+    { 0x0048, 43895 },
+    { 0x004A, 43925 },
+    { 0x004C, 43958 },
+    { 0x0056, 43991 },
+    { 0x0058, 44009 },
+    { 0x005E, 44025 },
+    { 0x0060, 44044 },
+    { 0x006C, 44064 },
+    { 0x006E, 44086 },
+    { 0x0070, 44110 },
+    { 0x00A2, 44133 },
+    { 0x00A4, 44150 },
+    { 0x00A6, 44186 },
+    { 0x00A8, 44220 },
+    { 0x00AA, 44241 },
+    { 0x00AC, 44260 },
+    { 0x00AE, 44281 },
+    { 0x00B0, 44300 },
+    { 0x00CA, 44309 },
+    { 0x00D4, 44327 },
+    { 0x0001, 44339 },
+    { 0x0002, 44345 },
+    { 0x0003, 44360 },
+    { 0x0004, 44375 },
+    { 0x0005, 44379 },
+    { 0x0010, 44392 },
+    { 0x0011, 44407 },
+    { 0x0012, 44425 },
+    { 0x0013, 44433 },
+    { 0x0014, 44444 },
+    { 0x0015, 44452 },
+    { 0x0016, 44463 },
+    { 0x0017, 44479 },
+    { 0x0018, 44498 },
+    { 0x0019, 44512 },
+    { 0x001A, 44529 },
+    { 0x001B, 44535 },
+    { 0x001C, 44544 },
+    { 0x001D, 44551 },
+    { 0x001E, 44561 },
+    { 0x001F, 44566 },
+    { 0x0020, 44574 },
+    { 0x0021, 44581 },
+    { 0x0022, 44591 },
+    { 0x0023, 44596 },
+    { 0x0024, 44604 },
+    { 0x0025, 44618 },
+    { 0x0030, 44635 },
+    { 0x0031, 44643 },
+    { 0x0032, 44651 },
+    { 0x0033, 44661 },
+    { 0x0034, 44676 },
+    { 0x0035, 44689 },
+    { 0x0036, 44702 },
+    { 0x0037, 44714 },
+    { 0x0038, 44723 },
+    { 0x0040, 44733 },
+    { 0x0041, 44748 },
+    { 0x0042, 44763 },
+    { 0x0043, 44780 },
+    { 0x0044, 44802 },
+    { 0x0045, 44822 },
+    { 0x0046, 44842 },
+    { 0x0047, 44861 },
+    { 0x0050, 44877 },
+    { 0x0051, 44895 },
+    { 0x0052, 44914 },
+    { 0x0053, 44929 },
+    { 0x0054, 44950 },
+    { 0x0055, 44972 },
+    { 0x0056, 44992 },
+    { 0x0057, 45013 },
+    { 0x0058, 45035 },
+    { 0x0059, 45040 },
+    { 0x005A, 45053 },
+    { 0x0060, 45075 },
+    { 0x0061, 45083 },
+    { 0x0062, 45088 },
+    { 0x0063, 45105 },
+    { 0x0064, 45125 },
+    { 0x0065, 45148 },
+    { 0x0066, 45157 },
+    { 0x0067, 45170 },
+    { 0x0068, 45187 },
+    { 0x0069, 45206 },
+    { 0x006B, 45224 },
+    { 0x006C, 45238 },
+    { 0x006D, 45249 },
+    { 0x006E, 45254 },
+    { 0x006F, 45260 },
+    { 0x0070, 45265 },
+    { 0x0071, 45277 },
+    { 0x0072, 45284 },
+    { 0x0073, 45299 },
+    { 0x00FD, 45318 },
+    { 0x00FE, 45332 },
+    { 0x00FF, 45341 },
+    { 0x0001, 45355 },
+    { 0x0002, 45382 },
+    { 0x0003, 45411 },
+    { 0x0004, 45439 },
+    { 0x0005, 45466 },
+    { 0x0006, 45495 },
+    { 0x0007, 45527 },
+    { 0x0008, 45556 },
+    { 0x0009, 45587 },
+    { 0x0010, 45615 },
+    { 0x0011, 45639 },
+    { 0x0012, 45663 },
+    { 0x0013, 45687 },
+    { 0x0014, 45711 },
+    { 0x0015, 45735 },
+    { 0x0016, 45756 },
+    { 0x0017, 45774 },
+    { 0x0018, 45793 },
+    { 0x0019, 45811 },
+    { 0x001A, 45820 },
+    { 0x001B, 45830 },
+    { 0x001C, 45848 },
+    { 0x001D, 45866 },
+    { 0x0028, 45885 },
+    { 0x0029, 45905 },
+    { 0x002A, 45930 },
+    { 0x002B, 45951 },
+    { 0x002C, 45959 },
+    { 0x002D, 45973 },
+    { 0x002E, 45994 },
+    { 0x002F, 46010 },
+    { 0x0040, 46028 },
+    { 0x0041, 46045 },
+    { 0x0042, 46065 },
+    { 0x0043, 46096 },
+    { 0x0044, 46125 },
+    { 0x0045, 46134 },
+    { 0x0046, 46146 },
+    { 0x0047, 46160 },
+    { 0x0048, 46177 },
+    { 0x0049, 46195 },
+    { 0x004A, 46206 },
+    { 0x004B, 46231 },
+    { 0x0060, 46248 },
+    { 0x0061, 46269 },
+    { 0x0062, 46291 },
+    { 0x0063, 46307 },
+    { 0x0064, 46317 },
+    { 0x0065, 46342 },
+    { 0x0066, 46367 },
+    { 0x0067, 46386 },
+    { 0x0068, 46407 },
+    { 0x0069, 46425 },
+    { 0x006A, 46447 },
+    { 0x006B, 46468 },
+    { 0x0080, 46480 },
+    { 0x0081, 46505 },
+    { 0x0082, 46532 },
+    { 0x0083, 46556 },
+    { 0x0084, 46572 },
+    { 0x0085, 46591 },
+    { 0x0086, 46608 },
+    { 0x0087, 46622 },
+    { 0x0088, 46641 },
+    { 0x0089, 46654 },
+    { 0x008A, 46672 },
+    { 0x008B, 46690 },
+    { 0x008C, 46702 },
+    { 0x008D, 46725 },
+    { 0x008E, 46748 },
+    { 0x008F, 46771 },
+    { 0x00C0, 46788 },
+    { 0x00C1, 46803 },
+    { 0x00C2, 46818 },
+    { 0x00D0, 46832 },
+    { 0x00D1, 46843 },
+    { 0x00D2, 46859 },
+    { 0x00D3, 46870 },
+    { 0x00D4, 46886 },
+    { 0x00D5, 46909 },
+    { 0x00D6, 46924 },
+    { 0x00D7, 46940 },
+    { 0x00D8, 46962 },
+    { 0x00D9, 46983 },
+    { 0x00DA, 47004 },
+    { 0x00DB, 47026 },
+    { 0x00DC, 47048 },
+    { 0x00F0, 47060 },
+    { 0x00F1, 47085 },
+    { 0x00F2, 47098 },
+    { 0x00F3, 47106 },
+    { 0x0001, 47130 },
+    { 0x0002, 47114 },
+    { 0x0003, 47151 },
+    { 0x0004, 47173 },
+    { 0x0005, 47195 },
+    { 0x0010, 47219 },
+    { 0x0011, 47236 },
+    { 0x0012, 47252 },
+    { 0x0013, 47272 },
+    { 0x0014, 47296 },
+    { 0x0015, 47311 },
+    { 0x0016, 47325 },
+    { 0x0017, 47348 },
+    { 0x0018, 47377 },
+    { 0x0019, 47400 },
+    { 0x001A, 47434 },
+    { 0x001B, 47465 },
+    { 0x001C, 47492 },
+    { 0x001D, 47515 },
+    { 0x001E, 47539 },
+    { 0x001F, 47562 },
+    { 0x0030, 47580 },
+    { 0x0031, 47600 },
+    { 0x0032, 47624 },
+    { 0x0033, 47639 },
+    { 0x0034, 47653 },
+    { 0x0035, 47668 },
+    { 0x0036, 47684 },
+    { 0x0037, 47729 },
+    { 0x0038, 47770 },
+    { 0x0039, 47787 },
+    { 0x003A, 47800 },
+    { 0x003B, 47823 },
+    { 0x003C, 47843 },
+    { 0x003D, 47862 },
+    { 0x003E, 47880 },
+    { 0x003F, 47899 },
+    { 0x0040, 47920 },
+    { 0x0041, 47943 },
+    { 0x0042, 47963 },
+    { 0x0043, 47975 },
+    { 0x0044, 47980 },
+    { 0x0045, 47996 },
+    { 0x0046, 48016 },
+    { 0x004D, 48033 },
+    { 0x004E, 48051 },
+    { 0x004F, 48075 },
+    { 0x0050, 48087 },
+    { 0x0051, 48099 },
+    { 0x0052, 48111 },
+    { 0x0055, 48130 },
+    { 0x0056, 48142 },
+    { 0x0057, 48163 },
+    { 0x0058, 48180 },
+    { 0x0059, 48193 },
+    { 0x005A, 48207 },
+    { 0x005B, 48219 },
+    { 0x005C, 48232 },
+    { 0x005D, 48244 },
+    { 0x005E, 48258 },
+    { 0x005F, 48281 },
+    { 0x0060, 48306 },
+    { 0x0061, 48328 },
+    { 0x0062, 48342 },
+    { 0x0063, 48355 },
+    { 0x0064, 48386 },
+    { 0x0065, 48419 },
+    { 0x0066, 48454 },
+    { 0x006D, 48496 },
+    { 0x006E, 48521 },
+    { 0x006F, 48540 },
+    { 0x0070, 48559 },
+    { 0x0075, 48588 },
+    { 0x0076, 48606 },
+    { 0x007A, 48623 },
+    { 0x007B, 48636 },
+    { 0x007C, 48660 },
+    { 0x007D, 48685 },
+    { 0x007E, 48699 },
+    { 0x007F, 48724 },
+    { 0x0080, 48746 },
+    { 0x0082, 48768 },
+    { 0x0083, 48784 },
+    { 0x0084, 48803 },
+    { 0x0085, 48816 },
+    { 0x0086, 48833 },
+    { 0x0087, 48854 },
+    { 0x0088, 48877 },
+    { 0x0089, 48901 },
+    { 0x008A, 48920 },
+    { 0x008B, 48951 },
+    { 0x0091, 48981 },
+    { 0x0092, 48994 },
+    { 0x0093, 49019 },
+    { 0x0094, 49043 },
+    { 0x0095, 49062 },
+    { 0x0096, 49069 },
+    { 0x0097, 49075 },
+    { 0x0098, 49096 },
+    { 0x0099, 49119 },
+    { 0x009A, 49140 },
+    { 0x009B, 49148 },
+    { 0x009C, 49168 },
+    { 0x009D, 49188 },
+    { 0x009E, 49194 },
+    { 0x009F, 49219 },
+    { 0x00A0, 49243 },
+    { 0x00A1, 49266 },
+    { 0x00A2, 49272 },
+    { 0x00A9, 49279 },
+    { 0x00AA, 49290 },
+    { 0x00AB, 49322 },
+    { 0x00AC, 49353 },
+    { 0x00AD, 49374 },
+    { 0x00AE, 49406 },
+    { 0x00AF, 49437 },
+    { 0x00B0, 49458 },
+    { 0x00B1, 49464 },
+    { 0x00B2, 49484 },
+    { 0x00B3, 49511 },
+    { 0x00B4, 49538 },
+    { 0x00B5, 49574 },
+    { 0x00B7, 49610 },
+    { 0x00B8, 49624 },
+    { 0x00B9, 49640 },
+    { 0x00BA, 49659 },
+    { 0x00BB, 49678 },
+    { 0x00BC, 49697 },
+    { 0x00BD, 49717 },
+    { 0x00BE, 49737 },
+    { 0x00BF, 49757 },
+    { 0x00C0, 49786 },
+    { 0x00C3, 49822 },
+    { 0x00C4, 49830 },
+    { 0x00C7, 49839 },
+    { 0x00C8, 49847 },
+    { 0x00C9, 49855 },
+    { 0x00CA, 49877 },
+    { 0x00CB, 49896 },
+    { 0x00CC, 49918 },
+    { 0x00CD, 49930 },
+    { 0x00CE, 49951 },
+    { 0x00D3, 49967 },
+    { 0x00D4, 49987 },
+    { 0x00D5, 49997 },
+    { 0x00D6, 50009 },
+    { 0x00D7, 50021 },
+    { 0x00D8, 50041 },
+    { 0x00D9, 50084 },
+    { 0x00DA, 50126 },
+    { 0x00DB, 50166 },
+    { 0x00DC, 50205 },
+    { 0x00DD, 50240 },
+    { 0x00DE, 50275 },
+    { 0x00DF, 50302 },
+    { 0x00F0, 50329 },
+    { 0x00F1, 50350 },
+    { 0x00F2, 50379 },
+    { 0x00FB, 50407 },
+    { 0x00FC, 50430 },
+    { 0x00FD, 50453 },
+    { 0x00FE, 50476 },
+    { 0x00FF, 50489 },
+    { 0x0100, 50511 },
+    { 0x0101, 50526 },
+    { 0x0102, 50548 },
+    { 0x0103, 50566 },
+    { 0x0104, 50593 },
+    { 0x0106, 50618 },
+    { 0x0107, 50643 },
+    { 0x0108, 50668 },
+    { 0x0109, 50696 },
+    { 0x010A, 50724 },
+    { 0x010B, 50743 },
+    { 0x010C, 50762 },
+    { 0x010D, 50787 },
+    { 0x0110, 50816 },
+    { 0x0111, 50827 },
+    { 0x0112, 50833 },
+    { 0x0113, 50846 },
+    { 0x0114, 50854 },
+    { 0x0115, 50862 },
+    { 0x0116, 50870 },
+    { 0x0117, 50879 },
+    { 0x0118, 50889 },
+    { 0x0119, 50901 },
+    { 0x011A, 50910 },
+    { 0x011B, 50919 },
+    { 0x011C, 50927 },
+    { 0x011D, 50936 },
+    { 0x011E, 50944 },
+    { 0x011F, 50954 },
+    { 0x0120, 50964 },
+    { 0x0121, 50982 },
+    { 0x0001, 50991 },
+    { 0x0020, 50998 },
+    { 0x0021, 51011 },
+    { 0x0022, 51023 },
+    { 0x0023, 51044 },
+    { 0x0024, 51066 },
+    { 0x0025, 51089 },
+    { 0x0026, 51113 },
+    { 0x0027, 51135 },
+    { 0x0028, 51159 },
+    { 0x0029, 51184 },
+    { 0x002A, 51207 },
+    { 0x0030, 51227 },
+    { 0x0031, 51250 },
+    { 0x0032, 51271 },
+    { 0x0033, 51289 },
+    { 0x0034, 51309 },
+    { 0x0035, 51335 },
+    { 0x0040, 51359 },
+    { 0x0041, 51371 },
+    { 0x0050, 51384 },
+    { 0x0051, 51396 },
+    { 0x0052, 51418 },
+    { 0x0053, 51435 },
+    { 0x0054, 51456 },
+    { 0x0055, 51475 },
+    { 0x0056, 51493 },
+    { 0x0057, 51512 },
+    { 0x0058, 51537 },
+    { 0x0059, 51560 },
+    { 0x005A, 51582 },
+    { 0x005B, 51605 },
+    { 0x005C, 51623 },
+    { 0x0060, 51641 },
+    { 0x0061, 51659 },
+    { 0x0070, 51673 },
+    { 0x0071, 51686 },
+    { 0x0072, 51705 },
+    { 0x0073, 51743 },
+    { 0x0074, 51766 },
+    { 0x0075, 51793 },
+    { 0x0076, 51817 },
+    { 0x0077, 51848 },
+    { 0x0078, 51882 },
+    { 0x0080, 51914 },
+    { 0x0081, 51925 },
+    { 0x0001, 51969 },
+    { 0x0011, 51990 },
+    { 0x0012, 52005 },
+    { 0x0013, 52020 },
+    { 0x0014, 52035 },
+    { 0x0020, 52052 },
+    { 0x0021, 52063 },
+    { 0x0022, 52076 },
+    { 0x0023, 52089 },
+    { 0x0024, 52102 },
+    { 0x0020, 52132 },
+    { 0x0021, 52150 },
+    { 0x0001, 52172 },
+    { 0x0002, 52196 },
+    { 0x0003, 52206 },
+    { 0x0030, 52221 },
+    { 0x0031, 52256 },
+    { 0x0032, 52292 },
+    { 0x0033, 52328 },
+    { 0x0034, 52365 },
+    { 0x0035, 52386 },
+    { 0x0036, 52409 },
+    { 0x0037, 52427 },
+    { 0x0038, 52447 },
+    { 0x0039, 52464 },
+    { 0x0040, 52479 },
+    { 0x0041, 52497 },
+    { 0x0042, 52514 },
+    { 0x0043, 52530 },
+    { 0x0044, 52546 },
+    { 0x0045, 52563 },
+    { 0x0046, 52575 },
+    { 0x0047, 52593 },
+    { 0x0048, 52615 },
+    { 0x0049, 52641 },
+    { 0x004A, 52670 },
+    { 0x004B, 52690 },
+    { 0x004C, 52705 },
+    { 0x004D, 52720 },
+    { 0x0001, 52750 },
+    { 0x0020, 52775 },
+    { 0x0021, 52793 },
+};
+
+static inline const IOHIDUsagePageNameEntry * IOHIDUsagePageNameEntryForPage(uint32_t page)
+{
+    uint32_t low    = 0;
+    uint32_t high   = sizeof(__IOHIDUsagePageNames) / sizeof(__IOHIDUsagePageNames[0]);
+
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+
+        if (__IOHIDUsagePageNames[middle].page < page) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low < sizeof(__IOHIDUsagePageNames) / sizeof(__IOHIDUsagePageNames[0]) && __IOHIDUsagePageNames[low].page == page) {
+        return &__IOHIDUsagePageNames[low];
+    }
+    return NULL;
+}
+
+// Returns NULL for pages that are not in the tables
+static inline const char * IOHIDUsagePageName(uint32_t page)
+{
+    const IOHIDUsagePageNameEntry * entry = IOHIDUsagePageNameEntryForPage(page);
+
+    return entry ? &__IOHIDUsageNameStrings[entry->name] : NULL;
+}
+
+// Returns NULL for usages that are not in the tables, including generated usage names
+static inline const char * IOHIDUsageName(uint32_t page, uint32_t usage)
+{
+    const IOHIDUsagePageNameEntry * entry = IOHIDUsagePageNameEntryForPage(page);
+    uint32_t                        low;
+    uint32_t                        high;
+
+    if (!entry || usage > UINT16_MAX) {
+        return NULL;
+    }
+
+    low     = entry->firstUsage;
+    high    = entry->firstUsage + entry->usageCount;
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+
+        if (__IOHIDUsageNames[middle].usage < usage) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low < entry->firstUsage + entry->usageCount && __IOHIDUsageNames[low].usage == usage) {
+        return &__IOHIDUsageNameStrings[__IOHIDUsageNames[low].name];
+    }
+    return NULL;
+}
+
+// Returns the prefix of a generated usage name, such as "Button" for usage 3 of the Button page
+static inline const char * IOHIDUsageNameGeneratedPrefix(uint32_t page, uint32_t usage)
+{
+    const IOHIDUsagePageNameEntry * entry = IOHIDUsagePageNameEntryForPage(page);
+
+    if (!entry || !entry->generatedPrefix || usage < entry->generatedMin || usage > entry->generatedMax) {
+        return NULL;
+    }
+    return &__IOHIDUsageNameStrings[entry->generatedPrefix];
+}
+
+#endif /* IOHIDFamily_IOHIDUsageNames_h */
@@ -1,6 +1,8 @@
+import bisect
 import codecs
 import json
 import pathlib
+import re
 import sys
 
 hidUsageBase = '''//
@@ -134,6 +136,132 @@ public extension HIDUsage {{
 usageEnumCaseBase = '''        case {camelCaseUsage}{buffer}= 0x{usageID:02x}
 '''
 
+usageNamesBase = '''//
+//  IOHIDUsageNames.h
+//  IOHIDFamily
+//
+//  Generated by generateUsages.py from HidUsageTables.json {version}, do not edit.
+//
+//  Usage page and usage names from the HID Usage Tables document: https://www.usb.org/hid.
+//  Pages and the usages of each page are sorted, so lookups are binary searches. Names are
+//  offsets into a single string pool, offset 0 being the empty string.
+//
+
+#ifndef IOHIDFamily_IOHIDUsageNames_h
+#define IOHIDFamily_IOHIDUsageNames_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {{
+    uint16_t    usage;
+    uint16_t    name;
+}} IOHIDUsageNameEntry;
+
+typedef struct {{
+    uint16_t    page;
+    uint16_t    firstUsage;         // index of the page's first entry in __IOHIDUsageNames
+    uint16_t    usageCount;
+    uint16_t    name;
+    uint16_t    generatedPrefix;    // Button, Ordinal and Monitor Enumerated usages are "<prefix> <usage>"
+    uint16_t    generatedMin;
+    uint16_t    generatedMax;
+}} IOHIDUsagePageNameEntry;
+
+static const char __IOHIDUsageNameStrings[] =
+{strings};
+
+static const IOHIDUsagePageNameEntry __IOHIDUsagePageNames[] = {{
+{pages}}};
+
+static const IOHIDUsageNameEntry __IOHIDUsageNames[] = {{
+{usages}}};
+
+static inline const IOHIDUsagePageNameEntry * IOHIDUsagePageNameEntryForPage(uint32_t page)
+{{
+    uint32_t low    = 0;
+    uint32_t high   = sizeof(__IOHIDUsagePageNames) / sizeof(__IOHIDUsagePageNames[0]);
+
+    while (low < high) {{
+        uint32_t middle = (low + high) / 2;
+
+        if (__IOHIDUsagePageNames[middle].page < page) {{
+            low = middle + 1;
+        }} else {{
+            high = middle;
+        }}
+    }}
+
+    if (low < sizeof(__IOHIDUsagePageNames) / sizeof(__IOHIDUsagePageNames[0]) && __IOHIDUsagePageNames[low].page == page) {{
+        return &__IOHIDUsagePageNames[low];
+    }}
+    return NULL;
+}}
+
+// Returns NULL for pages that are not in the tables
+static inline const char * IOHIDUsagePageName(uint32_t page)
+{{
+    const IOHIDUsagePageNameEntry * entry = IOHIDUsagePageNameEntryForPage(page);
+
+    return entry ? &__IOHIDUsageNameStrings[entry->name] : NULL;
+}}
+
+// Returns NULL for usages that are not in the tables, including generated usage names
+static inline const char * IOHIDUsageName(uint32_t page, uint32_t usage)
+{{
+    const IOHIDUsagePageNameEntry * entry = IOHIDUsagePageNameEntryForPage(page);
+    uint32_t                        low;
+    uint32_t                        high;
+
+    if (!entry || usage > UINT16_MAX) {{
+        return NULL;
+    }}
+
+    low     = entry->firstUsage;
+    high    = entry->firstUsage + entry->usageCount;
+    while (low < high) {{
+        uint32_t middle = (low + high) / 2;
+
+        if (__IOHIDUsageNames[middle].usage < usage) {{
+            low = middle + 1;
+        }} else {{
+            high = middle;
+        }}
+    }}
+
+    if (low < entry->firstUsage + entry->usageCount && __IOHIDUsageNames[low].usage == usage) {{
+        return &__IOHIDUsageNameStrings[__IOHIDUsageNames[low].name];
+    }}
+    return NULL;
+}}
+
+// Returns the prefix of a generated usage name, such as "Button" for usage 3 of the Button page
+static inline const char * IOHIDUsageNameGeneratedPrefix(uint32_t page, uint32_t usage)
+{{
+    const IOHIDUsagePageNameEntry * entry = IOHIDUsagePageNameEntryForPage(page);
+
+    if (!entry || !entry->generatedPrefix || usage < entry->generatedMin || usage > entry->generatedMax) {{
+        return NULL;
+    }}
+    return &__IOHIDUsageNameStrings[entry->generatedPrefix];
+}}
+
+#endif /* IOHIDFamily_IOHIDUsageNames_h */
+'''
+
+# Names are written to C as UTF-8, escaping anything outside printable ASCII
+def cStringLiteral(name):
+    result = []
+    for byte in name.encode('utf-8'):
+        char = chr(byte)
+        if char == '"' or char == '\\':
+            result.append('\\' + char)
+        elif 0x20 <= byte < 0x7f:
+            result.append(char)
+        else:
+            result.append('\\{:03o}'.format(byte))
+    return '"' + ''.join(result) + '\\0"'
+
 # There are a lot of special string rules that we have to follow
 # Such as camel case LED being led instead of lED, and removing '/' characters
 def applyStringRules(token, camelCase):
@@ -257,15 +385,18 @@ class UsagesGenerator:
         print("    -h | --help                         Print this usage message.")
         print("    -i | --internal                     Run the internal version, which outputs AppleHIDUsage.swift and AppleHIDUsageTables.h.")
         print("    -f | --file   <input file path>     The path to the input JSON file of HID usages, the format should be similar to HidUsageTables.json.")
-        print("    -o | --output <output file path>    The output directory path for the generated files.\n")
+        print("    -o | --output <output file path>    The output directory path for the generated files.")
+        print("    -n | --names  <output header path>  Also write and check the C usage name tables, tools/IOHIDUsageNames.h.\n")
 
         exit(code)
 
     def __init__(self, argumentList):
         self.inputFilePath       = None
         self.outputDirectoryPath = None
+        self.namesFilePath       = None
         self.inputFile           = None
         self.usagePages          = None
+        self.version             = None
 
         self.parseArguments(argumentList)
         self.verifyFiles()
@@ -310,6 +441,15 @@ class UsagesGenerator:
                     self.outputDirectoryPath = nextArgument
                     i += 1
 
+            elif argument == "-n" or argument == "--names":
+                if self.namesFilePath:
+                    self.printUsageAndExit("Names header path specified multiple times.")
+                if nextArgument == None:
+                    self.printUsageAndExit("Missing names header path.")
+                else:
+                    self.namesFilePath = nextArgument
+                    i += 1
+
             else:
                 self.printUsageAndExit("Unrecognized argument: {}".format(argument))
 
@@ -327,10 +467,16 @@ class UsagesGenerator:
 
         self.outputDirectoryPath.mkdir(parents=True, exist_ok=True)
 
+        if self.namesFilePath:
+            self.namesFilePath = pathlib.Path(self.namesFilePath)
+
     def parseInputFile(self):
-        with self.inputFilePath.open(mode='r') as self.inputFile:
+        with self.inputFilePath.open(mode='r', encoding='utf-8') as self.inputFile:
+            usageTables = json.load(self.inputFile)
+
             # The usage pages are not sorted for some reason, but the usages are
-            self.usagePages = sorted(json.load(self.inputFile)["UsagePages"], key=lambda x: x['Id'])
+            self.usagePages = sorted(usageTables["UsagePages"], key=lambda x: x['Id'])
+            self.version    = "{}.{}".format(usageTables["UsageTableVersion"], usageTables["UsageTableRevision"])
 
     def writeSwiftFile(self):
         # Iterate over every usage page and construct the usage page templates
@@ -384,6 +530,109 @@ class UsagesGenerator:
             outputFile.write(hidUsage)
             outputFile.write(extensions)
 
+    def writeUsageNamesFile(self):
+        strings       = [cStringLiteral("")]
+        stringOffsets = {"": 0}
+        stringsLength = 1
+
+        # Identical names share one copy in the string pool
+        def stringOffset(name):
+            nonlocal stringsLength
+            # The JSON escapes underscores for markdown, as in VT\_BOOL
+            name = name.replace("\\_", "_")
+            if name not in stringOffsets:
+                stringOffsets[name] = stringsLength
+                strings.append(cStringLiteral(name))
+                stringsLength += len(name.encode('utf-8')) + 1
+            return stringOffsets[name]
+
+        pages       = ""
+        usages      = ""
+        usageCount  = 0
+        for usagePage in self.usagePages:
+            generator       = usagePage.get("UsageIdGenerator")
+            generatedPrefix = 0
+            generatedMin    = 0
+            generatedMax    = 0
+            if generator:
+                generatedPrefix = stringOffset(generator["NamePrefix"])
+                generatedMin    = generator["StartUsageId"]
+                generatedMax    = generator["EndUsageId"]
+
+            pages += "    {{ 0x{:04X}, {:4}, {:3}, {:5}, {:5}, 0x{:04X}, 0x{:04X} }},   // {}\n".format(
+                usagePage["Id"], usageCount, len(usagePage["UsageIds"]), stringOffset(usagePage["Name"]),
+                generatedPrefix, generatedMin, generatedMax, usagePage["Name"])
+
+            for usage in sorted(usagePage["UsageIds"], key=lambda x: x['Id']):
+                usages     += "    {{ 0x{:04X}, {:5} }},\n".format(usage["Id"], stringOffset(usage["Name"]))
+                usageCount += 1
+
+        # Entries hold 16-bit indices and offsets
+        if usageCount > 0xFFFF or stringsLength > 0xFFFF:
+            print("\nERROR: The usage name tables no longer fit 16-bit offsets.\n")
+            exit(1)
+
+        usageNames = usageNamesBase.format(version=self.version, strings="    " + "\n    ".join(strings), pages=pages, usages=usages)
+
+        with self.namesFilePath.open(mode='w', encoding='utf-8') as outputFile:
+            outputFile.write(usageNames)
+
+    # Reads the tables back out of the written header and looks up every usage of the input JSON
+    # the way the C lookups do, so a bad table fails the generator rather than a tool at runtime
+    def verifyUsageNamesFile(self):
+        with self.namesFilePath.open(mode='r', encoding='utf-8') as inputFile:
+            text = inputFile.read()
+
+        strings, pages, usages = text.split("static const ")[1:4]
+
+        pool = bytearray()
+        for literal in re.findall(r'^    "(.*)";?$', strings, re.MULTILINE):
+            pool += re.sub(rb'\\([0-7]{1,3}|.)', lambda m: bytes([int(m.group(1), 8)]) if m.group(1).isdigit() else m.group(1), literal.encode('utf-8'))
+
+        def string(offset):
+            return pool[offset:pool.index(0, offset)].decode('utf-8')
+
+        pages  = [tuple(int(v, 0) for v in m) for m in re.findall(r'\{ (0x[0-9A-F]+), +(\d+), +(\d+), +(\d+), +(\d+), (0x[0-9A-F]+), (0x[0-9A-F]+) \}', pages)]
+        usages = [tuple(int(v, 0) for v in m) for m in re.findall(r'\{ (0x[0-9A-F]+), +(\d+) \}', usages)]
+
+        pageIds  = [entry[0] for entry in pages]
+        usageIds = [entry[0] for entry in usages]
+
+        def lookup(page, usage):
+            index = bisect.bisect_left(pageIds, page)
+            if index == len(pages) or pages[index][0] != page:
+                return None, None
+            entry = pages[index]
+            first, count = entry[1], entry[2]
+            index = bisect.bisect_left(usageIds, usage, first, first + count)
+            name = string(usages[index][1]) if index < first + count and usages[index][0] == usage else None
+            return string(entry[3]), name
+
+        errors = 0
+        for usagePage in self.usagePages:
+            pageName, _ = lookup(usagePage["Id"], -1)
+            if pageName != usagePage["Name"].replace("\\_", "_"):
+                print("ERROR: page 0x{:04X} reads back as {}".format(usagePage["Id"], pageName))
+                errors += 1
+
+            ids = set()
+            for usage in usagePage["UsageIds"]:
+                ids.add(usage["Id"])
+                _, name = lookup(usagePage["Id"], usage["Id"])
+                if name != usage["Name"].replace("\\_", "_"):
+                    print("ERROR: usage 0x{:04X}:0x{:04X} reads back as {}".format(usagePage["Id"], usage["Id"], name))
+                    errors += 1
+
+            # Usages between and around the defined ones must not resolve
+            for usage in range(0, max(ids, default=0) + 2):
+                if usage not in ids and lookup(usagePage["Id"], usage)[1] != None:
+                    print("ERROR: undefined usage 0x{:04X}:0x{:04X} resolves".format(usagePage["Id"], usage))
+                    errors += 1
+
+        if errors:
+            print("\nERROR: {} usage names do not round trip through {}.\n".format(errors, self.namesFilePath))
+            exit(1)
+
 def generateUsages(argumentList=None):
     if argumentList == None:
         argumentList = sys.argv
@@ -396,6 +645,11 @@ def generateUsages(argumentList=None):
     # Create the file of HIDUsages in Swift for CoreHID
     generator.writeSwiftFile()
 
+    # Create the C usage name tables for the tools
+    if generator.namesFilePath:
+        generator.writeUsageNamesFile()
+        generator.verifyUsageNamesFile()
+
     print("Success")
 
 if __name__ == "__main__":